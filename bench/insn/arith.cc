@@ -0,0 +1,204 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Measures the throughput of the arithmetic operations on data that fits into
+    the L1 cache. Each result is the time to load two vectors, apply the
+    operation and store the result divided by the number of elements. The
+    latency of the floating-point operations is measured separately by
+    applying the operation repeatedly to the same vector.
+*/
+
+template<class T>
+using bench_arith_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class T>
+bench_arith_vector<T> bench_arith_data(std::size_t count, unsigned seed)
+{
+    // Small positive values are valid arguments for all operations
+    std::mt19937_64 rng(seed);
+    bench_arith_vector<T> data(count);
+    for (auto& v : data)
+        v = T(rng() % 100 + 1);
+    return data;
+}
+
+#define BENCH_ARITH_BINARY(NAME, EXPR)                                      \
+    res.add("arith_" + type + "_" NAME, bench_ns_per_element([&]()          \
+    {                                                                       \
+        for (std::size_t i = 0; i < count; i += V::length) {                \
+            V a = load(pa + i);                                             \
+            V b = load(pb + i);                                             \
+            store(pout + i, V(EXPR));                                       \
+        }                                                                   \
+        bench_use(pout);                                                    \
+    }, count))
+
+#define BENCH_ARITH_LATENCY(NAME, EXPR)                                     \
+    res.add("arith_" + type + "_" NAME "_latency", bench_ns_per_element([&]() \
+    {                                                                       \
+        V a = load(pa);                                                     \
+        V b = load(pb);                                                     \
+        for (std::size_t i = 0; i < count; i += V::length)                  \
+            a = EXPR;                                                       \
+        bench_use(a);                                                       \
+    }, count))
+
+template<class V>
+struct bench_arith_setup {
+    using T = typename V::element_type;
+
+    bench_arith_setup() :
+        a(bench_arith_data<T>(count, 1)),
+        b(bench_arith_data<T>(count, 2)),
+        out(count)
+    {
+    }
+
+    static const std::size_t count = 1 << 12;
+    bench_arith_vector<T> a, b, out;
+};
+
+template<class V>
+void bench_arith_common(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    bench_arith_setup<V> data;
+    const std::size_t count = data.count;
+    const T* pa = data.a.data();
+    const T* pb = data.b.data();
+    T* pout = data.out.data();
+
+    BENCH_ARITH_BINARY("add", add(a, b));
+    BENCH_ARITH_BINARY("sub", sub(a, b));
+    BENCH_ARITH_BINARY("min", min(a, b));
+    BENCH_ARITH_BINARY("max", max(a, b));
+    BENCH_ARITH_BINARY("cmp_lt", blend(a, b, cmp_lt(a, b)));
+}
+
+template<class V>
+void bench_arith_sat(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    bench_arith_setup<V> data;
+    const std::size_t count = data.count;
+    const T* pa = data.a.data();
+    const T* pb = data.b.data();
+    T* pout = data.out.data();
+
+    BENCH_ARITH_BINARY("add_sat", add_sat(a, b));
+    BENCH_ARITH_BINARY("sub_sat", sub_sat(a, b));
+}
+
+template<class V>
+void bench_arith_int(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    bench_arith_setup<V> data;
+    const std::size_t count = data.count;
+    const T* pa = data.a.data();
+    const T* pb = data.b.data();
+    T* pout = data.out.data();
+
+    BENCH_ARITH_BINARY("abs", abs(sub(a, b)));
+    BENCH_ARITH_BINARY("shift_l", shift_l<3>(a));
+    BENCH_ARITH_BINARY("shift_r", shift_r<3>(a));
+    BENCH_ARITH_BINARY("avg", avg(a, b));
+}
+
+template<class V>
+void bench_arith_mul_lo(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    bench_arith_setup<V> data;
+    const std::size_t count = data.count;
+    const T* pa = data.a.data();
+    const T* pb = data.b.data();
+    T* pout = data.out.data();
+
+    BENCH_ARITH_BINARY("mul_lo", mul_lo(a, b));
+}
+
+template<class V>
+void bench_arith_float(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    bench_arith_setup<V> data;
+    const std::size_t count = data.count;
+    const T* pa = data.a.data();
+    const T* pb = data.b.data();
+    T* pout = data.out.data();
+
+    BENCH_ARITH_BINARY("mul", mul(a, b));
+    BENCH_ARITH_BINARY("div", div(a, b));
+    BENCH_ARITH_BINARY("sqrt", sqrt(a));
+    BENCH_ARITH_BINARY("abs", abs(sub(a, b)));
+    BENCH_ARITH_BINARY("floor", floor(div(a, b)));
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL
+    BENCH_ARITH_BINARY("fmadd", fmadd(a, b, a));
+#endif
+
+    BENCH_ARITH_LATENCY("add", add(a, b));
+    BENCH_ARITH_LATENCY("mul", mul(a, b));
+    BENCH_ARITH_LATENCY("div", div(a, b));
+    BENCH_ARITH_LATENCY("sqrt", sqrt(a));
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL
+    BENCH_ARITH_LATENCY("fmadd", fmadd(a, b, b));
+#endif
+}
+
+#undef BENCH_ARITH_BINARY
+#undef BENCH_ARITH_LATENCY
+
+void bench_arith(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_arith_common<int8<SIMDPP_FAST_INT8_SIZE>>(res, "i8");
+    bench_arith_common<uint8<SIMDPP_FAST_INT8_SIZE>>(res, "u8");
+    bench_arith_common<int16<SIMDPP_FAST_INT16_SIZE>>(res, "i16");
+    bench_arith_common<uint16<SIMDPP_FAST_INT16_SIZE>>(res, "u16");
+    bench_arith_common<int32<SIMDPP_FAST_INT32_SIZE>>(res, "i32");
+    bench_arith_common<uint32<SIMDPP_FAST_INT32_SIZE>>(res, "u32");
+    bench_arith_common<float32<SIMDPP_FAST_FLOAT32_SIZE>>(res, "f32");
+    bench_arith_common<float64<SIMDPP_FAST_FLOAT64_SIZE>>(res, "f64");
+
+    bench_arith_sat<int8<SIMDPP_FAST_INT8_SIZE>>(res, "i8");
+    bench_arith_sat<uint8<SIMDPP_FAST_INT8_SIZE>>(res, "u8");
+    bench_arith_sat<int16<SIMDPP_FAST_INT16_SIZE>>(res, "i16");
+    bench_arith_sat<uint16<SIMDPP_FAST_INT16_SIZE>>(res, "u16");
+
+    bench_arith_int<int8<SIMDPP_FAST_INT8_SIZE>>(res, "i8");
+    bench_arith_int<int16<SIMDPP_FAST_INT16_SIZE>>(res, "i16");
+    bench_arith_int<int32<SIMDPP_FAST_INT32_SIZE>>(res, "i32");
+
+    bench_arith_mul_lo<uint16<SIMDPP_FAST_INT16_SIZE>>(res, "u16");
+    bench_arith_mul_lo<uint32<SIMDPP_FAST_INT32_SIZE>>(res, "u32");
+
+    bench_arith_float<float32<SIMDPP_FAST_FLOAT32_SIZE>>(res, "f32");
+    bench_arith_float<float64<SIMDPP_FAST_FLOAT64_SIZE>>(res, "f64");
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,60 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void main_bench_function(BenchResults& res)
+{
+    bench_arith(res);
+    bench_compress(res);
+    bench_convert(res);
+    bench_dispatch(res);
+    bench_div(res);
+    bench_encoding(res);
+    bench_find(res);
+    bench_gather(res);
+    bench_hash(res);
+    bench_load_store(res);
+    bench_reduce(res);
+    bench_scan(res);
+    bench_set_operations(res);
+    bench_shuffle(res);
+    bench_sort(res);
+    bench_structural(res);
+    bench_transpose(res);
+    bench_utf8(res);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+/*  As in the tests, the dispatcher is used only to register the available
+    functions, not to dispatch them.
+*/
+inline simdpp::Arch get_arch()
+{
+    return simdpp::Arch();
+}
+
+#define SIMDPP_USER_ARCH_INFO get_arch()
+
+SIMDPP_MAKE_DISPATCHER_VOID1(main_bench_function, BenchResults&)
+
+#if SIMDPP_EMIT_DISPATCHER
+std::vector<simdpp::detail::FnVersion> get_bench_archs()
+{
+    simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};
+    using FunPtr = void(*)(BenchResults&);
+    SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, main_bench_function, FunPtr)
+    std::vector<simdpp::detail::FnVersion> result;
+    result.assign(versions, versions+SIMDPP_DISPATCH_MAX_ARCHS);
+    return result;
+}
+#endif
@@ -0,0 +1,42 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_INSN_BENCHES_H
+#define LIBSIMDPP_BENCH_INSN_BENCHES_H
+
+#include "../utils/bench_results.h"
+#include "../utils/bench_timer.h"
+#include <simdpp/simd.h>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+void main_bench_function(BenchResults& res);
+void bench_arith(BenchResults& res);
+void bench_compress(BenchResults& res);
+void bench_convert(BenchResults& res);
+void bench_dispatch(BenchResults& res);
+void bench_div(BenchResults& res);
+void bench_encoding(BenchResults& res);
+void bench_find(BenchResults& res);
+void bench_gather(BenchResults& res);
+void bench_hash(BenchResults& res);
+void bench_load_store(BenchResults& res);
+void bench_reduce(BenchResults& res);
+void bench_scan(BenchResults& res);
+void bench_set_operations(BenchResults& res);
+void bench_shuffle(BenchResults& res);
+void bench_sort(BenchResults& res);
+void bench_structural(BenchResults& res);
+void bench_transpose(BenchResults& res);
+void bench_utf8(BenchResults& res);
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+std::vector<simdpp::detail::FnVersion> get_bench_archs();
+
+#endif
@@ -0,0 +1,137 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Filters an array of random values by selecting the even elements, that is
+    about half of them. store_compress and store_compress_unsafe_tail are
+    compared with a scalar branchless filter, load_expand and
+    load_expand_unsafe_tail with a scalar branchless expansion. The data does
+    not fit into the L1 cache.
+*/
+
+template<class T>
+using bench_compress_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class V>
+void bench_compress_type(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    const std::size_t count = 1 << 20;
+    const std::size_t L = V::length;
+    bench_compress_vector<T> data(count);
+    bench_compress_vector<T> out(count + L);
+    std::vector<unsigned> counts(count / L);
+    std::mt19937_64 rng(1);
+    for (auto& el : data)
+        el = T(rng());
+    for (std::size_t i = 0; i < count; ++i)
+        counts[i / L] += (data[i] & 1) == 0;
+    const T* pdata = data.data();
+    T* pout = out.data();
+
+    res.add("compress_scalar_" + type, bench_ns_per_element([&]()
+    {
+        T* o = pout;
+        for (std::size_t i = 0; i < count; ++i) {
+            *o = pdata[i];
+            o += (pdata[i] & 1) == 0;
+        }
+        bench_use(o);
+    }, count));
+
+    res.add("store_compress_" + type, bench_ns_per_element([&]()
+    {
+        T* o = pout;
+        V one = splat(1);
+        for (std::size_t i = 0; i < count; i += L) {
+            V a = load(pdata + i);
+            o += store_compress(o, a, cmp_eq(bit_and(a, one), 0));
+        }
+        bench_use(o);
+    }, count));
+
+    res.add("store_compress_unsafe_tail_" + type, bench_ns_per_element([&]()
+    {
+        T* o = pout;
+        V one = splat(1);
+        for (std::size_t i = 0; i < count; i += L) {
+            V a = load(pdata + i);
+            o += store_compress_unsafe_tail(o, a, cmp_eq(bit_and(a, one), 0));
+        }
+        bench_use(o);
+    }, count));
+
+    res.add("expand_scalar_" + type, bench_ns_per_element([&]()
+    {
+        const T* s = pdata;
+        for (std::size_t i = 0; i < count; ++i) {
+            bool sel = (pdata[i] & 1) == 0;
+            pout[i] = sel ? *s : T(0);
+            s += sel;
+        }
+        bench_use(pout);
+    }, count));
+
+    res.add("load_expand_" + type, bench_ns_per_element([&]()
+    {
+        const T* s = pdata;
+        V one = splat(1);
+        for (std::size_t i = 0; i < count; i += L) {
+            V a = load(pdata + i);
+            auto mask = cmp_eq(bit_and(a, one), 0);
+            V r = load_expand(s, mask);
+            store(pout + i, r);
+            s += counts[i / L];
+        }
+        bench_use(pout);
+    }, count));
+
+    res.add("load_expand_unsafe_tail_" + type, bench_ns_per_element([&]()
+    {
+        const T* s = pdata;
+        V one = splat(1);
+        for (std::size_t i = 0; i < count; i += L) {
+            V a = load(pdata + i);
+            auto mask = cmp_eq(bit_and(a, one), 0);
+            V r = load_expand_unsafe_tail(s, mask);
+            store(pout + i, r);
+            s += counts[i / L];
+        }
+        bench_use(pout);
+    }, count));
+}
+
+void bench_compress(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_compress_type<uint8<16>>(res, "u8x16");
+    bench_compress_type<uint16<8>>(res, "u16x8");
+    bench_compress_type<uint32<4>>(res, "u32x4");
+    bench_compress_type<uint64<2>>(res, "u64x2");
+#if SIMDPP_USE_AVX2
+    bench_compress_type<uint8<32>>(res, "u8x32");
+    bench_compress_type<uint32<8>>(res, "u32x8");
+    bench_compress_type<uint64<4>>(res, "u64x4");
+#endif
+#if SIMDPP_USE_AVX512F
+    bench_compress_type<uint32<16>>(res, "u32x16");
+    bench_compress_type<uint64<8>>(res, "u64x8");
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,89 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Measures the throughput of the conversions between element types. Each
+    result is the time to load a vector, convert it and store the result
+    divided by the number of converted elements. The data fits into the L1
+    cache.
+*/
+
+template<class T>
+using bench_convert_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class T>
+bench_convert_vector<T> bench_convert_data(std::size_t count)
+{
+    std::mt19937_64 rng(42);
+    bench_convert_vector<T> data(count);
+    for (auto& v : data)
+        v = T(rng() % 100);
+    return data;
+}
+
+template<class VIn, class VOut>
+struct bench_convert_setup {
+    using TIn = typename VIn::element_type;
+    using TOut = typename VOut::element_type;
+    static_assert(VIn::length == VOut::length, "Length mismatch");
+
+    bench_convert_setup() : in(bench_convert_data<TIn>(count)), out(count) {}
+
+    static const std::size_t count = 1 << 12;
+    bench_convert_vector<TIn> in;
+    bench_convert_vector<TOut> out;
+};
+
+#define BENCH_CONVERT(VIN, VOUT, NAME, EXPR)                                \
+    {                                                                       \
+        bench_convert_setup<VIN, VOUT> data;                                \
+        const std::size_t count = data.count;                               \
+        const VIN::element_type* pdata = data.in.data();                    \
+        VOUT::element_type* pout = data.out.data();                         \
+        res.add("convert_" NAME, bench_ns_per_element([&]()                 \
+        {                                                                   \
+            for (std::size_t i = 0; i < count; i += VIN::length) {          \
+                VIN a = load(pdata + i);                                    \
+                store(pout + i, VOUT(EXPR));                                \
+            }                                                               \
+            bench_use(pout);                                                \
+        }, count));                                                         \
+    }
+
+void bench_convert(BenchResults& res)
+{
+    using namespace simdpp;
+    // The narrowest element type determines the minimum vector length
+    const unsigned N = SIMDPP_FAST_INT8_SIZE;
+
+    BENCH_CONVERT(float32<N>, int32<N>, "f32_to_i32", to_int32(a));
+    BENCH_CONVERT(int32<N>, float32<N>, "i32_to_f32", to_float32(a));
+    BENCH_CONVERT(float32<N>, float64<N>, "f32_to_f64", to_float64(a));
+    BENCH_CONVERT(float64<N>, float32<N>, "f64_to_f32", to_float32(a));
+    BENCH_CONVERT(int32<N>, float64<N>, "i32_to_f64", to_float64(a));
+    BENCH_CONVERT(uint8<N>, int16<N>, "u8_to_i16", to_int16(a));
+    BENCH_CONVERT(int16<N>, int8<N>, "i16_to_i8", to_int8(a));
+    BENCH_CONVERT(uint8<N>, uint32<N>, "u8_to_u32", to_uint32(a));
+    BENCH_CONVERT(uint32<N>, uint8<N>, "u32_to_u8", to_uint8(a));
+    BENCH_CONVERT(int32<N>, int64<N>, "i32_to_i64", to_int64(a));
+    BENCH_CONVERT(float32<N>, uint16<N>, "f32_to_f16",
+                  bit_cast<uint16<N>>(to_float16(a)));
+    BENCH_CONVERT(uint16<N>, float32<N>, "f16_to_f32",
+                  to_float32(bit_cast<float16<N>>(a)));
+}
+
+#undef BENCH_CONVERT
+
+} // namespace SIMDPP_ARCH_NAMESPACE
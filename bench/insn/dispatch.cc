@@ -0,0 +1,92 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstddef>
+#include <cstdint>
+
+/*  Measures the overhead of calling a function through the dispatcher
+    generated by SIMDPP_MAKE_DISPATCHER. The dispatched function is compared
+    with a direct call of the same function and with selecting the version
+    on every call, which is what the dispatcher would cost without caching
+    the selected function pointer.
+*/
+
+#if _MSC_VER
+#define BENCH_DISPATCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_DISPATCH_NOINLINE __attribute__((noinline))
+#endif
+
+// Defined by SIMDPP_MAKE_DISPATCHER below in a single object file
+uint32_t bench_dispatch_target(uint32_t a, uint32_t b);
+uint32_t bench_dispatch_select_each_call(uint32_t a, uint32_t b);
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+BENCH_DISPATCH_NOINLINE uint32_t bench_dispatch_target(uint32_t a, uint32_t b)
+{
+    return a * 3 + b;
+}
+
+void bench_dispatch(BenchResults& res)
+{
+    const std::size_t count = 1 << 12;
+
+    res.add("dispatch_direct", bench_ns_per_element([&]()
+    {
+        uint32_t r = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            r = SIMDPP_ARCH_NAMESPACE::bench_dispatch_target(r, uint32_t(i));
+        bench_use(r);
+    }, count));
+
+    res.add("dispatch_cached", bench_ns_per_element([&]()
+    {
+        uint32_t r = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            r = ::bench_dispatch_target(r, uint32_t(i));
+        bench_use(r);
+    }, count));
+
+    res.add("dispatch_select_each_call", bench_ns_per_element([&]()
+    {
+        uint32_t r = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            r = ::bench_dispatch_select_each_call(r, uint32_t(i));
+        bench_use(r);
+    }, count));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+/*  All versions of bench_dispatch_target perform the same scalar
+    computation, so it does not matter which one is selected.
+*/
+inline simdpp::Arch bench_dispatch_get_arch()
+{
+    return simdpp::Arch();
+}
+
+#define SIMDPP_USER_ARCH_INFO bench_dispatch_get_arch()
+
+SIMDPP_MAKE_DISPATCHER((uint32_t)(bench_dispatch_target)((uint32_t) a, (uint32_t) b))
+
+#if SIMDPP_EMIT_DISPATCHER
+uint32_t bench_dispatch_select_each_call(uint32_t a, uint32_t b)
+{
+    using FunPtr = uint32_t(*)(uint32_t, uint32_t);
+    simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};
+    SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, bench_dispatch_target, FunPtr)
+    simdpp::detail::FnVersion version =
+            simdpp::detail::select_version_any(versions,
+                                               SIMDPP_DISPATCH_MAX_ARCHS,
+                                               SIMDPP_USER_ARCH_INFO);
+    return reinterpret_cast<FunPtr>(version.fun_ptr)(a, b);
+}
+#endif
@@ -0,0 +1,128 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares the division by a runtime divisor using divider with the scalar
+    division and, for 8-bit and 16-bit elements, with the bit-serial div_p.
+    The divisor is read from a volatile variable so that the compiler can not
+    turn the scalar division into a multiplication.
+*/
+
+template<class T>
+using bench_div_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class T>
+bench_div_vector<T> bench_div_data(std::size_t count)
+{
+    std::mt19937_64 rng(42);
+    bench_div_vector<T> data(count);
+    for (auto& v : data)
+        v = T(rng());
+    return data;
+}
+
+template<class V>
+void bench_div_type(BenchResults& res, const std::string& name,
+                    typename V::element_type divisor)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    const std::size_t count = 1 << 14;
+    auto data = bench_div_data<T>(count);
+    bench_div_vector<T> out(count);
+    const T* pdata = data.data();
+    T* pout = out.data();
+
+    volatile T vd = divisor;
+    T d = vd;
+
+    res.add("div_" + name + "_scalar", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            pout[i] = T(pdata[i] / d);
+        bench_use(pout);
+    }, count));
+
+    res.add("div_" + name + "_divider", bench_ns_per_element([&]()
+    {
+        divider<T> dv(d);
+        for (std::size_t i = 0; i < count; i += V::length) {
+            V a = load(pdata + i);
+            store(pout + i, div(a, dv));
+        }
+        bench_use(pout);
+    }, count));
+
+    res.add("mod_" + name + "_scalar", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            pout[i] = T(pdata[i] % d);
+        bench_use(pout);
+    }, count));
+
+    res.add("mod_" + name + "_divider", bench_ns_per_element([&]()
+    {
+        divider<T> dv(d);
+        for (std::size_t i = 0; i < count; i += V::length) {
+            V a = load(pdata + i);
+            store(pout + i, mod(a, dv));
+        }
+        bench_use(pout);
+    }, count));
+}
+
+template<class V, unsigned P>
+void bench_div_p_type(BenchResults& res, const std::string& name,
+                      typename V::element_type divisor)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    const std::size_t count = 1 << 14;
+    auto data = bench_div_data<T>(count);
+    bench_div_vector<T> out(count);
+    const T* pdata = data.data();
+    T* pout = out.data();
+
+    volatile T vd = divisor;
+    V d = make_uint(T(vd));
+
+    res.add("div_" + name + "_div_p", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += V::length) {
+            V a = load(pdata + i);
+            store(pout + i, div_p<P>(a, d));
+        }
+        bench_use(pout);
+    }, count));
+}
+
+void bench_div(BenchResults& res)
+{
+    using namespace simdpp;
+    bench_div_type<uint8<SIMDPP_FAST_INT8_SIZE>>(res, "u8", 7);
+    bench_div_p_type<uint8x16, 8>(res, "u8", 7);
+    bench_div_type<int8<SIMDPP_FAST_INT8_SIZE>>(res, "i8", -7);
+    bench_div_type<uint16<SIMDPP_FAST_INT16_SIZE>>(res, "u16", 641);
+    bench_div_p_type<uint16x8, 16>(res, "u16", 641);
+    bench_div_type<int16<SIMDPP_FAST_INT16_SIZE>>(res, "i16", -641);
+    bench_div_type<uint32<SIMDPP_FAST_INT32_SIZE>>(res, "u32", 641);
+    bench_div_type<int32<SIMDPP_FAST_INT32_SIZE>>(res, "i32", -641);
+    bench_div_type<uint64<SIMDPP_FAST_INT64_SIZE>>(res, "u64", 641);
+    bench_div_type<int64<SIMDPP_FAST_INT64_SIZE>>(res, "i64", -641);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
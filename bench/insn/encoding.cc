@@ -0,0 +1,124 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares the base64 and hex functions with table-driven scalar loops of the
+    kind commonly used in the absence of vectorized implementations. The
+    results are in nanoseconds per input byte.
+*/
+
+static const char bench_base64_chars[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static char* bench_base64_encode_scalar(const uint8_t* p, const uint8_t* last, char* out)
+{
+    for (; last - p >= 3; p += 3) {
+        uint32_t v = (uint32_t(p[0]) << 16) | (uint32_t(p[1]) << 8) | p[2];
+        *out++ = bench_base64_chars[v >> 18];
+        *out++ = bench_base64_chars[(v >> 12) & 0x3f];
+        *out++ = bench_base64_chars[(v >> 6) & 0x3f];
+        *out++ = bench_base64_chars[v & 0x3f];
+    }
+    return out;
+}
+
+static char* bench_base64_decode_scalar(const int8_t* table, const uint8_t* p,
+                                        const uint8_t* last, char* out)
+{
+    for (; last - p >= 4; p += 4) {
+        int32_t v = (int32_t(table[p[0]]) << 18) | (int32_t(table[p[1]]) << 12) |
+                    (int32_t(table[p[2]]) << 6) | table[p[3]];
+        if (v < 0)
+            return nullptr;
+        *out++ = char(v >> 16);
+        *out++ = char(v >> 8);
+        *out++ = char(v);
+    }
+    return out;
+}
+
+static void bench_encoding_size(BenchResults& res, std::size_t size)
+{
+    using namespace simdpp;
+
+    // multiple of 3 bytes, thus there's no padding
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i < size; ++i)
+        data[i] = char((i * 7919) >> 3);
+    std::vector<char> text(base64_encoded_size(size));
+    std::vector<char> hex(2 * size);
+    std::vector<char> out(size + 2);
+    base64_encode(data.data(), data.data() + size, text.data());
+    hex_encode(data.data(), data.data() + size, hex.data());
+
+    int8_t table[256];
+    for (unsigned i = 0; i < 256; ++i)
+        table[i] = -1;
+    for (unsigned i = 0; i < 64; ++i)
+        table[uint8_t(bench_base64_chars[i])] = int8_t(i);
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data.data());
+    const uint8_t* chars = reinterpret_cast<const uint8_t*>(text.data());
+    std::string prefix = "encoding_" + std::to_string(size) + "_";
+
+    res.add(prefix + "base64_encode_scalar", bench_ns_per_element([&]()
+    {
+        bench_use(bench_base64_encode_scalar(bytes, bytes + size, text.data()));
+    }, size));
+
+    res.add(prefix + "base64_encode_simd", bench_ns_per_element([&]()
+    {
+        bench_use(base64_encode(data.data(), data.data() + size, text.data()));
+    }, size));
+
+    res.add(prefix + "base64_decode_scalar", bench_ns_per_element([&]()
+    {
+        bench_use(bench_base64_decode_scalar(table, chars, chars + text.size(), out.data()));
+    }, size));
+
+    res.add(prefix + "base64_decode_simd", bench_ns_per_element([&]()
+    {
+        bench_use(base64_decode(text.data(), text.data() + text.size(), out.data()).out);
+    }, size));
+
+    res.add(prefix + "hex_encode_scalar", bench_ns_per_element([&]()
+    {
+        static const char digits[] = "0123456789abcdef";
+        char* r = hex.data();
+        for (std::size_t i = 0; i < size; ++i) {
+            *r++ = digits[bytes[i] >> 4];
+            *r++ = digits[bytes[i] & 0xf];
+        }
+        bench_use(r);
+    }, size));
+
+    res.add(prefix + "hex_encode_simd", bench_ns_per_element([&]()
+    {
+        bench_use(hex_encode(data.data(), data.data() + size, hex.data()));
+    }, size));
+
+    res.add(prefix + "hex_decode_simd", bench_ns_per_element([&]()
+    {
+        bench_use(hex_decode(hex.data(), hex.data() + hex.size(), out.data()).out);
+    }, size));
+}
+
+void bench_encoding(BenchResults& res)
+{
+    bench_encoding_size(res, 96);
+    bench_encoding_size(res, 3 << 12);
+    bench_encoding_size(res, 3 << 17);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
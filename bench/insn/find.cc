@@ -0,0 +1,121 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares the byte search functions with the equivalent C library
+    functions. The searched bytes are placed only at the end of the buffer, or
+    at the beginning when searching backwards, so each call scans the whole
+    buffer. The buffer starts at an odd address to
+    exercise the alignment prologues.
+*/
+
+using bench_find_vector = std::vector<char, simdpp::aligned_allocator<char, 64>>;
+
+void bench_find_size(BenchResults& res, std::size_t count)
+{
+    using namespace simdpp;
+
+    bench_find_vector storage(count + 64);
+    char* data = storage.data() + 1;
+    for (std::size_t i = 0; i < count; ++i)
+        data[i] = char('a' + i % 26);
+    data[0] = '#';
+    data[count - 1] = '\n';
+    data[count] = 0;
+    bench_find_vector other(storage);
+    other[count] = '\n';
+    const char* first = data;
+    const char* last = data + count;
+    const char set[] = "\n,;:";
+    std::string suffix = "_" + std::to_string(count);
+
+    res.add("find_byte" + suffix + "_memchr", bench_ns_per_element([&]()
+    {
+        bench_use(std::memchr(first, '\n', count));
+    }, count));
+
+    res.add("find_byte" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        bench_use(find_byte(first, last, '\n'));
+    }, count));
+
+#if __GLIBC__
+    res.add("find_last_byte" + suffix + "_memrchr", bench_ns_per_element([&]()
+    {
+        bench_use(memrchr(first, '#', count));
+    }, count));
+#endif
+
+    res.add("find_last_byte" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        bench_use(find_last_byte(first, last, '#'));
+    }, count));
+
+    res.add("find_any_of" + suffix + "_strpbrk", bench_ns_per_element([&]()
+    {
+        bench_use(std::strpbrk(first, set));
+    }, count));
+
+    res.add("find_any_of" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        bench_use(find_any_of(first, last, set, set + 4));
+    }, count));
+
+    res.add("strlen" + suffix + "_strlen", bench_ns_per_element([&]()
+    {
+        std::size_t r = std::strlen(first);
+        bench_use(r);
+    }, count));
+
+    res.add("strlen" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        std::size_t r = simdpp::strlen(first);
+        bench_use(r);
+    }, count));
+
+    res.add("count_byte" + suffix + "_std_count", bench_ns_per_element([&]()
+    {
+        std::size_t r = std::count(first, last, 'e');
+        bench_use(r);
+    }, count));
+
+    res.add("count_byte" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        std::size_t r = count_byte(first, last, 'e');
+        bench_use(r);
+    }, count));
+
+    const char* second = other.data() + 1;
+    res.add("find_first_mismatch" + suffix + "_memcmp", bench_ns_per_element([&]()
+    {
+        int r = std::memcmp(first, second, count);
+        bench_use(r);
+    }, count));
+
+    res.add("find_first_mismatch" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        std::size_t r = find_first_mismatch(first, second, count);
+        bench_use(r);
+    }, count));
+}
+
+void bench_find(BenchResults& res)
+{
+    const std::size_t sizes[] = { 16, 64, 1 << 10, 1 << 16 };
+    for (std::size_t size : sizes)
+        bench_find_size(res, size);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,111 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares the native gather and scatter instructions with the emulation
+    that loads or stores each element separately and with plain scalar code.
+    The tables are sized to fit either into the L1 cache or only into the main
+    memory, since the relative performance of the approaches differs between
+    these cases.
+*/
+
+template<unsigned N>
+void bench_gather_table(BenchResults& res, const std::string& suffix,
+                        std::size_t table_size)
+{
+    using namespace simdpp;
+    using simdpp::detail::insn::i_emul_gather;
+    using simdpp::detail::insn::i_emul_scatter;
+
+    const std::size_t count = 1 << 16;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<uint32_t> dist(0, uint32_t(table_size - 1));
+
+    std::vector<float, aligned_allocator<float, 64>> table(table_size, 1.0f);
+    std::vector<uint32_t, aligned_allocator<uint32_t, 64>> indices(count);
+    for (auto& i : indices)
+        i = dist(rng);
+
+    const float* ptable = table.data();
+    float* wtable = table.data();
+    const uint32_t* pidx = indices.data();
+
+    res.add("gather_f32_scalar_" + suffix, bench_ns_per_element([&]()
+    {
+        float sum = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            sum += ptable[pidx[i]];
+        bench_use(sum);
+    }, count));
+
+    res.add("gather_f32_simdpp_" + suffix, bench_ns_per_element([&]()
+    {
+        float32<N> sum = make_zero();
+        for (std::size_t i = 0; i < count; i += N) {
+            uint32<N> idx = load(pidx + i);
+            sum = add(sum, gather(ptable, idx));
+        }
+        bench_use(sum);
+    }, count));
+
+    res.add("gather_f32_emulated_" + suffix, bench_ns_per_element([&]()
+    {
+        const char* p = reinterpret_cast<const char*>(ptable);
+        float32<N> sum = make_zero();
+        for (std::size_t i = 0; i < count; i += N) {
+            uint32<N> idx = load(pidx + i);
+            sum = add(sum, i_emul_gather<float32<N>>(p, idx));
+        }
+        bench_use(sum);
+    }, count));
+
+    res.add("scatter_f32_scalar_" + suffix, bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            wtable[pidx[i]] = float(i);
+        bench_use(wtable);
+    }, count));
+
+    res.add("scatter_f32_simdpp_" + suffix, bench_ns_per_element([&]()
+    {
+        float32<N> v = make_float(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        for (std::size_t i = 0; i < count; i += N) {
+            uint32<N> idx = load(pidx + i);
+            scatter(wtable, idx, v);
+        }
+        bench_use(wtable);
+    }, count));
+
+    res.add("scatter_f32_emulated_" + suffix, bench_ns_per_element([&]()
+    {
+        char* p = reinterpret_cast<char*>(wtable);
+        float32<N> v = make_float(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        for (std::size_t i = 0; i < count; i += N) {
+            uint32<N> idx = load(pidx + i);
+            i_emul_scatter(p, idx, v);
+        }
+        bench_use(wtable);
+    }, count));
+}
+
+void bench_gather(BenchResults& res)
+{
+    const unsigned N = SIMDPP_FAST_FLOAT32_SIZE;
+    bench_gather_table<N>(res, "l1", 1 << 10);
+    bench_gather_table<N>(res, "mem", 1 << 24);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
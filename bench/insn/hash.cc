@@ -0,0 +1,205 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares the multi-lane hashes with scalar loops over the same keys, in
+    nanoseconds per key, and measures the throughput of the bulk hashes in
+    nanoseconds per byte. The bulk hashes are compared with the
+    byte-at-a-time CRC32C table algorithm and with XXH32 computed using a
+    single vector of accumulators.
+*/
+
+using bench_hash_uint32 = simdpp::uint32<SIMDPP_FAST_INT32_SIZE>;
+using bench_hash_uint64 = simdpp::uint64<SIMDPP_FAST_INT64_SIZE>;
+
+static uint32_t bench_fmix32(uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
+}
+
+static uint64_t bench_fmix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+static uint32_t bench_crc32c_bytewise(const char* first, const char* last)
+{
+    static uint32_t table[256];
+    if (table[1] == 0) {
+        for (unsigned n = 0; n < 256; ++n) {
+            uint32_t crc = n;
+            for (unsigned k = 0; k < 8; ++k)
+                crc = (crc & 1) ? (crc >> 1) ^ 0x82f63b78u : crc >> 1;
+            table[n] = crc;
+        }
+    }
+    uint32_t crc = ~uint32_t(0);
+    for (; first != last; ++first)
+        crc = table[(crc ^ uint8_t(*first)) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+// The XXH32 stripe loop with the four accumulators in a single vector. The
+// tail of the input and the finalization are omitted.
+static uint32_t bench_xxhash32_vector_acc(const char* first, const char* last)
+{
+    using namespace simdpp;
+    uint32<4> acc = make_uint(0x9e3779b1u + 0x85ebca77u, 0x85ebca77u, 0,
+                              0 - 0x9e3779b1u);
+    for (; last - first >= 16; first += 16) {
+        uint32<4> input = load_u(first);
+        acc = add(acc, mul_lo(input, uint32_t(0x85ebca77u)));
+        acc = bit_or(shift_l<13>(acc), shift_r<19>(acc));
+        acc = mul_lo(acc, uint32_t(0x9e3779b1u));
+    }
+    return reduce_add(acc);
+}
+
+static void bench_hash_keys(BenchResults& res)
+{
+    using namespace simdpp;
+
+    const std::size_t count = 4096;
+    std::vector<uint32_t, aligned_allocator<uint32_t, 64>> k32(count), r32(count);
+    std::vector<uint64_t, aligned_allocator<uint64_t, 64>> k64(count), r64(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        k32[i] = uint32_t(i * 2654435761u);
+        k64[i] = uint64_t(i) * 0x9e3779b97f4a7c15ull;
+    }
+
+    res.add("hash_fmix32_scalar", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            r32[i] = bench_fmix32(k32[i]);
+        bench_use(r32);
+    }, count));
+
+    res.add("hash_fmix32_simd", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += bench_hash_uint32::length) {
+            bench_hash_uint32 k = load(k32.data() + i);
+            store(r32.data() + i, murmur3_fmix(k));
+        }
+        bench_use(r32);
+    }, count));
+
+    res.add("hash_fmix64_scalar", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            r64[i] = bench_fmix64(k64[i]);
+        bench_use(r64);
+    }, count));
+
+    res.add("hash_fmix64_simd", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += bench_hash_uint64::length) {
+            bench_hash_uint64 k = load(k64.data() + i);
+            store(r64.data() + i, murmur3_fmix(k));
+        }
+        bench_use(r64);
+    }, count));
+
+    res.add("hash_xxh32_keys_scalar", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            const char* p = reinterpret_cast<const char*>(&k32[i]);
+            r32[i] = xxhash32(p, p + 4);
+        }
+        bench_use(r32);
+    }, count));
+
+    res.add("hash_xxh32_keys_simd", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += bench_hash_uint32::length) {
+            bench_hash_uint32 k = load(k32.data() + i);
+            store(r32.data() + i, xxhash32(k));
+        }
+        bench_use(r32);
+    }, count));
+
+    res.add("hash_xxh64_keys_scalar", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            const char* p = reinterpret_cast<const char*>(&k64[i]);
+            r64[i] = xxhash64(p, p + 8);
+        }
+        bench_use(r64);
+    }, count));
+
+    res.add("hash_xxh64_keys_simd", bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += bench_hash_uint64::length) {
+            bench_hash_uint64 k = load(k64.data() + i);
+            store(r64.data() + i, xxhash64(k));
+        }
+        bench_use(r64);
+    }, count));
+}
+
+static void bench_hash_bulk(BenchResults& res, std::size_t size)
+{
+    using namespace simdpp;
+
+    std::vector<char> data(size);
+    for (std::size_t i = 0; i < size; ++i)
+        data[i] = char(i * 7 + i / 251);
+    const char* first = data.data();
+    const char* last = data.data() + size;
+    std::string prefix = "hash_" + std::to_string(size) + "_";
+
+    res.add(prefix + "xxhash32", bench_ns_per_element([&]()
+    {
+        bench_use(xxhash32(first, last));
+    }, size));
+
+    res.add(prefix + "xxhash32_vector_acc", bench_ns_per_element([&]()
+    {
+        bench_use(bench_xxhash32_vector_acc(first, last));
+    }, size));
+
+    res.add(prefix + "xxhash64", bench_ns_per_element([&]()
+    {
+        bench_use(xxhash64(first, last));
+    }, size));
+
+    res.add(prefix + "crc32c_bytewise", bench_ns_per_element([&]()
+    {
+        bench_use(bench_crc32c_bytewise(first, last));
+    }, size));
+
+    res.add(prefix + "crc32c", bench_ns_per_element([&]()
+    {
+        bench_use(crc32c(first, last));
+    }, size));
+}
+
+void bench_hash(BenchResults& res)
+{
+    bench_hash_keys(res);
+    bench_hash_bulk(res, 64);
+    bench_hash_bulk(res, 1 << 12);
+    bench_hash_bulk(res, 1 << 20);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,99 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Measures the throughput of the loads and stores, including the
+    interleaving load_packedN and store_packedN functions. The packed data is
+    deinterleaved and interleaved again so that the compiler can't elide
+    either operation. The data fits into the L1 cache.
+*/
+
+template<class T>
+using bench_load_store_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class V>
+void bench_load_store_type(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    const std::size_t count = 1 << 12;
+    const std::size_t L = V::length;
+    bench_load_store_vector<T> data(count + 1, T(1));
+    bench_load_store_vector<T> out(count + 1);
+    const T* pdata = data.data();
+    T* pout = out.data();
+
+    res.add("load_store_" + type, bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += L) {
+            V a = load(pdata + i);
+            store(pout + i, a);
+        }
+        bench_use(pout);
+    }, count));
+
+    res.add("load_store_u_" + type, bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += L) {
+            V a = load_u(pdata + i + 1);
+            store_u(pout + i + 1, a);
+        }
+        bench_use(pout);
+    }, count));
+
+    res.add("load_store_packed2_" + type, bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i + 2 * L <= count; i += 2 * L) {
+            V a, b;
+            load_packed2(a, b, pdata + i);
+            store_packed2(pout + i, b, a);
+        }
+        bench_use(pout);
+    }, count));
+
+    res.add("load_store_packed3_" + type, bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i + 3 * L <= count; i += 3 * L) {
+            V a, b, c;
+            load_packed3(a, b, c, pdata + i);
+            store_packed3(pout + i, c, b, a);
+        }
+        bench_use(pout);
+    }, count));
+
+    res.add("load_store_packed4_" + type, bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i + 4 * L <= count; i += 4 * L) {
+            V a, b, c, d;
+            load_packed4(a, b, c, d, pdata + i);
+            store_packed4(pout + i, d, c, b, a);
+        }
+        bench_use(pout);
+    }, count));
+}
+
+void bench_load_store(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_load_store_type<uint8<SIMDPP_FAST_INT8_SIZE>>(res, "u8");
+    bench_load_store_type<uint16<SIMDPP_FAST_INT16_SIZE>>(res, "u16");
+    bench_load_store_type<uint32<SIMDPP_FAST_INT32_SIZE>>(res, "u32");
+    bench_load_store_type<uint64<SIMDPP_FAST_INT64_SIZE>>(res, "u64");
+    bench_load_store_type<float32<SIMDPP_FAST_FLOAT32_SIZE>>(res, "f32");
+    bench_load_store_type<float64<SIMDPP_FAST_FLOAT64_SIZE>>(res, "f64");
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
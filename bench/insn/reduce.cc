@@ -0,0 +1,88 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Measures the horizontal reductions. Each vector is reduced separately, so
+    the results show the cost of a single reduction rather than the cost of
+    summing an array, which is better done by accumulating whole vectors.
+*/
+
+template<class T>
+using bench_reduce_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+#define BENCH_REDUCE(NAME, EXPR)                                            \
+    res.add("reduce_" + type + "_" NAME, bench_ns_per_element([&]()         \
+    {                                                                       \
+        R r = 0;                                                            \
+        for (std::size_t i = 0; i < count; i += V::length) {                \
+            V a = load(pdata + i);                                          \
+            r += R(EXPR);                                                   \
+        }                                                                   \
+        bench_use(r);                                                       \
+    }, count))
+
+template<class V, class R>
+void bench_reduce_type(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    const std::size_t count = 1 << 12;
+    std::mt19937_64 rng(42);
+    bench_reduce_vector<T> data(count);
+    for (auto& v : data)
+        v = T(rng() % 100);
+    const T* pdata = data.data();
+
+    BENCH_REDUCE("add", reduce_add(a));
+    BENCH_REDUCE("min", reduce_min(a));
+    BENCH_REDUCE("max", reduce_max(a));
+}
+
+template<class V, class R>
+void bench_reduce_int_type(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    const std::size_t count = 1 << 12;
+    std::mt19937_64 rng(42);
+    bench_reduce_vector<T> data(count);
+    for (auto& v : data)
+        v = T(rng());
+    const T* pdata = data.data();
+
+    BENCH_REDUCE("or", reduce_or(a));
+    BENCH_REDUCE("popcnt", reduce_popcnt(a));
+}
+
+#undef BENCH_REDUCE
+
+void bench_reduce(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_reduce_type<uint8<SIMDPP_FAST_INT8_SIZE>, uint32_t>(res, "u8");
+    bench_reduce_type<int16<SIMDPP_FAST_INT16_SIZE>, int32_t>(res, "i16");
+    bench_reduce_type<uint32<SIMDPP_FAST_INT32_SIZE>, uint32_t>(res, "u32");
+    bench_reduce_type<float32<SIMDPP_FAST_FLOAT32_SIZE>, float>(res, "f32");
+    bench_reduce_type<float64<SIMDPP_FAST_FLOAT64_SIZE>, double>(res, "f64");
+
+    bench_reduce_int_type<uint8<SIMDPP_FAST_INT8_SIZE>, uint32_t>(res, "u8");
+    bench_reduce_int_type<uint32<SIMDPP_FAST_INT32_SIZE>, uint32_t>(res, "u32");
+    bench_reduce_int_type<uint64<SIMDPP_FAST_INT64_SIZE>, uint64_t>(res, "u64");
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,67 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares inclusive_scan with std::partial_sum. The sizes are chosen so that
+    the data fits into L1 cache and L2 cache respectively.
+*/
+
+template<class T>
+using bench_scan_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class T>
+void bench_scan_type(BenchResults& res, const std::string& name,
+                     std::size_t count)
+{
+    using namespace simdpp;
+
+    std::mt19937_64 rng(42);
+    bench_scan_vector<T> data(count);
+    for (auto& v : data)
+        v = T(rng() % 100);
+    bench_scan_vector<T> out(count);
+    const T* pdata = data.data();
+    T* pout = out.data();
+
+    std::string suffix = "_" + name + "_" + std::to_string(count);
+
+    res.add("scan" + suffix + "_partial_sum", bench_ns_per_element([&]()
+    {
+        std::partial_sum(pdata, pdata + count, pout);
+        bench_use(pout);
+    }, count));
+
+    res.add("scan" + suffix + "_inclusive_scan", bench_ns_per_element([&]()
+    {
+        inclusive_scan(pdata, pdata + count, pout);
+        bench_use(pout);
+    }, count));
+}
+
+void bench_scan(BenchResults& res)
+{
+    const std::size_t sizes[] = { 1 << 10, 1 << 16 };
+    for (std::size_t size : sizes) {
+        bench_scan_type<uint8_t>(res, "u8", size);
+        bench_scan_type<uint16_t>(res, "u16", size);
+        bench_scan_type<uint32_t>(res, "u32", size);
+        bench_scan_type<uint64_t>(res, "u64", size);
+        bench_scan_type<float>(res, "f32", size);
+        bench_scan_type<double>(res, "f64", size);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
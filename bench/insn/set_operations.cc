@@ -0,0 +1,174 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares the set operations with the standard library algorithms and with
+    a scalar galloping intersection on random sorted arrays of unique
+    elements. The density parameter controls how many elements of the two
+    arrays are shared. Each invocation uses the next of several pairs of
+    arrays so that the branch predictor can't learn the outcomes of the
+    comparisons in the scalar algorithms.
+*/
+
+template<class T>
+using bench_set_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class T>
+bench_set_vector<T> bench_set_data(std::mt19937_64& rng, std::size_t count,
+                                   std::size_t range)
+{
+    std::set<T> set;
+    while (set.size() < count)
+        set.insert(T(rng() % range));
+    return bench_set_vector<T>(set.begin(), set.end());
+}
+
+// Scalar intersection that skips over the runs of elements in the other
+// range by exponential search
+template<class T>
+T* bench_set_intersection_galloping(const T* first1, const T* last1,
+                                    const T* first2, const T* last2, T* out)
+{
+    while (first1 != last1 && first2 != last2) {
+        if (*first1 < *first2) {
+            std::swap(first1, first2);
+            std::swap(last1, last2);
+        }
+        // *first2 <= *first1
+        std::size_t step = 1;
+        const T* lo = first2;
+        while (lo + step < last2 && lo[step] < *first1) {
+            lo += step;
+            step *= 2;
+        }
+        first2 = std::lower_bound(lo, std::min(lo + step, last2), *first1);
+        if (first2 != last2 && *first2 == *first1) {
+            *out++ = *first1;
+            ++first2;
+        }
+        ++first1;
+    }
+    return out;
+}
+
+template<class T>
+void bench_set_operations_type(BenchResults& res, const std::string& name,
+                               std::size_t count, std::size_t count2,
+                               std::size_t range)
+{
+    using namespace simdpp;
+
+    std::size_t sets = std::min<std::size_t>(64, std::max<std::size_t>(
+                                                 1, (1 << 21) / count));
+    std::mt19937_64 rng(42);
+    std::vector<bench_set_vector<T>> data;
+    for (std::size_t i = 0; i < 2 * sets; ++i)
+        data.push_back(bench_set_data<T>(rng, i % 2 ? count2 : count, range));
+    bench_set_vector<T> out(count + count2);
+    const T *a0, *a1, *b0, *b1;
+    std::size_t iter = 0;
+    auto next = [&]()
+    {
+        std::size_t set = iter++ % sets;
+        a0 = data[2 * set].data(); a1 = a0 + count;
+        b0 = data[2 * set + 1].data(); b1 = b0 + count2;
+    };
+    std::size_t elements = count + count2;
+    std::string suffix = "_" + name + "_" + std::to_string(count);
+    if (count2 != count)
+        suffix += "x" + std::to_string(count2);
+    suffix += "_range" + std::to_string(range);
+
+    res.add("set_intersection" + suffix + "_std", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(std::set_intersection(a0, a1, b0, b1, out.data()));
+    }, elements));
+
+    res.add("set_intersection" + suffix + "_galloping", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(bench_set_intersection_galloping(a0, a1, b0, b1, out.data()));
+    }, elements));
+
+    res.add("set_intersection" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(set_intersection(a0, a1, b0, b1, out.data()));
+    }, elements));
+
+    res.add("set_intersection_size" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        next();
+        std::size_t r = set_intersection_size(a0, a1, b0, b1);
+        bench_use(r);
+    }, elements));
+
+    res.add("set_union" + suffix + "_std", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(std::set_union(a0, a1, b0, b1, out.data()));
+    }, elements));
+
+    res.add("set_union" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(set_union(a0, a1, b0, b1, out.data()));
+    }, elements));
+
+    res.add("set_difference" + suffix + "_std", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(std::set_difference(a0, a1, b0, b1, out.data()));
+    }, elements));
+
+    res.add("set_difference" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(set_difference(a0, a1, b0, b1, out.data()));
+    }, elements));
+
+    res.add("merge_sorted" + suffix + "_std", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(std::merge(a0, a1, b0, b1, out.data()));
+    }, elements));
+
+    res.add("merge_sorted" + suffix + "_simd", bench_ns_per_element([&]()
+    {
+        next();
+        bench_use(merge_sorted(a0, a1, b0, b1, out.data()));
+    }, elements));
+}
+
+void bench_set_operations(BenchResults& res)
+{
+    const std::size_t sizes[] = { 1 << 10, 1 << 16 };
+    for (std::size_t size : sizes) {
+        // dense: about half of the elements are shared
+        bench_set_operations_type<uint32_t>(res, "u32", size, size, size * 4);
+        bench_set_operations_type<uint64_t>(res, "u64", size, size, size * 4);
+        // sparse: few elements are shared
+        bench_set_operations_type<uint32_t>(res, "u32", size, size, size * 64);
+        bench_set_operations_type<uint64_t>(res, "u64", size, size, size * 64);
+    }
+    // the second range is much shorter
+    bench_set_operations_type<uint32_t>(res, "u32", 1 << 16, 1 << 10, 1 << 18);
+    bench_set_operations_type<uint64_t>(res, "u64", 1 << 16, 1 << 10, 1 << 18);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
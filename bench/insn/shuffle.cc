@@ -0,0 +1,136 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Measures the throughput of the shuffle and permute operations. Each result
+    is the time to load two vectors, shuffle them and store the result divided
+    by the number of elements. The data fits into the L1 cache.
+*/
+
+template<class T>
+using bench_shuffle_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class T>
+bench_shuffle_vector<T> bench_shuffle_data(std::size_t count)
+{
+    std::mt19937_64 rng(42);
+    bench_shuffle_vector<T> data(count);
+    for (auto& v : data)
+        v = T(rng() % 128);
+    return data;
+}
+
+#define BENCH_SHUFFLE(NAME, EXPR)                                           \
+    res.add("shuffle_" + type + "_" NAME, bench_ns_per_element([&]()        \
+    {                                                                       \
+        for (std::size_t i = 0; i < count; i += 2 * V::length) {            \
+            V a = load(pdata + i);                                          \
+            V b = load(pdata + i + V::length);                              \
+            store(pout + i, V(EXPR));                                       \
+            store(pout + i + V::length, V(a));                              \
+        }                                                                   \
+        bench_use(pout);                                                    \
+    }, count))
+
+#define BENCH_SHUFFLE_SETUP                                                 \
+    using T = typename V::element_type;                                     \
+    const std::size_t count = 1 << 12;                                      \
+    auto data = bench_shuffle_data<T>(count);                               \
+    bench_shuffle_vector<T> out(count);                                     \
+    const T* pdata = data.data();                                           \
+    T* pout = out.data()
+
+template<class V>
+void bench_shuffle_8(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    BENCH_SHUFFLE_SETUP;
+
+    BENCH_SHUFFLE("copy", b);
+    BENCH_SHUFFLE("splat", splat<1>(b));
+    BENCH_SHUFFLE("zip_lo", zip16_lo(a, b));
+    BENCH_SHUFFLE("unzip_lo", unzip16_lo(a, b));
+    BENCH_SHUFFLE("align", align16<3>(a, b));
+    BENCH_SHUFFLE("move_l", move16_l<3>(b));
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON
+    V mask;
+    mask = make_shuffle_bytes16_mask<15,14,13,12,11,10,9,8,
+                                     7,6,5,4,3,2,1,0>(mask);
+    BENCH_SHUFFLE("permute_bytes16", permute_bytes16(b, mask));
+#endif
+}
+
+template<class V>
+void bench_shuffle_16(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    BENCH_SHUFFLE_SETUP;
+
+    BENCH_SHUFFLE("copy", b);
+    BENCH_SHUFFLE("splat", splat<1>(b));
+    BENCH_SHUFFLE("zip_lo", zip8_lo(a, b));
+    BENCH_SHUFFLE("unzip_lo", unzip8_lo(a, b));
+    BENCH_SHUFFLE("align", align8<3>(a, b));
+    BENCH_SHUFFLE("move_l", move8_l<3>(b));
+    BENCH_SHUFFLE("permute4", (permute4<3,2,1,0>(b)));
+}
+
+template<class V>
+void bench_shuffle_32(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    BENCH_SHUFFLE_SETUP;
+
+    BENCH_SHUFFLE("copy", b);
+    BENCH_SHUFFLE("splat", splat<1>(b));
+    BENCH_SHUFFLE("zip_lo", zip4_lo(a, b));
+    BENCH_SHUFFLE("unzip_lo", unzip4_lo(a, b));
+    BENCH_SHUFFLE("align", align4<1>(a, b));
+    BENCH_SHUFFLE("move_l", move4_l<1>(b));
+    BENCH_SHUFFLE("permute4", (permute4<3,2,1,0>(b)));
+    BENCH_SHUFFLE("shuffle4x2", (shuffle4x2<0,5,2,7>(a, b)));
+}
+
+template<class V>
+void bench_shuffle_64(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    BENCH_SHUFFLE_SETUP;
+
+    BENCH_SHUFFLE("copy", b);
+    BENCH_SHUFFLE("splat", splat<1>(b));
+    BENCH_SHUFFLE("zip_lo", zip2_lo(a, b));
+    BENCH_SHUFFLE("unzip_lo", unzip2_lo(a, b));
+    BENCH_SHUFFLE("align", align2<1>(a, b));
+    BENCH_SHUFFLE("move_l", move2_l<1>(b));
+    BENCH_SHUFFLE("permute2", (permute2<1,0>(b)));
+}
+
+#undef BENCH_SHUFFLE_SETUP
+#undef BENCH_SHUFFLE
+
+void bench_shuffle(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_shuffle_8<uint8<SIMDPP_FAST_INT8_SIZE>>(res, "u8");
+    bench_shuffle_16<uint16<SIMDPP_FAST_INT16_SIZE>>(res, "u16");
+    bench_shuffle_32<uint32<SIMDPP_FAST_INT32_SIZE>>(res, "u32");
+    bench_shuffle_32<float32<SIMDPP_FAST_FLOAT32_SIZE>>(res, "f32");
+    bench_shuffle_64<uint64<SIMDPP_FAST_INT64_SIZE>>(res, "u64");
+    bench_shuffle_64<float64<SIMDPP_FAST_FLOAT64_SIZE>>(res, "f64");
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,124 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares sort and sort_by_key with std::sort on random data. Each
+    iteration sorts a fresh copy of one of several sets of unsorted data, thus
+    the results include the time to copy the data. Several sets are used, as
+    otherwise the branch predictor learns the branches of std::sort on small
+    arrays and the results don't reflect sorting of unseen data.
+*/
+
+template<class T>
+using bench_sort_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class T>
+std::vector<bench_sort_vector<T>> bench_sort_data(std::size_t count)
+{
+    std::size_t sets = std::min<std::size_t>(64, std::max<std::size_t>(
+                                                 1, (1 << 22) / count));
+    std::mt19937_64 rng(42);
+    std::vector<bench_sort_vector<T>> data(sets, bench_sort_vector<T>(count));
+    for (auto& set : data) {
+        for (auto& v : set)
+            v = T(rng() % (count * 4));
+    }
+    return data;
+}
+
+template<class T>
+void bench_sort_type(BenchResults& res, const std::string& name,
+                     std::size_t count)
+{
+    using namespace simdpp;
+
+    std::vector<bench_sort_vector<T>> data = bench_sort_data<T>(count);
+    bench_sort_vector<T> work(count);
+    std::size_t iter = 0;
+    std::string suffix = "_" + name + "_" + std::to_string(count);
+
+    res.add("sort" + suffix + "_std_sort", bench_ns_per_element([&]()
+    {
+        const bench_sort_vector<T>& src = data[iter++ % data.size()];
+        std::copy(src.begin(), src.end(), work.begin());
+        std::sort(work.begin(), work.end());
+        bench_use(work.data());
+    }, count));
+
+    res.add("sort" + suffix + "_sort", bench_ns_per_element([&]()
+    {
+        const bench_sort_vector<T>& src = data[iter++ % data.size()];
+        std::copy(src.begin(), src.end(), work.begin());
+        simdpp::sort(work.data(), work.data() + count);
+        bench_use(work.data());
+    }, count));
+}
+
+template<class K>
+void bench_sort_by_key_type(BenchResults& res, const std::string& name,
+                            std::size_t count)
+{
+    using namespace simdpp;
+    using pair = std::pair<K, uint32_t>;
+
+    std::vector<bench_sort_vector<K>> keys = bench_sort_data<K>(count);
+    bench_sort_vector<K> work_keys(count);
+    bench_sort_vector<uint32_t> work_values(count);
+    std::vector<pair> work_pairs(count);
+    std::size_t iter = 0;
+    std::string suffix = "_" + name + "_" + std::to_string(count);
+
+    res.add("sort_by_key" + suffix + "_std_sort", bench_ns_per_element([&]()
+    {
+        const bench_sort_vector<K>& src = keys[iter++ % keys.size()];
+        for (std::size_t i = 0; i < count; ++i)
+            work_pairs[i] = pair(src[i], uint32_t(i));
+        std::sort(work_pairs.begin(), work_pairs.end(),
+                  [](const pair& a, const pair& b) { return a.first < b.first; });
+        bench_use(work_pairs.data());
+    }, count));
+
+    res.add("sort_by_key" + suffix + "_sort_by_key", bench_ns_per_element([&]()
+    {
+        const bench_sort_vector<K>& src = keys[iter++ % keys.size()];
+        for (std::size_t i = 0; i < count; ++i) {
+            work_keys[i] = src[i];
+            work_values[i] = uint32_t(i);
+        }
+        sort_by_key(work_keys.data(), work_keys.data() + count,
+                    work_values.data());
+        bench_use(work_keys.data());
+        bench_use(work_values.data());
+    }, count));
+}
+
+void bench_sort(BenchResults& res)
+{
+    const std::size_t sizes[] = { 1 << 10, 1 << 16, 1 << 20 };
+    for (std::size_t size : sizes) {
+        bench_sort_type<int32_t>(res, "i32", size);
+        bench_sort_type<uint32_t>(res, "u32", size);
+        bench_sort_type<float>(res, "f32", size);
+        bench_sort_type<int64_t>(res, "i64", size);
+        bench_sort_type<uint64_t>(res, "u64", size);
+        bench_sort_type<double>(res, "f64", size);
+
+        bench_sort_by_key_type<uint32_t>(res, "u32", size);
+        bench_sort_by_key_type<float>(res, "f32", size);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
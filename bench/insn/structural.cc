@@ -0,0 +1,118 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares json_structural_index() and csv_structural_index() with loops
+    that examine one byte at a time, as in a typical hand-written tokenizer.
+    The results are in nanoseconds per input byte.
+*/
+
+static uint32_t* bench_json_index_scalar(const std::string& s, uint32_t* out)
+{
+    bool in_string = false, escaped = false, follows_scalar = false;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        char c = s[i];
+        if (in_string) {
+            if (c == '"' && !escaped)
+                in_string = false;
+            escaped = c == '\\' && !escaped;
+            follows_scalar = false;
+            continue;
+        }
+        switch (c) {
+        case '{': case '}': case '[': case ']': case ':': case ',':
+            *out++ = uint32_t(i);
+            follows_scalar = false;
+            break;
+        case ' ': case '\t': case '\n': case '\r':
+            follows_scalar = false;
+            break;
+        case '"':
+            *out++ = uint32_t(i);
+            in_string = true;
+            follows_scalar = false;
+            break;
+        default:
+            if (!follows_scalar)
+                *out++ = uint32_t(i);
+            follows_scalar = true;
+        }
+    }
+    return out;
+}
+
+static uint32_t* bench_csv_index_scalar(const std::string& s, uint32_t* out)
+{
+    bool in_quotes = false;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        char c = s[i];
+        if (c == '"')
+            in_quotes = !in_quotes;
+        else if (!in_quotes && (c == ',' || c == '\n'))
+            *out++ = uint32_t(i);
+    }
+    return out;
+}
+
+static void bench_structural_size(BenchResults& res, std::size_t size)
+{
+    using namespace simdpp;
+
+    std::string json = "[";
+    for (unsigned i = 0; json.size() < size; ++i) {
+        json += "{\"id\": " + std::to_string(i * 7919) +
+                ", \"name\": \"item \\\"" + std::to_string(i) +
+                "\\\"\", \"tags\": [\"a\", \"b\"], \"ok\": true},\n";
+    }
+    json.resize(size);
+
+    std::string csv;
+    for (unsigned i = 0; csv.size() < size; ++i) {
+        csv += std::to_string(i * 7919) + ",item " + std::to_string(i) +
+               ",\"quoted, \"\"text\"\"\"," + std::to_string(i % 17) + "\n";
+    }
+    csv.resize(size);
+
+    std::vector<uint32_t> out(size + 3);
+    std::string prefix = "structural_" + std::to_string(size) + "_";
+
+    res.add(prefix + "json_scalar", bench_ns_per_element([&]()
+    {
+        bench_use(bench_json_index_scalar(json, out.data()));
+    }, size));
+
+    res.add(prefix + "json_simd", bench_ns_per_element([&]()
+    {
+        bench_use(json_structural_index(json.data(), json.data() + size, out.data()));
+    }, size));
+
+    res.add(prefix + "csv_scalar", bench_ns_per_element([&]()
+    {
+        bench_use(bench_csv_index_scalar(csv, out.data()));
+    }, size));
+
+    res.add(prefix + "csv_simd", bench_ns_per_element([&]()
+    {
+        bench_use(csv_structural_index(csv.data(), csv.data() + size, out.data()));
+    }, size));
+}
+
+void bench_structural(BenchResults& res)
+{
+    bench_structural_size(res, 100);
+    bench_structural_size(res, 1 << 12);
+    bench_structural_size(res, 1 << 20);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
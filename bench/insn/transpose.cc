@@ -0,0 +1,92 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Measures the throughput of transpose2 and transpose4 applied to
+    consecutive groups of vectors in the L1 cache. The results are per element
+    of the transposed vectors.
+*/
+
+template<class T>
+using bench_transpose_vector = std::vector<T, simdpp::aligned_allocator<T, 64>>;
+
+template<class V>
+void bench_transpose2_type(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    const std::size_t count = 1 << 12;
+    const std::size_t L = V::length;
+    bench_transpose_vector<T> data(count, T(1));
+    T* pdata = data.data();
+
+    res.add("transpose2_" + type, bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += 2 * L) {
+            V a0 = load(pdata + i);
+            V a1 = load(pdata + i + L);
+            transpose2(a0, a1);
+            store(pdata + i, a0);
+            store(pdata + i + L, a1);
+        }
+        bench_use(pdata);
+    }, count));
+}
+
+template<class V>
+void bench_transpose4_type(BenchResults& res, const std::string& type)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+
+    const std::size_t count = 1 << 12;
+    const std::size_t L = V::length;
+    bench_transpose_vector<T> data(count, T(1));
+    T* pdata = data.data();
+
+    res.add("transpose4_" + type, bench_ns_per_element([&]()
+    {
+        for (std::size_t i = 0; i < count; i += 4 * L) {
+            V a0 = load(pdata + i);
+            V a1 = load(pdata + i + L);
+            V a2 = load(pdata + i + 2 * L);
+            V a3 = load(pdata + i + 3 * L);
+            transpose4(a0, a1, a2, a3);
+            store(pdata + i, a0);
+            store(pdata + i + L, a1);
+            store(pdata + i + 2 * L, a2);
+            store(pdata + i + 3 * L, a3);
+        }
+        bench_use(pdata);
+    }, count));
+}
+
+void bench_transpose(BenchResults& res)
+{
+    using namespace simdpp;
+
+    bench_transpose2_type<uint16<SIMDPP_FAST_INT16_SIZE>>(res, "u16");
+    bench_transpose2_type<uint32<SIMDPP_FAST_INT32_SIZE>>(res, "u32");
+    bench_transpose2_type<uint64<SIMDPP_FAST_INT64_SIZE>>(res, "u64");
+    bench_transpose2_type<float32<SIMDPP_FAST_FLOAT32_SIZE>>(res, "f32");
+    bench_transpose2_type<float64<SIMDPP_FAST_FLOAT64_SIZE>>(res, "f64");
+
+    bench_transpose4_type<uint8<SIMDPP_FAST_INT8_SIZE>>(res, "u8");
+    bench_transpose4_type<uint16<SIMDPP_FAST_INT16_SIZE>>(res, "u16");
+    bench_transpose4_type<uint32<SIMDPP_FAST_INT32_SIZE>>(res, "u32");
+    bench_transpose4_type<float32<SIMDPP_FAST_FLOAT32_SIZE>>(res, "f32");
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
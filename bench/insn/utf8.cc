@@ -0,0 +1,152 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "benches.h"
+#include <simdpp/simd.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/*  Compares the UTF-8 validation and transcoding functions with scalar loops
+    decoding one character at a time. The text is generated from random
+    characters of the given ranges with the given share of ASCII characters.
+*/
+
+struct bench_utf8_text {
+    std::string utf8;
+    std::u16string utf16;
+    std::u32string utf32;
+};
+
+static bench_utf8_text bench_utf8_make_text(std::size_t count, uint32_t first,
+                                            uint32_t last, unsigned ascii_percent)
+{
+    std::mt19937 rng(42);
+    bench_utf8_text text;
+    while (text.utf8.size() < count) {
+        uint32_t cp = rng() % 100 < ascii_percent ? 0x20 + rng() % 0x5f
+                                                  : first + rng() % (last - first);
+        if (cp >= 0xd800 && cp < 0xe000)
+            continue;
+        char buf[4];
+        char* end = simdpp::SIMDPP_ARCH_NAMESPACE::detail::utf_encode_char(cp, buf);
+        text.utf8.append(buf, end);
+        char16_t buf16[2];
+        char16_t* end16 = simdpp::SIMDPP_ARCH_NAMESPACE::detail::utf_encode_char(cp, buf16);
+        text.utf16.append(buf16, end16);
+        text.utf32.push_back(char32_t(cp));
+    }
+    return text;
+}
+
+// Scalar decoder of the kind commonly used in text processing code
+static bool bench_utf8_decode_scalar(const unsigned char* p, const unsigned char* last,
+                                     char32_t* out)
+{
+    while (p != last) {
+        uint32_t c = *p;
+        if (c < 0x80) {
+            *out++ = c;
+            p++;
+            continue;
+        }
+        unsigned len = c >= 0xf0 ? 4 : c >= 0xe0 ? 3 : c >= 0xc0 ? 2 : 0;
+        if (len == 0 || unsigned(last - p) < len)
+            return false;
+        uint32_t cp = c & (0x7f >> len);
+        for (unsigned i = 1; i < len; ++i) {
+            if ((p[i] & 0xc0) != 0x80)
+                return false;
+            cp = (cp << 6) | (p[i] & 0x3f);
+        }
+        static const uint32_t min[] = { 0, 0, 0x80, 0x800, 0x10000 };
+        if (cp < min[len] || cp > 0x10ffff || (cp >= 0xd800 && cp < 0xe000))
+            return false;
+        *out++ = cp;
+        p += len;
+    }
+    return true;
+}
+
+static void bench_utf8_text_type(BenchResults& res, const std::string& name,
+                                 const bench_utf8_text& text)
+{
+    using namespace simdpp;
+
+    const char* first = text.utf8.data();
+    const char* last = first + text.utf8.size();
+    std::size_t count = text.utf8.size();
+    std::vector<char32_t> out32(count);
+    std::vector<char16_t> out16(count);
+    std::vector<char> out8(4 * text.utf32.size());
+    std::string prefix = "utf8_" + name + "_" + std::to_string(count) + "_";
+
+    res.add(prefix + "validate_scalar", bench_ns_per_element([&]()
+    {
+        bool r = bench_utf8_decode_scalar(reinterpret_cast<const unsigned char*>(first),
+                                          reinterpret_cast<const unsigned char*>(last),
+                                          out32.data());
+        bench_use(r);
+    }, count));
+
+    res.add(prefix + "validate_simd", bench_ns_per_element([&]()
+    {
+        bool r = utf8_validate(first, last);
+        bench_use(r);
+    }, count));
+
+    res.add(prefix + "to_utf16_simd", bench_ns_per_element([&]()
+    {
+        bench_use(utf8_to_utf16(first, last, out16.data()));
+    }, count));
+
+    res.add(prefix + "to_utf32_simd", bench_ns_per_element([&]()
+    {
+        bench_use(utf8_to_utf32(first, last, out32.data()));
+    }, count));
+
+    res.add(prefix + "from_utf16_scalar", bench_ns_per_element([&]()
+    {
+        char* out = out8.data();
+        const char16_t* p = text.utf16.data();
+        const char16_t* end = p + text.utf16.size();
+        while (p != end) {
+            uint32_t cp = 0;
+            p += simdpp::SIMDPP_ARCH_NAMESPACE::detail::utf16_decode_char(p, end, cp);
+            out = simdpp::SIMDPP_ARCH_NAMESPACE::detail::utf_encode_char(cp, out);
+        }
+        bench_use(out);
+    }, count));
+
+    res.add(prefix + "from_utf16_simd", bench_ns_per_element([&]()
+    {
+        bench_use(utf16_to_utf8(text.utf16.data(),
+                                text.utf16.data() + text.utf16.size(),
+                                out8.data()));
+    }, count));
+
+    res.add(prefix + "from_utf32_simd", bench_ns_per_element([&]()
+    {
+        bench_use(utf32_to_utf8(text.utf32.data(),
+                                text.utf32.data() + text.utf32.size(),
+                                out8.data()));
+    }, count));
+}
+
+void bench_utf8(BenchResults& res)
+{
+    const std::size_t count = 1 << 16;
+    bench_utf8_text_type(res, "ascii", bench_utf8_make_text(count, 0x20, 0x7f, 100));
+    bench_utf8_text_type(res, "latin", bench_utf8_make_text(count, 0xa0, 0x250, 70));
+    bench_utf8_text_type(res, "cjk", bench_utf8_make_text(count, 0x4e00, 0x9fff, 10));
+    bench_utf8_text_type(res, "emoji", bench_utf8_make_text(count, 0x1f300, 0x1f650, 80));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
@@ -0,0 +1,115 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "utils/bench_results.h"
+#include "utils/bench_timer.h"
+#include "insn/benches.h"
+#include <simdpp/simd.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#include <simdpp/dispatch/get_arch_string_list.h>
+
+simdpp::Arch get_arch_from_system()
+{
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+    return simdpp::get_arch_raw_cpuid();
+#elif SIMDPP_HAS_GET_ARCH_LINUX_CPUINFO
+    return simdpp::get_arch_linux_cpuinfo();
+#else
+    std::cerr << "No architecture information could be retrieved. Only the "
+              << "NULL architecture will be benchmarked\n";
+    return simdpp::Arch::NONE_NULL;
+#endif
+}
+
+bool has_arg(int argc, char* argv[], const char* arg)
+{
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], arg) == 0)
+            return true;
+    }
+    return false;
+}
+
+/*  Returns the value of the argument of the form <name>=<value> or an empty
+    string if the argument has not been passed.
+*/
+std::string get_arg_value(int argc, char* argv[], const char* name)
+{
+    std::size_t len = std::strlen(name);
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], name, len) == 0 && argv[i][len] == '=')
+            return argv[i] + len + 1;
+    }
+    return "";
+}
+
+void invoke_bench_function(const simdpp::detail::FnVersion& fn,
+                           BenchResults& res)
+{
+    reinterpret_cast<void(*)(BenchResults&)>(fn.fun_ptr)(res);
+}
+
+/*  Runs the benchmarks for each instruction set that the library has been
+    compiled for and that the current processor supports. The set of
+    instruction sets can be limited by passing --force_arch followed by a list
+    of --arch_<name> arguments, as in the tests.
+
+    The results are printed in human readable form by default. Pass
+    --format=csv or --format=json to produce output that is suitable for
+    tracking the performance across library versions.
+*/
+int main(int argc, char* argv[])
+{
+    simdpp::Arch current_arch;
+    if (has_arg(argc, argv, "--force_arch"))
+        current_arch = simdpp::get_arch_string_list(argv + 1, argc - 1, "--arch_");
+    else
+        current_arch = get_arch_from_system();
+
+    std::string format = get_arg_value(argc, argv, "--format");
+    if (format.empty())
+        format = "text";
+    if (format != "text" && format != "csv" && format != "json") {
+        std::cerr << "Unknown output format: " << format << "\n";
+        return EXIT_FAILURE;
+    }
+
+    double cycles_per_ns = bench_cycles_per_ns();
+    const auto& arch_list = get_bench_archs();
+    std::vector<BenchResults> all_results;
+
+    for (auto it = arch_list.begin(); it != arch_list.end(); it++) {
+        if (it->fun_ptr == NULL) {
+            continue;
+        }
+        if (!simdpp::test_arch_subset(current_arch, it->needed_arch)) {
+            std::cerr << "Not benchmarking: " << it->arch_name << std::endl;
+            continue;
+        }
+        std::cerr << "Benchmarking: " << it->arch_name << std::endl;
+
+        BenchResults results(it->arch_name);
+        invoke_bench_function(*it, results);
+        if (format == "text")
+            print_bench_results(std::cout, results, cycles_per_ns);
+        else
+            all_results.push_back(results);
+    }
+
+    if (format == "csv")
+        print_bench_results_csv(std::cout, all_results, cycles_per_ns);
+    else if (format == "json")
+        print_bench_results_json(std::cout, all_results, cycles_per_ns);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_RESULTS_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_RESULTS_H
+
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/** Represents all benchmark results for a particular architecture
+*/
+class BenchResults {
+public:
+    struct Result {
+        std::string name;
+        double ns_per_element;
+    };
+
+    BenchResults(const char* arch) :
+        arch_{arch}
+    {
+    }
+
+    void add(const std::string& name, double ns_per_element)
+    {
+        results_.push_back(Result{name, ns_per_element});
+    }
+
+    const char* arch() const { return arch_; }
+    const std::vector<Result>& results() const { return results_; }
+
+private:
+    const char* arch_;
+    std::vector<Result> results_;
+};
+
+/*  Prints the results in human readable form, one result per line. The
+    results are additionally expressed in cycles per element if
+    @a cycles_per_ns is not zero.
+*/
+inline void print_bench_results(std::ostream& out, const BenchResults& res,
+                                double cycles_per_ns)
+{
+    for (const auto& r : res.results()) {
+        out << std::left << std::setw(36) << res.arch() << " "
+            << std::setw(40) << r.name << " "
+            << std::right << std::fixed << std::setprecision(3)
+            << std::setw(10) << r.ns_per_element << " ns/element";
+        if (cycles_per_ns != 0) {
+            out << std::setw(10) << r.ns_per_element * cycles_per_ns
+                << " cycles/element";
+        }
+        out << "\n";
+    }
+}
+
+/*  Prints the results as CSV with a header line. The cycles column is empty
+    if @a cycles_per_ns is zero.
+*/
+inline void print_bench_results_csv(std::ostream& out,
+                                    const std::vector<BenchResults>& all,
+                                    double cycles_per_ns)
+{
+    out << "arch,name,ns_per_element,cycles_per_element\n";
+    out << std::fixed << std::setprecision(4);
+    for (const auto& res : all) {
+        for (const auto& r : res.results()) {
+            out << res.arch() << "," << r.name << "," << r.ns_per_element << ",";
+            if (cycles_per_ns != 0)
+                out << r.ns_per_element * cycles_per_ns;
+            out << "\n";
+        }
+    }
+}
+
+inline void print_bench_json_string(std::ostream& out, const std::string& s)
+{
+    out << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+/*  Prints the results as a JSON object. The cycles_per_element members are
+    null if @a cycles_per_ns is zero.
+*/
+inline void print_bench_results_json(std::ostream& out,
+                                     const std::vector<BenchResults>& all,
+                                     double cycles_per_ns)
+{
+    out << std::fixed << std::setprecision(4);
+    out << "{\n  \"cycles_per_ns\": " << cycles_per_ns << ",\n"
+        << "  \"results\": [";
+    bool first = true;
+    for (const auto& res : all) {
+        for (const auto& r : res.results()) {
+            out << (first ? "\n" : ",\n") << "    { \"arch\": ";
+            print_bench_json_string(out, res.arch());
+            out << ", \"name\": ";
+            print_bench_json_string(out, r.name);
+            out << ", \"ns_per_element\": " << r.ns_per_element
+                << ", \"cycles_per_element\": ";
+            if (cycles_per_ns != 0)
+                out << r.ns_per_element * cycles_per_ns;
+            else
+                out << "null";
+            out << " }";
+            first = false;
+        }
+    }
+    out << "\n  ]\n}\n";
+}
+
+#endif
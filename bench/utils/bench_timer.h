@@ -0,0 +1,107 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_BENCH_UTILS_BENCH_TIMER_H
+#define LIBSIMDPP_BENCH_UTILS_BENCH_TIMER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+
+#if _MSC_VER
+#include <intrin.h>
+#elif __i386__ || __x86_64__
+#include <x86intrin.h>
+#endif
+
+/*  Prevents the compiler from optimizing out the computation of @a v.
+*/
+template<class T>
+inline void bench_use(const T& v)
+{
+#if _MSC_VER
+    static const T* volatile sink;
+    sink = &v;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r"(&v) : "memory");
+#endif
+}
+
+/*  Runs @a fun repeatedly and returns the time per processed element in
+    nanoseconds. Each invocation of @a fun must process @a elements elements.
+    The number of invocations is chosen so that each measurement takes at
+    least several milliseconds. The best of several measurements is returned
+    to reduce the influence of noise.
+*/
+template<class F>
+double bench_ns_per_element(const F& fun, std::size_t elements)
+{
+    using clock = std::chrono::steady_clock;
+    const auto min_duration = std::chrono::milliseconds(10);
+    const unsigned repeats = 5;
+
+    fun(); // warm up caches
+
+    std::size_t calls = 1;
+    for (;;) {
+        auto start = clock::now();
+        for (std::size_t i = 0; i < calls; ++i)
+            fun();
+        if (clock::now() - start >= min_duration)
+            break;
+        calls *= 2;
+    }
+
+    double best = 0;
+    for (unsigned r = 0; r < repeats; ++r) {
+        auto start = clock::now();
+        for (std::size_t i = 0; i < calls; ++i)
+            fun();
+        std::chrono::duration<double, std::nano> d = clock::now() - start;
+        double ns = d.count() / (double(calls) * elements);
+        best = r == 0 ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+/*  Measures the frequency of the time stamp counter. Returns zero if the
+    counter is not available on the current architecture.
+*/
+inline double bench_measure_cycles_per_ns()
+{
+#if _M_IX86 || _M_X64 || __i386__ || __x86_64__
+    using clock = std::chrono::steady_clock;
+    const auto duration = std::chrono::milliseconds(50);
+
+    auto start = clock::now();
+    unsigned long long start_tsc = __rdtsc();
+    auto now = start;
+    while (now - start < duration)
+        now = clock::now();
+    unsigned long long end_tsc = __rdtsc();
+
+    std::chrono::duration<double, std::nano> d = now - start;
+    return double(end_tsc - start_tsc) / d.count();
+#else
+    return 0;
+#endif
+}
+
+/*  Returns the number of time stamp counter cycles per nanosecond, which is
+    used to express the results in cycles per element. Zero means that the
+    results can't be expressed in cycles. Note that on most current x86
+    processors the counter runs at the nominal frequency, thus the results
+    are in actual core cycles only if frequency scaling is disabled.
+*/
+inline double bench_cycles_per_ns()
+{
+    static const double ratio = bench_measure_cycles_per_ns();
+    return ratio;
+}
+
+#endif
@@ -228,6 +228,44 @@ set(SIMDPP_X86_SSE4_1_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_SSE4_2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_SSE4_2_CXX_FLAGS "-msse4.2")
+elseif(SIMDPP_MSVC)
+    set(SIMDPP_X86_SSE4_2_CXX_FLAGS "/arch:SSE2")
+elseif(SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_SSE4_2_CXX_FLAGS "/arch:SSE4.2")
+endif()
+set(SIMDPP_X86_SSE4_2_DEFINE "SIMDPP_ARCH_X86_SSE4_2")
+set(SIMDPP_X86_SSE4_2_SUFFIX "-x86_sse4_2")
+set(SIMDPP_X86_SSE4_2_TEST_CODE
+    "#include <nmmintrin.h>
+    #include <iostream>
+
+    unsigned* prevent_optimization(unsigned* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        unsigned* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        unsigned data;
+        unsigned* p = &data;
+        p = prevent_optimization(p);
+
+        *p = _mm_crc32_u32(*p, *p);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "X86_POPCNT_INSN")
 if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
     set(SIMDPP_X86_POPCNT_INSN_CXX_FLAGS "-mssse3 -mpopcnt")
@@ -315,6 +353,51 @@ set(SIMDPP_X86_AVX_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_F16C")
+if(SIMDPP_CLANG OR SIMDPP_GCC)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "-mavx -mf16c")
+elseif(SIMDPP_INTEL)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "-xCORE-AVX-I")
+elseif(SIMDPP_MSVC)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "/arch:AVX")
+elseif(SIMDPP_MSVC_INTEL)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "/arch:CORE-AVX-I")
+endif()
+set(SIMDPP_X86_F16C_DEFINE "SIMDPP_ARCH_X86_F16C")
+set(SIMDPP_X86_F16C_SUFFIX "-x86_f16c")
+set(SIMDPP_X86_F16C_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[32];
+            __m256 align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i half = _mm_loadu_si128((__m128i*)p);
+        __m256 one = _mm256_cvtph_ps(half);
+        _mm256_store_ps((float*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "X86_AVX2")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_X86_AVX2_CXX_FLAGS "-mavx2")
@@ -639,6 +722,285 @@ set(SIMDPP_X86_AVX512DQ_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VL")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VL_CXX_FLAGS "-mavx512vl")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VL_DEFINE "SIMDPP_ARCH_X86_AVX512VL")
+set(SIMDPP_X86_AVX512VL_SUFFIX "-x86_avx512vl")
+set(SIMDPP_X86_AVX512VL_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[32];
+            __m256i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m256i i = _mm256_load_si256((__m256i*)p);
+        i = _mm256_ror_epi32(i, 3); // only in AVX-512VL
+        _mm256_store_si256((__m256i*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512CD")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512CD_CXX_FLAGS "-mavx512cd")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512CD_DEFINE "SIMDPP_ARCH_X86_AVX512CD")
+set(SIMDPP_X86_AVX512CD_SUFFIX "-x86_avx512cd")
+set(SIMDPP_X86_AVX512CD_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_lzcnt_epi32(i); // only in AVX-512CD
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI_CXX_FLAGS "-mavx512vbmi")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VBMI_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI")
+set(SIMDPP_X86_AVX512VBMI_SUFFIX "-x86_avx512vbmi")
+set(SIMDPP_X86_AVX512VBMI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_permutexvar_epi8(i, i); // only in AVX-512VBMI
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VPOPCNTDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VPOPCNTDQ_CXX_FLAGS "-mavx512vpopcntdq")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VPOPCNTDQ_DEFINE "SIMDPP_ARCH_X86_AVX512VPOPCNTDQ")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_SUFFIX "-x86_avx512vpopcntdq")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_popcnt_epi64(i); // only in AVX-512VPOPCNTDQ
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VNNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VNNI_CXX_FLAGS "-mavx512vnni")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VNNI_DEFINE "SIMDPP_ARCH_X86_AVX512VNNI")
+set(SIMDPP_X86_AVX512VNNI_SUFFIX "-x86_avx512vnni")
+set(SIMDPP_X86_AVX512VNNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i i = _mm512_load_si512((void*)p);
+        i = _mm512_dpbusd_epi32(i, i, i); // only in AVX-512VNNI
+        _mm512_store_si512((void*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_GFNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_GFNI_CXX_FLAGS "-mgfni")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_GFNI_DEFINE "SIMDPP_ARCH_X86_GFNI")
+set(SIMDPP_X86_GFNI_SUFFIX "-x86_gfni")
+set(SIMDPP_X86_GFNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i i = _mm_load_si128((__m128i*)p);
+        i = _mm_gf2p8mul_epi8(i, i); // only in GFNI
+        _mm_store_si128((__m128i*)p, i);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_BMI2_CXX_FLAGS "-mbmi2")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_BMI2_DEFINE "SIMDPP_ARCH_X86_BMI2")
+set(SIMDPP_X86_BMI2_SUFFIX "-x86_bmi2")
+set(SIMDPP_X86_BMI2_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            unsigned align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        unsigned* u = (unsigned*)p;
+        u[0] = _pdep_u32(u[0], u[1]); // only in BMI2
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "ARM_NEON")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_ARM_NEON_CXX_FLAGS "-mfpu=neon")
@@ -735,6 +1097,86 @@ set(SIMDPP_ARM64_NEON_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "ARM64_NEON_DOTPROD")
+if(SIMDPP_CLANG OR SIMDPP_GCC)
+    set(SIMDPP_ARM64_NEON_DOTPROD_CXX_FLAGS "-march=armv8.2-a+dotprod")
+endif()
+set(SIMDPP_ARM64_NEON_DOTPROD_DEFINE "SIMDPP_ARCH_ARM_NEON_DOTPROD")
+set(SIMDPP_ARM64_NEON_DOTPROD_SUFFIX "-arm64_neon_dotprod")
+set(SIMDPP_ARM64_NEON_DOTPROD_TEST_CODE
+    "#include <arm_neon.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            uint32x4_t align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        uint32x4_t one = vld1q_u32((uint32_t*)p);
+        uint8x16_t b = vreinterpretq_u8_u32(one);
+        one = vdotq_u32(one, b, b); // only with the dot product extension
+        vst1q_u32((uint32_t*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "ARM64_SVE")
+if(SIMDPP_CLANG OR SIMDPP_GCC)
+    set(SIMDPP_ARM64_SVE_CXX_FLAGS "-march=armv8.2-a+sve")
+endif()
+set(SIMDPP_ARM64_SVE_DEFINE "SIMDPP_ARCH_ARM_SVE")
+set(SIMDPP_ARM64_SVE_SUFFIX "-arm64_sve")
+set(SIMDPP_ARM64_SVE_TEST_CODE
+    "#include <arm_sve.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            uint32_t align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        svbool_t pg = svptrue_b32();
+        svuint32_t one = svld1_u32(pg, (uint32_t*)p);
+        one = svadd_u32_x(pg, one, one);
+        svst1_u32(svwhilelt_b32(0, 4), (uint32_t*)p, one);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "MIPS_MSA")
 set(SIMDPP_MIPS_MSA_CXX_FLAGS "-mips64r5 -mmsa -mhard-float -mfp64 -mnan=legacy")
 set(SIMDPP_MIPS_MSA_DEFINE "SIMDPP_ARCH_MIPS_MSA")
@@ -988,10 +1430,12 @@ endfunction()
 #   identifiers is supplied.
 #
 #   The following identifiers are currently supported:
-#   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1,
+#   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1, X86_SSE4_2,
 #   X86_AVX, X86_AVX2, X86_FMA3, X86_FMA4,
-#   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_XOP,
-#   ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON,
+#   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_AVX512VL, X86_AVX512CD,
+#   X86_AVX512VBMI, X86_AVX512VPOPCNTDQ, X86_AVX512VNNI, X86_XOP, X86_GFNI,
+#   X86_BMI2, ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON, ARM64_NEON_DOTPROD,
+#   ARM64_SVE,
 #   MIPS_MSA, POWER_ALTIVEC, POWER_VSX_206, POWER_VSX_207
 #
 function(simdpp_multiarch FILE_LIST_VAR SRC_FILE)
@@ -1092,6 +1536,11 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
         # Since Bulldozer
         list(APPEND ALL_ARCHS "X86_SSE4_1")
     endif()
+    if(DEFINED ARCH_SUPPORTED_X86_SSE4_2)
+        # Since Nehalem and Bulldozer
+        # All CPUs that support AVX also support SSE4.2, thus the instruction
+        # set is tested together with AVX and later configs.
+    endif()
     if(DEFINED ARCH_SUPPORTED_X86_POPCNT_INSN)
         # Since Nehalem and K10.
 
@@ -1102,7 +1551,7 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
     endif()
     if(DEFINED ARCH_SUPPORTED_X86_AVX)
         # Since Sandy Bridge, Bulldozer, Jaguar
-        list(APPEND ALL_ARCHS "X86_AVX,X86_POPCNT_INSN")
+        list(APPEND ALL_ARCHS "X86_AVX,X86_SSE4_2,X86_POPCNT_INSN")
 
         if(DEFINED ARCH_SUPPORTED_X86_FMA3)
             # Since Haswell, Piledriver (later Bulldozer variant)
@@ -1111,15 +1560,19 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
         if(DEFINED ARCH_SUPPORTED_X86_FMA4)
             # Since Bulldozer until Zen. Jaguar does not support FMA4 nor FMA3
             # All CPUs in this range support popcnt
-            list(APPEND ALL_ARCHS "X86_AVX,X86_FMA4,X86_POPCNT_INSN")
+            list(APPEND ALL_ARCHS "X86_AVX,X86_FMA4,X86_SSE4_2,X86_POPCNT_INSN")
         endif()
     endif()
     if(DEFINED ARCH_SUPPORTED_X86_AVX2)
         # Since Haswell and Zen
-        # All Intel and AMD CPUs that support AVX2 also support FMA3 and POPCNT,
-        # thus separate X86_AVX2 config is not needed.
+        # All Intel and AMD CPUs that support AVX2 also support FMA3, F16C and
+        # POPCNT, thus separate X86_AVX2 config is not needed.
         if(DEFINED ARCH_SUPPORTED_X86_FMA3)
-            list(APPEND ALL_ARCHS "X86_AVX2,X86_FMA3,X86_POPCNT_INSN")
+            if(DEFINED ARCH_SUPPORTED_X86_F16C)
+                list(APPEND ALL_ARCHS "X86_AVX2,X86_FMA3,X86_F16C,X86_SSE4_2,X86_POPCNT_INSN")
+            else()
+                list(APPEND ALL_ARCHS "X86_AVX2,X86_FMA3,X86_SSE4_2,X86_POPCNT_INSN")
+            endif()
         endif()
     endif()
     if(DEFINED ARCH_SUPPORTED_X86_FMA3)
@@ -1132,17 +1585,44 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
         # All AMD CPUs that support FMA4 also support AVX, thus
         # separate X86_FMA4 config is not needed
     endif()
+    if(DEFINED ARCH_SUPPORTED_X86_F16C)
+        # Since Ivy Bridge, Piledriver, Jaguar
+        # All CPUs that support F16C also support AVX. The instruction set is
+        # tested together with AVX2 which is available on all the more recent
+        # CPUs.
+    endif()
     if(DEFINED ARCH_SUPPORTED_X86_AVX512F)
         # Since Knights Landing, Skylake-X
-        # All Intel CPUs that support AVX512F also support FMA3 and POPCNT,
-        # thus separate X86_512F config is not needed.
-        list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN")
+        # All Intel CPUs that support AVX512F also support FMA3, F16C and
+        # POPCNT, thus separate X86_512F config is not needed.
+        if(DEFINED ARCH_SUPPORTED_X86_F16C)
+            list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_F16C,X86_SSE4_2,X86_POPCNT_INSN")
+        else()
+            list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_SSE4_2,X86_POPCNT_INSN")
+        endif()
 
         if(DEFINED ARCH_SUPPORTED_X86_AVX512BW)
             if(DEFINED ARCH_SUPPORTED_X86_AVX512DQ)
                 # All Intel processors that support AVX512BW also support
                 # AVX512DQ
-                list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ")
+                if(DEFINED ARCH_SUPPORTED_X86_F16C)
+                    list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_F16C,X86_SSE4_2,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ")
+                else()
+                    list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_SSE4_2,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ")
+                endif()
+
+                # Since Ice Lake. All processors that support these
+                # extensions also support the ones above.
+                if(DEFINED ARCH_SUPPORTED_X86_F16C AND
+                        DEFINED ARCH_SUPPORTED_X86_AVX512VL AND
+                        DEFINED ARCH_SUPPORTED_X86_AVX512CD AND
+                        DEFINED ARCH_SUPPORTED_X86_AVX512VBMI AND
+                        DEFINED ARCH_SUPPORTED_X86_AVX512VNNI AND
+                        DEFINED ARCH_SUPPORTED_X86_AVX512VPOPCNTDQ AND
+                        DEFINED ARCH_SUPPORTED_X86_GFNI AND
+                        DEFINED ARCH_SUPPORTED_X86_BMI2)
+                    list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_F16C,X86_SSE4_2,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL,X86_AVX512CD,X86_AVX512VBMI,X86_AVX512VNNI,X86_AVX512VPOPCNTDQ,X86_GFNI,X86_BMI2")
+                endif()
             endif()
         endif()
     endif()
@@ -1159,6 +1639,12 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
     if(DEFINED ARCH_SUPPORTED_ARM64_NEON)
         list(APPEND ALL_ARCHS "ARM64_NEON")
     endif()
+    if(DEFINED ARCH_SUPPORTED_ARM64_NEON_DOTPROD)
+        list(APPEND ALL_ARCHS "ARM64_NEON_DOTPROD")
+    endif()
+    if(DEFINED ARCH_SUPPORTED_ARM64_SVE)
+        list(APPEND ALL_ARCHS "ARM64_SVE")
+    endif()
     if(DEFINED ARCH_SUPPORTED_MIPS_MSA)
         list(APPEND ALL_ARCHS "MIPS_MSA")
     endif()
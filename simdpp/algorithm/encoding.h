@@ -0,0 +1,674 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_ENCODING_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_ENCODING_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/i_sub_sat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/detail/insn/mem_pack.h>
+#include <simdpp/detail/insn/mem_unpack.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/// The alphabets of base64_encode() and base64_decode()
+enum class base64_alphabet {
+    /// The alphabet of RFC 4648 section 4 using '+' and '/'. The encoded text
+    /// is padded with '='.
+    standard,
+    /// The URL and filename safe alphabet of RFC 4648 section 5 using '-'
+    /// and '_'. The encoded text is not padded.
+    url
+};
+
+/// The result of base64_decode() and hex_decode()
+struct decode_result {
+    /// The end of the decoded data in the output range
+    char* out;
+    /// Points to the first invalid character of the input, to the end of
+    /// the input if it is truncated, or is @c nullptr if the input is valid
+    const char* error;
+};
+
+namespace detail {
+
+/*  The functions in this file process vectors of the fastest width. The
+    bytes are deinterleaved and interleaved by mem_unpack3(), mem_pack4() and
+    similar functions, which are the in-register parts of load_packed3(),
+    store_packed4() and similar, thus the computations work on one byte of
+    each group at a time and don't depend on the byte order. The unaligned
+    loads and stores are used because the pointers are arbitrary.
+*/
+using encoding_vector = uint8<SIMDPP_FAST_INT8_SIZE>;
+
+// The lookup tables of a base64 alphabet
+struct base64_tables {
+    char encode[64];
+    int8_t decode[256];
+    char char62, char63;
+
+    // permute_bytes16() tables indexed by the high and low nibble of a
+    // character. The character is invalid if the values looked up in
+    // decode_hi and decode_lo have common bits. decode_roll contains the
+    // difference between the value and the character by the high nibble.
+    // The tables are repeated for each 128-bit lane of encoding_vector.
+    uint8_t decode_lo[encoding_vector::length];
+    uint8_t decode_hi[encoding_vector::length];
+    uint8_t decode_roll[encoding_vector::length];
+
+    base64_tables(char c62, char c63) : char62(c62), char63(c63)
+    {
+        for (unsigned i = 0; i < 256; ++i)
+            decode[i] = -1;
+        for (unsigned i = 0; i < 64; ++i) {
+            char c = i < 26 ? char('A' + i) : i < 52 ? char('a' + i - 26) :
+                     i < 62 ? char('0' + i - 52) : i == 62 ? c62 : c63;
+            encode[i] = c;
+            decode[uint8_t(c)] = int8_t(i);
+        }
+
+        // the valid characters have high nibbles from 2 to 7. Each of them is
+        // assigned a separate bit, all others share bit 0.
+        for (unsigned i = 0; i < 16; ++i) {
+            decode_hi[i] = i >= 2 && i <= 7 ? uint8_t(1 << (i - 1)) : 1;
+            decode_lo[i] = 1;
+            decode_roll[i] = 0;
+        }
+        for (unsigned c = 0x20; c < 0x80; ++c) {
+            if (decode[c] < 0)
+                decode_lo[c & 0xf] |= decode_hi[c >> 4];
+        }
+        decode_roll[3] = uint8_t(52 - '0');
+        decode_roll[4] = decode_roll[5] = uint8_t(-'A');
+        decode_roll[6] = decode_roll[7] = uint8_t(26 - 'a');
+        for (unsigned i = 16; i < encoding_vector::length; ++i) {
+            decode_lo[i] = decode_lo[i % 16];
+            decode_hi[i] = decode_hi[i % 16];
+            decode_roll[i] = decode_roll[i % 16];
+        }
+    }
+};
+
+static SIMDPP_INL
+const base64_tables& base64_get_tables(base64_alphabet alphabet)
+{
+    static const base64_tables standard('+', '/');
+    static const base64_tables url('-', '_');
+    return alphabet == base64_alphabet::url ? url : standard;
+}
+
+/*  Converts 6-bit values to base64 characters. The difference between the
+    character and the value is looked up by permute_bytes16() in a table
+    indexed by sub_sat(value, 51): the values 52..63 map to entries 1..12,
+    the letters to entry 0, which is then split into the upper and lower case
+    letters by a comparison.
+*/
+class base64_encoder {
+public:
+    base64_encoder(const base64_tables& t)
+    {
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+        offsets_ = make_uint(uint8_t('a' - 26), uint8_t('0' - 52), uint8_t('0' - 52),
+                             uint8_t('0' - 52), uint8_t('0' - 52), uint8_t('0' - 52),
+                             uint8_t('0' - 52), uint8_t('0' - 52), uint8_t('0' - 52),
+                             uint8_t('0' - 52), uint8_t('0' - 52),
+                             uint8_t(t.char62 - 62), uint8_t(t.char63 - 63),
+                             uint8_t('A'), 0, 0);
+#else
+        char62_ = splat(uint8_t(t.char62 - ('0' - 52) - 62));
+        char63_ = splat(uint8_t(t.char63 - ('0' - 52) - 63));
+#endif
+    }
+
+    encoding_vector operator()(const encoding_vector& v) const
+    {
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+        encoding_vector idx = sub_sat(v, encoding_vector(splat(51)));
+        encoding_vector upper = encoding_vector(cmp_lt(v, encoding_vector(splat(26))));
+        idx = blend(encoding_vector(splat(13)), idx, upper);
+        return add(v, permute_bytes16(offsets_, idx));
+#else
+        // 'A', 'a' - 26 and '0' - 52 are added to the ranges of the values
+        // by two comparisons, the two special characters by two more
+        encoding_vector r = add(v, encoding_vector(splat(uint8_t('A'))));
+        encoding_vector lower = encoding_vector(cmp_gt(v, encoding_vector(splat(25))));
+        encoding_vector digit = encoding_vector(cmp_gt(v, encoding_vector(splat(51))));
+        r = add(r, bit_and(lower, encoding_vector(splat(uint8_t('a' - 26 - 'A')))));
+        r = add(r, bit_and(digit, encoding_vector(splat(uint8_t('0' - 52 - ('a' - 26))))));
+        r = add(r, bit_and(encoding_vector(cmp_eq(v, encoding_vector(splat(62)))), char62_));
+        r = add(r, bit_and(encoding_vector(cmp_eq(v, encoding_vector(splat(63)))), char63_));
+        return r;
+#endif
+    }
+
+private:
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    encoding_vector offsets_;
+#else
+    encoding_vector char62_, char63_;
+#endif
+};
+
+/*  Converts base64 characters to 6-bit values. The nonzero elements of err
+    are set for the invalid characters.
+*/
+class base64_decoder {
+public:
+    base64_decoder(const base64_tables& t)
+    {
+        char62_ = splat(uint8_t(t.char62));
+        char63_ = splat(uint8_t(t.char63));
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+        lo_ = load_u(t.decode_lo);
+        hi_ = load_u(t.decode_hi);
+        roll_ = load_u(t.decode_roll);
+        roll62_ = splat(uint8_t(62 - t.char62));
+        roll63_ = splat(uint8_t(63 - t.char63));
+#endif
+    }
+
+    encoding_vector operator()(const encoding_vector& c, encoding_vector& err) const
+    {
+        encoding_vector is62 = encoding_vector(cmp_eq(c, char62_));
+        encoding_vector is63 = encoding_vector(cmp_eq(c, char63_));
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+        encoding_vector hi = shift_r<4>(c);
+        encoding_vector lo = bit_and(c, encoding_vector(splat(0x0f)));
+        err = bit_or(err, bit_and(permute_bytes16(lo_, lo), permute_bytes16(hi_, hi)));
+
+        encoding_vector roll = permute_bytes16(roll_, hi);
+        roll = blend(roll62_, roll, is62);
+        roll = blend(roll63_, roll, is63);
+        return add(c, roll);
+#else
+        encoding_vector upper = sub(c, encoding_vector(splat(uint8_t('A'))));
+        encoding_vector lower = sub(c, encoding_vector(splat(uint8_t('a'))));
+        encoding_vector digit = sub(c, encoding_vector(splat(uint8_t('0'))));
+        encoding_vector is_upper = encoding_vector(cmp_lt(upper, encoding_vector(splat(26))));
+        encoding_vector is_lower = encoding_vector(cmp_lt(lower, encoding_vector(splat(26))));
+        encoding_vector is_digit = encoding_vector(cmp_lt(digit, encoding_vector(splat(10))));
+        encoding_vector valid = bit_or(bit_or(is_upper, is_lower),
+                                       bit_or(is_digit, bit_or(is62, is63)));
+        err = bit_or(err, bit_andnot(encoding_vector(make_ones()), valid));
+
+        encoding_vector r = bit_and(upper, is_upper);
+        r = bit_or(r, bit_and(add(lower, encoding_vector(splat(26))), is_lower));
+        r = bit_or(r, bit_and(add(digit, encoding_vector(splat(52))), is_digit));
+        r = bit_or(r, bit_and(encoding_vector(splat(62)), is62));
+        r = bit_or(r, bit_and(encoding_vector(splat(63)), is63));
+        return r;
+#endif
+    }
+
+private:
+    encoding_vector char62_, char63_;
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    encoding_vector lo_, hi_, roll_, roll62_, roll63_;
+#endif
+};
+
+/*  Loads and stores vectors whose 128-bit lanes are stride bytes apart in
+    memory. Each lane is loaded and stored as a whole, thus 16-stride bytes
+    past the last lane are read or written.
+*/
+template<unsigned N> struct encoding_lanes {
+    static SIMDPP_INL
+    uint8<N> load(const uint8_t* p, unsigned stride)
+    {
+        return combine(encoding_lanes<N/2>::load(p, stride),
+                       encoding_lanes<N/2>::load(p + stride * N / 32, stride));
+    }
+
+    static SIMDPP_INL
+    void store(char* p, const uint8<N>& a, unsigned stride)
+    {
+        uint8<N/2> lo, hi;
+        split(a, lo, hi);
+        encoding_lanes<N/2>::store(p, lo, stride);
+        encoding_lanes<N/2>::store(p + stride * N / 32, hi, stride);
+    }
+};
+
+template<> struct encoding_lanes<16> {
+    static SIMDPP_INL
+    uint8<16> load(const uint8_t* p, unsigned) { return load_u(p); }
+
+    static SIMDPP_INL
+    void store(char* p, const uint8<16>& a, unsigned) { store_u(p, a); }
+};
+
+static SIMDPP_INL
+char* i_base64_encode(const uint8_t* p, const uint8_t* last, char* out,
+                      base64_alphabet alphabet)
+{
+    const base64_tables& t = base64_get_tables(alphabet);
+    const std::ptrdiff_t len = encoding_vector::length;
+    base64_encoder encoder(t);
+
+#if !SIMDPP_BIG_ENDIAN && (SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA)
+    /*  Each 128-bit lane encodes 12 bytes. The bytes of each group are
+        shuffled to the order b1, b0, b2, b1, then the 6-bit values are
+        moved to separate bytes by 16-bit multiplications. This depends on
+        the byte order, but avoids deinterleaving the bytes across vectors.
+    */
+    const std::ptrdiff_t lanes = len / 16;
+    using uint16_vector = uint16<encoding_vector::length / 2>;
+    using uint32_vector = uint32<encoding_vector::length / 4>;
+    encoding_vector shuffle = make_uint(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    uint32_vector mask_a = splat(0x0fc0fc00);
+    uint32_vector mask_b = splat(0x003f03f0);
+    uint16_vector mul_a = bit_cast<uint16_vector>(uint32_vector(splat(0x04000040)));
+    uint16_vector mul_b = bit_cast<uint16_vector>(uint32_vector(splat(0x01000010)));
+
+    for (; last - p >= 12 * lanes + 4; p += 12 * lanes) {
+        encoding_vector in = encoding_lanes<encoding_vector::length>::load(p, 12);
+        uint32_vector v = bit_cast<uint32_vector>(encoding_vector(permute_bytes16(in, shuffle)));
+        uint32_vector va = bit_and(v, mask_a);
+        uint32_vector vb = bit_and(v, mask_b);
+        uint16_vector a = mul_hi(bit_cast<uint16_vector>(va), mul_a);
+        uint16_vector b = mul_lo(bit_cast<uint16_vector>(vb), mul_b);
+        uint16_vector i = bit_or(a, b);
+        store_u(out, encoder(bit_cast<encoding_vector>(i)));
+        out += len;
+    }
+#else
+    encoding_vector mask6 = splat(0x3f);
+    for (; last - p >= 3 * len; p += 3 * len) {
+        encoding_vector a = load_u(p);
+        encoding_vector b = load_u(p + len);
+        encoding_vector c = load_u(p + 2 * len);
+        insn::mem_unpack3(a, b, c);
+
+        encoding_vector i0 = shift_r<2>(a);
+        encoding_vector i1 = bit_and(bit_or(shift_l<4>(a), shift_r<4>(b)), mask6);
+        encoding_vector i2 = bit_and(bit_or(shift_l<2>(b), shift_r<6>(c)), mask6);
+        encoding_vector i3 = bit_and(c, mask6);
+        i0 = encoder(i0);
+        i1 = encoder(i1);
+        i2 = encoder(i2);
+        i3 = encoder(i3);
+
+        insn::mem_pack4(i0, i1, i2, i3);
+        store_u(out, i0);
+        store_u(out + len, i1);
+        store_u(out + 2 * len, i2);
+        store_u(out + 3 * len, i3);
+        out += 4 * len;
+    }
+#endif
+
+    for (; last - p >= 3; p += 3) {
+        uint32_t v = (uint32_t(p[0]) << 16) | (uint32_t(p[1]) << 8) | p[2];
+        *out++ = t.encode[v >> 18];
+        *out++ = t.encode[(v >> 12) & 0x3f];
+        *out++ = t.encode[(v >> 6) & 0x3f];
+        *out++ = t.encode[v & 0x3f];
+    }
+    if (p != last) {
+        uint32_t v = uint32_t(p[0]) << 16;
+        if (last - p == 2)
+            v |= uint32_t(p[1]) << 8;
+        *out++ = t.encode[v >> 18];
+        *out++ = t.encode[(v >> 12) & 0x3f];
+        if (last - p == 2)
+            *out++ = t.encode[(v >> 6) & 0x3f];
+        if (alphabet == base64_alphabet::standard) {
+            if (last - p == 1)
+                *out++ = '=';
+            *out++ = '=';
+        }
+    }
+    return out;
+}
+
+// Decodes count characters at p, count must be from 2 to 4. Returns false if
+// any of the characters are invalid.
+static SIMDPP_INL
+bool base64_decode_group(const base64_tables& t, const char* p, unsigned count,
+                         uint32_t& v)
+{
+    v = 0;
+    int8_t bits = 0;
+    for (unsigned i = 0; i < count; ++i) {
+        int8_t d = t.decode[uint8_t(p[i])];
+        bits |= d;
+        v = (v << 6) | uint32_t(d & 0x3f);
+    }
+    v <<= 6 * (4 - count);
+    return bits >= 0;
+}
+
+static SIMDPP_INL
+decode_result i_base64_decode(const char* p, const char* last, char* out,
+                              base64_alphabet alphabet)
+{
+    const base64_tables& t = base64_get_tables(alphabet);
+    const std::ptrdiff_t len = encoding_vector::length;
+    base64_decoder decoder(t);
+    const char* end = last;
+
+    // one or two padding characters are accepted in place of the omitted
+    // characters of the last group
+    if ((last - p) % 4 == 0 && last != p && last[-1] == '=') {
+        --last;
+        if (last[-1] == '=')
+            --last;
+    }
+
+#if !SIMDPP_BIG_ENDIAN && (SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA)
+    /*  Each 128-bit lane decodes 16 characters to 12 bytes. The 6-bit values
+        of each group are combined by 16-bit and 32-bit shifts, then the
+        bytes are shuffled to the big-endian order. The stores of the lanes
+        write 4 bytes more, which fit into the space for the remaining
+        characters.
+    */
+    const std::ptrdiff_t lanes = len / 16;
+    using uint16_vector = uint16<encoding_vector::length / 2>;
+    using uint32_vector = uint32<encoding_vector::length / 4>;
+    encoding_vector shuffle = make_uint(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 15, 15, 15, 15);
+
+    for (; last - p >= len + 4; p += len) {
+        encoding_vector err = make_zero();
+        encoding_vector c = load_u(p);
+        c = decoder(c, err);
+        if (test_bits_any(err))
+            break; // the scalar loop below finds the invalid character
+
+        uint16_vector v16 = bit_cast<uint16_vector>(c);
+        v16 = bit_or(shift_l<6>(uint16_vector(bit_and(v16, uint16_vector(splat(0xff))))),
+                     shift_r<8>(v16));
+        uint32_vector v32 = bit_cast<uint32_vector>(v16);
+        v32 = bit_or(shift_l<12>(uint32_vector(bit_and(v32, uint32_vector(splat(0xffff))))),
+                     shift_r<16>(v32));
+        c = permute_bytes16(bit_cast<encoding_vector>(v32), shuffle);
+        encoding_lanes<encoding_vector::length>::store(out, c, 12);
+        out += 12 * lanes;
+    }
+#else
+    for (; last - p >= 4 * len; p += 4 * len) {
+        encoding_vector a = load_u(p);
+        encoding_vector b = load_u(p + len);
+        encoding_vector c = load_u(p + 2 * len);
+        encoding_vector d = load_u(p + 3 * len);
+        insn::mem_unpack4(a, b, c, d);
+
+        encoding_vector err = make_zero();
+        a = decoder(a, err);
+        b = decoder(b, err);
+        c = decoder(c, err);
+        d = decoder(d, err);
+        if (test_bits_any(err))
+            break; // the scalar loop below finds the invalid character
+
+        encoding_vector o0 = bit_or(shift_l<2>(a), shift_r<4>(b));
+        encoding_vector o1 = bit_or(shift_l<4>(b), shift_r<2>(c));
+        encoding_vector o2 = bit_or(shift_l<6>(c), d);
+        insn::mem_pack3(o0, o1, o2);
+        store_u(out, o0);
+        store_u(out + len, o1);
+        store_u(out + 2 * len, o2);
+        out += 3 * len;
+    }
+#endif
+
+    for (; p != last; p += 4) {
+        unsigned count = last - p >= 4 ? 4 : unsigned(last - p);
+        uint32_t v;
+        if (count == 1 || !base64_decode_group(t, p, count, v)) {
+            for (unsigned i = 0; i < count; ++i) {
+                if (t.decode[uint8_t(p[i])] < 0)
+                    return decode_result{ out, p + i };
+            }
+            return decode_result{ out, end };
+        }
+        *out++ = char(v >> 16);
+        if (count > 2)
+            *out++ = char(v >> 8);
+        if (count > 3)
+            *out++ = char(v);
+        if (count < 4)
+            break;
+    }
+    return decode_result{ out, nullptr };
+}
+
+/*  Converts 4-bit values to lowercase hexadecimal digits. The value is used
+    as an index into a table of the digits when permute_bytes16() is
+    supported, otherwise the letters are adjusted by a comparison.
+*/
+static SIMDPP_INL
+encoding_vector hex_digits(const encoding_vector& v)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    encoding_vector digits = make_uint('0', '1', '2', '3', '4', '5', '6', '7',
+                                       '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+    return permute_bytes16(digits, v);
+#else
+    encoding_vector letter = encoding_vector(cmp_gt(v, encoding_vector(splat(9))));
+    encoding_vector r = add(v, encoding_vector(splat(uint8_t('0'))));
+    return add(r, bit_and(letter, encoding_vector(splat(uint8_t('a' - '0' - 10)))));
+#endif
+}
+
+// Converts hexadecimal digits of either case to 4-bit values. The nonzero
+// elements of err are set for the invalid characters.
+static SIMDPP_INL
+encoding_vector hex_values(const encoding_vector& c, encoding_vector& err)
+{
+    encoding_vector digit = sub(c, encoding_vector(splat(uint8_t('0'))));
+    // clearing bit 5 converts the lowercase letters to uppercase
+    encoding_vector letter = sub(bit_andnot(c, encoding_vector(splat(0x20))),
+                                 encoding_vector(splat(uint8_t('A'))));
+    encoding_vector is_digit = encoding_vector(cmp_lt(digit, encoding_vector(splat(10))));
+    encoding_vector is_letter = encoding_vector(cmp_lt(letter, encoding_vector(splat(6))));
+    err = bit_or(err, bit_andnot(encoding_vector(make_ones()), bit_or(is_digit, is_letter)));
+    return blend(digit, add(letter, encoding_vector(splat(10))), is_digit);
+}
+
+static SIMDPP_INL
+char* i_hex_encode(const uint8_t* p, const uint8_t* last, char* out)
+{
+    static const char digits[] = "0123456789abcdef";
+    const std::ptrdiff_t len = encoding_vector::length;
+    for (; last - p >= len; p += len) {
+        encoding_vector v = load_u(p);
+        encoding_vector hi = hex_digits(shift_r<4>(v));
+        encoding_vector lo = hex_digits(bit_and(v, encoding_vector(splat(0x0f))));
+        insn::mem_pack2(hi, lo);
+        store_u(out, hi);
+        store_u(out + len, lo);
+        out += 2 * len;
+    }
+    for (; p != last; ++p) {
+        *out++ = digits[*p >> 4];
+        *out++ = digits[*p & 0xf];
+    }
+    return out;
+}
+
+static SIMDPP_INL
+int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+static SIMDPP_INL
+decode_result i_hex_decode(const char* p, const char* last, char* out)
+{
+    const std::ptrdiff_t len = encoding_vector::length;
+    const char* end = last;
+    last = p + (last - p) / 2 * 2;
+
+    for (; last - p >= 2 * len; p += 2 * len) {
+        encoding_vector hi = load_u(p);
+        encoding_vector lo = load_u(p + len);
+        insn::mem_unpack2(hi, lo);
+        encoding_vector err = make_zero();
+        hi = hex_values(hi, err);
+        lo = hex_values(lo, err);
+        if (test_bits_any(err))
+            break; // the scalar loop below finds the invalid character
+        store_u(out, bit_or(shift_l<4>(hi), lo));
+        out += len;
+    }
+    for (; p != last; p += 2) {
+        int hi = hex_value(p[0]);
+        int lo = hex_value(p[1]);
+        if (hi < 0)
+            return decode_result{ out, p };
+        if (lo < 0)
+            return decode_result{ out, p + 1 };
+        *out++ = char((hi << 4) | lo);
+    }
+    if (last != end)
+        return decode_result{ out, hex_value(*last) < 0 ? last : end };
+    return decode_result{ out, nullptr };
+}
+
+static SIMDPP_INL
+const uint8_t* encoding_bytes(const char* p)
+{
+    return reinterpret_cast<const uint8_t*>(p);
+}
+
+} // namespace detail
+
+/** Returns the length of the base64 encoding of @a size bytes using the given
+    alphabet.
+*/
+static SIMDPP_INL
+std::size_t base64_encoded_size(std::size_t size,
+                                base64_alphabet alphabet = base64_alphabet::standard)
+{
+    if (alphabet == base64_alphabet::standard)
+        return (size + 2) / 3 * 4;
+    return size / 3 * 4 + (size % 3 == 0 ? 0 : size % 3 + 1);
+}
+
+/** Encodes the bytes in the range [first, last) to base64 and stores the
+    characters to the range starting at @a out. Returns the end of the output
+    range. The output range must have space for base64_encoded_size()
+    characters.
+
+    Each group of 3 bytes is encoded to 4 characters of 6 bits each. On
+    little-endian instruction sets that support permute_bytes16() the bytes
+    of each group are shuffled within 128-bit lanes and the 6-bit values are
+    separated by 16-bit multiplications. Otherwise the bytes are
+    deinterleaved in the same way as in load_packed3(), the 6-bit values are
+    computed by shifts and the characters are interleaved in the same way as
+    in store_packed4(). The values are converted to characters by a lookup
+    using permute_bytes16() and sub_sat(), or by comparisons on instruction
+    sets that don't support it.
+*/
+static SIMDPP_INL
+char* base64_encode(const char* first, const char* last, char* out,
+                    base64_alphabet alphabet = base64_alphabet::standard)
+{
+    return detail::i_base64_encode(detail::encoding_bytes(first),
+                                   detail::encoding_bytes(last), out, alphabet);
+}
+
+/** Decodes the base64 text in the range [first, last) and stores the bytes
+    to the range starting at @a out. The output range must have space for
+    @c (last-first)/4*3+2 bytes.
+
+    The text may omit the padding, in which case its length must not leave a
+    remainder of 1 when divided by 4. If the text is padded, the padding may
+    only appear at its end. Whitespace and characters of the other alphabet
+    are not accepted. The unused bits of the last character are ignored.
+
+    Returns the end of the decoded data and, if the input is invalid, the
+    position of the first invalid character or the end of the input if the
+    input is truncated. The contents of the output range are unspecified if
+    the input is invalid.
+
+    The characters are validated and converted to 6-bit values by lookups
+    using permute_bytes16() indexed by the high and low nibble of each
+    character. On little-endian instruction sets the values of each group are
+    combined by shifts within 128-bit lanes and the bytes are moved to their
+    places by permute_bytes16(). Otherwise the characters are deinterleaved
+    in the same way as in load_packed4() and the bytes are computed by shifts
+    and interleaved in the same way as in store_packed3(). On instruction
+    sets that don't support permute_bytes16() the characters are validated
+    and converted by comparisons.
+*/
+static SIMDPP_INL
+decode_result base64_decode(const char* first, const char* last, char* out,
+                            base64_alphabet alphabet = base64_alphabet::standard)
+{
+    return detail::i_base64_decode(first, last, out, alphabet);
+}
+
+/** Encodes the bytes in the range [first, last) as lowercase hexadecimal
+    digits and stores them to the range starting at @a out. Returns the end of
+    the output range. The output range must have space for
+    @c 2*(last-first) characters.
+
+    The digits are looked up by permute_bytes16() or computed by a comparison
+    on instruction sets that don't support it. The digits of the high and low
+    nibbles are interleaved in the same way as in store_packed2().
+*/
+static SIMDPP_INL
+char* hex_encode(const char* first, const char* last, char* out)
+{
+    return detail::i_hex_encode(detail::encoding_bytes(first),
+                                detail::encoding_bytes(last), out);
+}
+
+/** Decodes the hexadecimal digits of either case in the range [first, last)
+    and stores the bytes to the range starting at @a out. The output range must
+    have space for @c (last-first)/2 bytes.
+
+    Returns the end of the decoded data and, if the input is invalid, the
+    position of the first invalid character or the end of the input if the
+    number of digits is odd. The contents of the output range are unspecified
+    if the input is invalid.
+*/
+static SIMDPP_INL
+decode_result hex_decode(const char* first, const char* last, char* out)
+{
+    return detail::i_hex_decode(first, last, out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,482 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_FIND_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_FIND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/i_reduce_add.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/detail/bit_scan.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  The functions in this file load whole aligned vectors even if only some of
+    their bytes are within the searched range. An aligned vector never
+    crosses a page boundary, thus such loads never access memory that the
+    range itself does not share a page with. The two-range functions can't
+    align both pointers; they check the distance to the page boundary instead.
+
+    extract_bits_any() supports at most 32 elements, thus 256-bit vectors are
+    used even when wider ones are available.
+*/
+#if SIMDPP_FAST_INT8_SIZE >= 32
+using find_vector = uint8<32>;
+#else
+using find_vector = uint8<16>;
+#endif
+
+// The smallest page size of the supported platforms
+static const std::size_t find_page_size = 4096;
+
+static SIMDPP_INL
+const uint8_t* find_align_down(const uint8_t* p, std::size_t align)
+{
+    return reinterpret_cast<const uint8_t*>(
+                reinterpret_cast<std::uintptr_t>(p) & ~std::uintptr_t(align - 1));
+}
+
+// Returns true if a vector can be loaded from p without crossing a page
+// boundary
+static SIMDPP_INL
+bool find_load_in_page(const uint8_t* p)
+{
+    std::uintptr_t offset = reinterpret_cast<std::uintptr_t>(p) & (find_page_size - 1);
+    return offset <= find_page_size - find_vector::length;
+}
+
+static SIMDPP_INL
+find_vector find_load(const uint8_t* p)
+{
+    find_vector r = load(p);
+    return r;
+}
+
+static SIMDPP_INL
+find_vector find_load_u(const uint8_t* p)
+{
+    find_vector r = load_u(p);
+    return r;
+}
+
+// Returns a bit mask with the i-th bit set if the i-th byte of m is 0xff. The
+// bytes of m must be either 0x00 or 0xff.
+static SIMDPP_INL
+uint32_t find_bits(const find_vector& m)
+{
+    return extract_bits_any(m);
+}
+
+// Returns a mask with the lowest n bits set, 0 <= n <= 32
+static SIMDPP_INL
+uint32_t find_low_bits(std::size_t n)
+{
+    return n >= 32 ? ~uint32_t(0) : (uint32_t(1) << n) - 1;
+}
+
+/*  The matchers return a vector whose bytes are 0xff where the corresponding
+    bytes of the argument match and 0x00 elsewhere.
+*/
+class find_byte_matcher {
+public:
+    find_byte_matcher(uint8_t value) : value_(splat(value)) {}
+
+    SIMDPP_INL find_vector operator()(const find_vector& v) const
+    {
+        return find_vector(cmp_eq(v, value_));
+    }
+
+private:
+    find_vector value_;
+};
+
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+/*  Matches any byte of a set of up to 16 bytes. Each byte of the set is
+    assigned a bit in one of two groups of 8. Two tables indexed by the low
+    and the high nibble of a byte give the bits of the set bytes that have the
+    same nibble. A byte is in the set if the two results share a bit.
+*/
+class find_set_matcher {
+public:
+    find_set_matcher(const uint8_t* set, unsigned n) : groups_(n > 8 ? 2 : 1)
+    {
+        // The tables are built in registers: writing the bytes to memory and
+        // loading them back as vectors stalls store forwarding, which costs
+        // more than searching a short range
+        find_vector index = make_uint(0, 1, 2, 3, 4, 5, 6, 7,
+                                      8, 9, 10, 11, 12, 13, 14, 15);
+        for (unsigned g = 0; g < 2; ++g) {
+            lo_[g] = make_zero();
+            hi_[g] = make_zero();
+        }
+        for (unsigned i = 0; i < n; ++i) {
+            find_vector bit = splat(uint8_t(1 << (i % 8)));
+            find_vector vlo = splat(uint8_t(set[i] & 0x0f));
+            find_vector vhi = splat(uint8_t(set[i] >> 4));
+            vlo = bit_and(bit, find_vector(cmp_eq(index, vlo)));
+            vhi = bit_and(bit, find_vector(cmp_eq(index, vhi)));
+            lo_[i / 8] = bit_or(lo_[i / 8], vlo);
+            hi_[i / 8] = bit_or(hi_[i / 8], vhi);
+        }
+    }
+
+    SIMDPP_INL find_vector operator()(const find_vector& v) const
+    {
+        find_vector vlo = bit_and(v, find_vector(splat(uint8_t(0x0f))));
+        find_vector vhi = shift_r<4>(v);
+        find_vector r = bit_and(permute_bytes16(lo_[0], vlo),
+                                permute_bytes16(hi_[0], vhi));
+        if (groups_ == 2) {
+            r = bit_or(r, bit_and(permute_bytes16(lo_[1], vlo),
+                                  permute_bytes16(hi_[1], vhi)));
+        }
+        return find_vector(cmp_neq(r, find_vector(make_zero())));
+    }
+
+private:
+    find_vector lo_[2], hi_[2];
+    unsigned groups_;
+};
+#else
+// Matches any byte of a set of up to 16 bytes by comparing with each of them
+class find_set_matcher {
+public:
+    find_set_matcher(const uint8_t* set, unsigned n) : size_(n)
+    {
+        for (unsigned i = 0; i < 16; ++i)
+            set_[i] = splat(set[i < n ? i : 0]);
+    }
+
+    SIMDPP_INL find_vector operator()(const find_vector& v) const
+    {
+        find_vector r = find_vector(cmp_eq(v, set_[0]));
+        for (unsigned i = 1; i < size_; ++i)
+            r = bit_or(r, find_vector(cmp_eq(v, set_[i])));
+        return r;
+    }
+
+private:
+    find_vector set_[16];
+    unsigned size_;
+};
+#endif
+
+template<class M> SIMDPP_INL
+const uint8_t* i_find_first(const uint8_t* first, const uint8_t* last,
+                            const M& match)
+{
+    using V = find_vector;
+    const unsigned len = V::length;
+    if (first == last)
+        return last;
+
+    const uint8_t* p = find_align_down(first, len);
+    uint32_t bits = find_bits(match(find_load(p))) & (~uint32_t(0) << (first - p));
+    p += len;
+    if (!bits) {
+        for (; p + 4 * len <= last; p += 4 * len) {
+            V m0 = match(find_load(p));
+            V m1 = match(find_load(p + len));
+            V m2 = match(find_load(p + 2 * len));
+            V m3 = match(find_load(p + 3 * len));
+            if (test_bits_any(bit_or(bit_or(m0, m1), bit_or(m2, m3))))
+                break;
+        }
+        for (; !bits && p < last; p += len)
+            bits = find_bits(match(find_load(p)));
+        if (!bits)
+            return last;
+    }
+    const uint8_t* r = p - len + bit_scan_forward(bits);
+    return r < last ? r : last;
+}
+
+template<class M> SIMDPP_INL
+const uint8_t* i_find_last(const uint8_t* first, const uint8_t* last,
+                           const M& match)
+{
+    using V = find_vector;
+    const unsigned len = V::length;
+    if (first == last)
+        return last;
+
+    const uint8_t* p = find_align_down(last - 1, len);
+    uint32_t bits = find_bits(match(find_load(p))) & find_low_bits(last - p);
+    if (!bits) {
+        for (; p >= first + 4 * len; p -= 4 * len) {
+            V m0 = match(find_load(p - len));
+            V m1 = match(find_load(p - 2 * len));
+            V m2 = match(find_load(p - 3 * len));
+            V m3 = match(find_load(p - 4 * len));
+            if (test_bits_any(bit_or(bit_or(m0, m1), bit_or(m2, m3))))
+                break;
+        }
+        while (!bits && p > first) {
+            p -= len;
+            bits = find_bits(match(find_load(p)));
+        }
+        if (!bits)
+            return last;
+    }
+    const uint8_t* r = p + bit_scan_reverse(bits);
+    return r >= first ? r : last;
+}
+
+template<class M> SIMDPP_INL
+std::size_t i_count(const uint8_t* first, const uint8_t* last, const M& match)
+{
+    using V = find_vector;
+    const unsigned len = V::length;
+    if (first == last)
+        return 0;
+
+    const uint8_t* p = find_align_down(first, len);
+    uint32_t bits = find_bits(match(find_load(p))) & (~uint32_t(0) << (first - p));
+    if (p + len >= last)
+        return bit_count(bits & find_low_bits(last - p));
+    std::size_t count = bit_count(bits);
+    p += len;
+
+    // The matches are counted in 8-bit counters that are added up before
+    // they may overflow
+    while (p + len <= last) {
+        V counts = make_zero();
+        for (unsigned i = 0; i < 255 && p + len <= last; ++i, p += len)
+            counts = sub(counts, match(find_load(p)));
+        count += reduce_add(counts);
+    }
+    if (p < last)
+        count += bit_count(find_bits(match(find_load(p))) & find_low_bits(last - p));
+    return count;
+}
+
+static SIMDPP_INL
+std::size_t i_strlen(const uint8_t* s)
+{
+    using V = find_vector;
+    const unsigned len = V::length;
+    find_byte_matcher match(0);
+
+    const uint8_t* p = find_align_down(s, len);
+    uint32_t bits = find_bits(match(find_load(p))) & (~uint32_t(0) << (s - p));
+    p += len;
+
+    // Single vectors are processed until p is aligned to 4 vectors so that
+    // the loads of the main loop don't cross a page boundary
+    while (!bits && (reinterpret_cast<std::uintptr_t>(p) & (4 * len - 1)) != 0) {
+        bits = find_bits(match(find_load(p)));
+        p += len;
+    }
+    if (!bits) {
+        for (;; p += 4 * len) {
+            V m0 = match(find_load(p));
+            V m1 = match(find_load(p + len));
+            V m2 = match(find_load(p + 2 * len));
+            V m3 = match(find_load(p + 3 * len));
+            if (test_bits_any(bit_or(bit_or(m0, m1), bit_or(m2, m3))))
+                break;
+        }
+        while (!bits) {
+            bits = find_bits(match(find_load(p)));
+            p += len;
+        }
+    }
+    return p - len + bit_scan_forward(bits) - s;
+}
+
+static SIMDPP_INL
+std::size_t i_find_first_mismatch(const uint8_t* a, const uint8_t* b,
+                                  std::size_t n)
+{
+    using V = find_vector;
+    const unsigned len = V::length;
+    std::size_t i = 0;
+
+    for (; i + 4 * len <= n; i += 4 * len) {
+        V m0 = find_vector(cmp_neq(find_load_u(a + i), find_load_u(b + i)));
+        V m1 = find_vector(cmp_neq(find_load_u(a + i + len), find_load_u(b + i + len)));
+        V m2 = find_vector(cmp_neq(find_load_u(a + i + 2 * len), find_load_u(b + i + 2 * len)));
+        V m3 = find_vector(cmp_neq(find_load_u(a + i + 3 * len), find_load_u(b + i + 3 * len)));
+        if (test_bits_any(bit_or(bit_or(m0, m1), bit_or(m2, m3))))
+            break;
+    }
+    for (; i + len <= n; i += len) {
+        uint32_t bits = find_bits(find_vector(cmp_neq(find_load_u(a + i),
+                                                      find_load_u(b + i))));
+        if (bits)
+            return i + bit_scan_forward(bits);
+    }
+    if (i == n)
+        return n;
+
+    // The last vector either overlaps the bytes that are already known to be
+    // equal or extends past the end of the ranges within the same page
+    uint32_t bits;
+    if (n >= len) {
+        i = n - len;
+        bits = find_bits(find_vector(cmp_neq(find_load_u(a + i), find_load_u(b + i))));
+    } else if (find_load_in_page(a) && find_load_in_page(b)) {
+        bits = find_bits(find_vector(cmp_neq(find_load_u(a), find_load_u(b))));
+        bits &= find_low_bits(n);
+    } else {
+        for (; i < n; ++i) {
+            if (a[i] != b[i])
+                return i;
+        }
+        return n;
+    }
+    return bits ? i + bit_scan_forward(bits) : n;
+}
+
+template<class C> SIMDPP_INL
+const uint8_t* find_bytes(const C* p)
+{
+    static_assert(sizeof(C) == 1, "Only byte-sized elements are supported");
+    return reinterpret_cast<const uint8_t*>(p);
+}
+
+} // namespace detail
+
+/** Returns a pointer to the first element in the range [first, last) that is
+    equal to @a value, or @a last if there is no such element.
+
+    The vectors containing the range are loaded using aligned loads, thus the
+    bytes outside the range may be read, but never across a page boundary.
+    Four vectors are compared per iteration.
+
+    @a C must be a byte-sized type.
+*/
+template<class C> SIMDPP_INL
+const C* find_byte(const C* first, const C* last, C value)
+{
+    const uint8_t* p = detail::find_bytes(first);
+    const uint8_t* r = detail::i_find_first(p, detail::find_bytes(last),
+                                            detail::find_byte_matcher(uint8_t(value)));
+    return first + (r - p);
+}
+
+/** Returns a pointer to the last element in the range [first, last) that is
+    equal to @a value, or @a last if there is no such element.
+
+    The memory is accessed as in find_byte(). @a C must be a byte-sized type.
+*/
+template<class C> SIMDPP_INL
+const C* find_last_byte(const C* first, const C* last, C value)
+{
+    const uint8_t* p = detail::find_bytes(first);
+    const uint8_t* r = detail::i_find_last(p, detail::find_bytes(last),
+                                           detail::find_byte_matcher(uint8_t(value)));
+    return first + (r - p);
+}
+
+/** Returns a pointer to the first element in the range [first, last) that is
+    equal to any of the elements in the range [set_first, set_last), or
+    @a last if there is no such element.
+
+    Sets of up to 16 elements are matched by looking up the low and high
+    nibbles of each byte in tables using permute_bytes16(). On instruction
+    sets that don't support permute_bytes16() each byte is compared with each
+    element of the set. Larger sets are matched one element at a time using a
+    lookup table.
+
+    The memory is accessed as in find_byte(). @a C must be a byte-sized type.
+*/
+template<class C> SIMDPP_INL
+const C* find_any_of(const C* first, const C* last,
+                     const C* set_first, const C* set_last)
+{
+    std::size_t set_size = set_last - set_first;
+    if (set_size == 0)
+        return last;
+
+    const uint8_t* set = detail::find_bytes(set_first);
+    if (set_size > 16) {
+        bool table[256] = {};
+        for (std::size_t i = 0; i < set_size; ++i)
+            table[set[i]] = true;
+        for (; first != last; ++first) {
+            if (table[uint8_t(*first)])
+                break;
+        }
+        return first;
+    }
+
+    const uint8_t* p = detail::find_bytes(first);
+    const uint8_t* r = detail::i_find_first(p, detail::find_bytes(last),
+                                            detail::find_set_matcher(set, unsigned(set_size)));
+    return first + (r - p);
+}
+
+/** Returns the number of elements in the range [first, last) that are equal
+    to @a value.
+
+    The comparison results are accumulated in 8-bit counters that are summed
+    every 255 vectors. The memory is accessed as in find_byte().
+
+    @a C must be a byte-sized type.
+*/
+template<class C> SIMDPP_INL
+std::size_t count_byte(const C* first, const C* last, C value)
+{
+    return detail::i_count(detail::find_bytes(first), detail::find_bytes(last),
+                           detail::find_byte_matcher(uint8_t(value)));
+}
+
+/** Returns the length of the null-terminated string @a s.
+
+    The memory is accessed as in find_byte(). The bytes after the terminating
+    null character may be read up to the end of the group of four vectors
+    containing it, but never across a page boundary.
+*/
+static SIMDPP_INL
+std::size_t strlen(const char* s)
+{
+    return detail::i_strlen(detail::find_bytes(s));
+}
+
+/** Returns the index of the first byte that differs in the memory regions
+    pointed to by @a a and @a b of @a size bytes each, or @a size if the
+    regions are equal.
+
+    The regions are compared using unaligned loads. The last partial vector
+    is loaded so that it overlaps the already compared bytes. If the regions
+    are shorter than a vector, the bytes past their end are read only if that
+    does not cross a page boundary, otherwise the bytes are compared one by
+    one.
+*/
+static SIMDPP_INL
+std::size_t find_first_mismatch(const void* a, const void* b, std::size_t size)
+{
+    return detail::i_find_first_mismatch(reinterpret_cast<const uint8_t*>(a),
+                                         reinterpret_cast<const uint8_t*>(b),
+                                         size);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,538 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_HASH_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_HASH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/splat.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+static const uint32_t xxh32_prime1 = 0x9e3779b1u;
+static const uint32_t xxh32_prime2 = 0x85ebca77u;
+static const uint32_t xxh32_prime3 = 0xc2b2ae3du;
+static const uint32_t xxh32_prime4 = 0x27d4eb2fu;
+static const uint32_t xxh32_prime5 = 0x165667b1u;
+
+static const uint64_t xxh64_prime1 = 0x9e3779b185ebca87ull;
+static const uint64_t xxh64_prime2 = 0xc2b2ae3d27d4eb4full;
+static const uint64_t xxh64_prime3 = 0x165667b19e3779f9ull;
+static const uint64_t xxh64_prime4 = 0x85ebca77c2b2ae63ull;
+static const uint64_t xxh64_prime5 = 0x27d4eb2f165667c5ull;
+
+// The library has no rotate instruction, thus it's composed of two shifts
+template<unsigned R, unsigned N> SIMDPP_INL
+uint32<N> hash_rotl(const uint32<N>& a)
+{
+    return bit_or(shift_l<R>(a), shift_r<32-R>(a));
+}
+
+template<unsigned R, unsigned N> SIMDPP_INL
+uint64<N> hash_rotl(const uint64<N>& a)
+{
+    return bit_or(shift_l<R>(a), shift_r<64-R>(a));
+}
+
+static SIMDPP_INL
+uint32_t hash_rotl32(uint32_t a, unsigned r)
+{
+    return (a << r) | (a >> (32 - r));
+}
+
+static SIMDPP_INL
+uint64_t hash_rotl64(uint64_t a, unsigned r)
+{
+    return (a << r) | (a >> (64 - r));
+}
+
+// The hashed data is read as little-endian regardless of the host. Compilers
+// recognize the pattern and emit single loads on little-endian hosts.
+static SIMDPP_INL
+uint32_t hash_read32(const uint8_t* p)
+{
+    return uint32_t(p[0]) | (uint32_t(p[1]) << 8) |
+           (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+}
+
+static SIMDPP_INL
+uint64_t hash_read64(const uint8_t* p)
+{
+    return uint64_t(hash_read32(p)) | (uint64_t(hash_read32(p + 4)) << 32);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_xxh32_avalanche(uint32<N> h)
+{
+    h = bit_xor(h, shift_r<15>(h));
+    h = mul_lo(h, xxh32_prime2);
+    h = bit_xor(h, shift_r<13>(h));
+    h = mul_lo(h, xxh32_prime3);
+    h = bit_xor(h, shift_r<16>(h));
+    return h;
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_xxh64_avalanche(uint64<N> h)
+{
+    h = bit_xor(h, shift_r<33>(h));
+    h = mul_lo(h, xxh64_prime2);
+    h = bit_xor(h, shift_r<29>(h));
+    h = mul_lo(h, xxh64_prime3);
+    h = bit_xor(h, shift_r<32>(h));
+    return h;
+}
+
+/*  The stripes of the bulk hashes are processed by four scalar accumulators
+    even though the algorithms were designed with 128-bit vectors in mind.
+    Each accumulator depends on two multiplications per stripe. The latency
+    of vector multiplications is 2-3 times larger than that of the scalar
+    ones, thus the four independent scalar dependency chains are faster than
+    a single vector chain.
+*/
+static SIMDPP_INL
+uint32_t xxh32_round(uint32_t acc, uint32_t input)
+{
+    acc += input * xxh32_prime2;
+    acc = hash_rotl32(acc, 13);
+    return acc * xxh32_prime1;
+}
+
+static SIMDPP_INL
+uint64_t xxh64_round(uint64_t acc, uint64_t input)
+{
+    acc += input * xxh64_prime2;
+    acc = hash_rotl64(acc, 31);
+    return acc * xxh64_prime1;
+}
+
+static SIMDPP_INL
+uint64_t xxh64_merge_round(uint64_t acc, uint64_t v)
+{
+    acc ^= xxh64_round(0, v);
+    return acc * xxh64_prime1 + xxh64_prime4;
+}
+
+static SIMDPP_INL
+uint32_t i_xxhash32(const uint8_t* p, std::size_t len, uint32_t seed)
+{
+    const uint8_t* end = p + len;
+    uint32_t h;
+
+    if (len >= 16) {
+        uint32_t v1 = seed + xxh32_prime1 + xxh32_prime2;
+        uint32_t v2 = seed + xxh32_prime2;
+        uint32_t v3 = seed;
+        uint32_t v4 = seed - xxh32_prime1;
+        do {
+            v1 = xxh32_round(v1, hash_read32(p));
+            v2 = xxh32_round(v2, hash_read32(p + 4));
+            v3 = xxh32_round(v3, hash_read32(p + 8));
+            v4 = xxh32_round(v4, hash_read32(p + 12));
+            p += 16;
+        } while (end - p >= 16);
+        h = hash_rotl32(v1, 1) + hash_rotl32(v2, 7) +
+            hash_rotl32(v3, 12) + hash_rotl32(v4, 18);
+    } else {
+        h = seed + xxh32_prime5;
+    }
+
+    h += uint32_t(len);
+    for (; end - p >= 4; p += 4) {
+        h += hash_read32(p) * xxh32_prime3;
+        h = hash_rotl32(h, 17) * xxh32_prime4;
+    }
+    for (; p != end; ++p) {
+        h += *p * xxh32_prime5;
+        h = hash_rotl32(h, 11) * xxh32_prime1;
+    }
+
+    h ^= h >> 15;
+    h *= xxh32_prime2;
+    h ^= h >> 13;
+    h *= xxh32_prime3;
+    h ^= h >> 16;
+    return h;
+}
+
+static SIMDPP_INL
+uint64_t i_xxhash64(const uint8_t* p, std::size_t len, uint64_t seed)
+{
+    const uint8_t* end = p + len;
+    uint64_t h;
+
+    if (len >= 32) {
+        uint64_t v1 = seed + xxh64_prime1 + xxh64_prime2;
+        uint64_t v2 = seed + xxh64_prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - xxh64_prime1;
+        do {
+            v1 = xxh64_round(v1, hash_read64(p));
+            v2 = xxh64_round(v2, hash_read64(p + 8));
+            v3 = xxh64_round(v3, hash_read64(p + 16));
+            v4 = xxh64_round(v4, hash_read64(p + 24));
+            p += 32;
+        } while (end - p >= 32);
+        h = hash_rotl64(v1, 1) + hash_rotl64(v2, 7) +
+            hash_rotl64(v3, 12) + hash_rotl64(v4, 18);
+        h = xxh64_merge_round(h, v1);
+        h = xxh64_merge_round(h, v2);
+        h = xxh64_merge_round(h, v3);
+        h = xxh64_merge_round(h, v4);
+    } else {
+        h = seed + xxh64_prime5;
+    }
+
+    h += uint64_t(len);
+    for (; end - p >= 8; p += 8) {
+        h ^= xxh64_round(0, hash_read64(p));
+        h = hash_rotl64(h, 27) * xxh64_prime1 + xxh64_prime4;
+    }
+    if (end - p >= 4) {
+        h ^= uint64_t(hash_read32(p)) * xxh64_prime1;
+        h = hash_rotl64(h, 23) * xxh64_prime2 + xxh64_prime3;
+        p += 4;
+    }
+    for (; p != end; ++p) {
+        h ^= *p * xxh64_prime5;
+        h = hash_rotl64(h, 11) * xxh64_prime1;
+    }
+
+    h ^= h >> 33;
+    h *= xxh64_prime2;
+    h ^= h >> 29;
+    h *= xxh64_prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+// The CRC32C (Castagnoli) polynomial in the reflected bit order
+static const uint32_t crc32c_poly = 0x82f63b78u;
+
+/*  The crc32 instruction has a latency of 3 cycles and a throughput of 1
+    instruction per cycle, thus long inputs are split into three parts that
+    are processed in parallel. The CRC of the first part is then shifted over
+    the length of the next one and combined with its CRC. The shift is a
+    multiplication by a constant in GF(2) which is applied using lookup
+    tables indexed by the bytes of the CRC.
+*/
+static const std::size_t crc32c_long = 8192;
+static const std::size_t crc32c_short = 256;
+
+struct crc32c_tables {
+    // The tables of the slicing-by-8 software algorithm
+    uint32_t slice[8][256];
+    // The tables that shift a CRC over crc32c_long and crc32c_short zero bytes
+    uint32_t shift_long[4][256];
+    uint32_t shift_short[4][256];
+
+    crc32c_tables()
+    {
+        for (unsigned n = 0; n < 256; ++n) {
+            uint32_t crc = n;
+            for (unsigned k = 0; k < 8; ++k)
+                crc = (crc & 1) ? (crc >> 1) ^ crc32c_poly : crc >> 1;
+            slice[0][n] = crc;
+        }
+        for (unsigned n = 0; n < 256; ++n) {
+            uint32_t crc = slice[0][n];
+            for (unsigned k = 1; k < 8; ++k) {
+                crc = slice[0][crc & 0xff] ^ (crc >> 8);
+                slice[k][n] = crc;
+            }
+        }
+        fill_shift(shift_long, crc32c_long);
+        fill_shift(shift_short, crc32c_short);
+    }
+
+    // Multiplies the vector by the 32x32 GF(2) matrix
+    static uint32_t matrix_times(const uint32_t* mat, uint32_t vec)
+    {
+        uint32_t sum = 0;
+        for (; vec != 0; vec >>= 1, ++mat) {
+            if (vec & 1)
+                sum ^= *mat;
+        }
+        return sum;
+    }
+
+    static void matrix_square(uint32_t* square, const uint32_t* mat)
+    {
+        for (unsigned n = 0; n < 32; ++n)
+            square[n] = matrix_times(mat, mat[n]);
+    }
+
+    // Computes the tables of the operator that appends len zero bytes. len
+    // must be a power of two.
+    static void fill_shift(uint32_t table[4][256], std::size_t len)
+    {
+        uint32_t op[32], tmp[32];
+        // the operator for a single zero bit
+        op[0] = crc32c_poly;
+        for (unsigned n = 1; n < 32; ++n)
+            op[n] = uint32_t(1) << (n - 1);
+        // square it until it covers len bytes, i.e. 8*len bits
+        for (std::size_t bits = 1; bits < len * 8; bits *= 2) {
+            matrix_square(tmp, op);
+            std::memcpy(op, tmp, sizeof(op));
+        }
+        for (unsigned n = 0; n < 256; ++n) {
+            table[0][n] = matrix_times(op, n);
+            table[1][n] = matrix_times(op, n << 8);
+            table[2][n] = matrix_times(op, n << 16);
+            table[3][n] = matrix_times(op, uint32_t(n) << 24);
+        }
+    }
+};
+
+SIMDPP_INL const crc32c_tables& i_get_crc32c_tables()
+{
+    static const crc32c_tables tables;
+    return tables;
+}
+
+static SIMDPP_INL
+uint32_t crc32c_shift(const uint32_t table[4][256], uint32_t crc)
+{
+    return table[0][crc & 0xff] ^ table[1][(crc >> 8) & 0xff] ^
+           table[2][(crc >> 16) & 0xff] ^ table[3][crc >> 24];
+}
+
+#if SIMDPP_USE_SSE4_2
+#if SIMDPP_64_BITS
+using crc32c_word = uint64_t;
+#else
+using crc32c_word = uint32_t;
+#endif
+
+static SIMDPP_INL
+uint32_t crc32c_update(uint32_t crc, const uint8_t* p)
+{
+    crc32c_word w;
+    std::memcpy(&w, p, sizeof(w));
+#if SIMDPP_64_BITS
+    return uint32_t(_mm_crc32_u64(crc, w));
+#else
+    return _mm_crc32_u32(crc, w);
+#endif
+}
+
+// Processes as many parts of 3*part_len bytes as possible
+static SIMDPP_INL
+uint32_t crc32c_update_3way(uint32_t crc, const uint8_t*& p, std::size_t& len,
+                            std::size_t part_len, const uint32_t table[4][256])
+{
+    while (len >= part_len * 3) {
+        uint32_t crc1 = 0, crc2 = 0;
+        const uint8_t* end = p + part_len;
+        do {
+            crc = crc32c_update(crc, p);
+            crc1 = crc32c_update(crc1, p + part_len);
+            crc2 = crc32c_update(crc2, p + part_len * 2);
+            p += sizeof(crc32c_word);
+        } while (p != end);
+        crc = crc32c_shift(table, crc) ^ crc1;
+        crc = crc32c_shift(table, crc) ^ crc2;
+        p += part_len * 2;
+        len -= part_len * 3;
+    }
+    return crc;
+}
+
+static SIMDPP_INL
+uint32_t i_crc32c(uint32_t crc, const uint8_t* p, std::size_t len)
+{
+    crc = ~crc;
+    if (len >= crc32c_short * 3) {
+        const crc32c_tables& tables = i_get_crc32c_tables();
+        crc = crc32c_update_3way(crc, p, len, crc32c_long, tables.shift_long);
+        crc = crc32c_update_3way(crc, p, len, crc32c_short, tables.shift_short);
+    }
+    for (; len >= sizeof(crc32c_word); len -= sizeof(crc32c_word)) {
+        crc = crc32c_update(crc, p);
+        p += sizeof(crc32c_word);
+    }
+    for (; len != 0; --len)
+        crc = _mm_crc32_u8(crc, *p++);
+    return ~crc;
+}
+#else
+static SIMDPP_INL
+uint32_t i_crc32c(uint32_t crc, const uint8_t* p, std::size_t len)
+{
+    const crc32c_tables& tables = i_get_crc32c_tables();
+    const uint32_t (&t)[8][256] = tables.slice;
+    crc = ~crc;
+    for (; len >= 8; len -= 8) {
+        crc ^= hash_read32(p);
+        uint32_t hi = hash_read32(p + 4);
+        crc = t[7][crc & 0xff] ^ t[6][(crc >> 8) & 0xff] ^
+              t[5][(crc >> 16) & 0xff] ^ t[4][crc >> 24] ^
+              t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+              t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+        p += 8;
+    }
+    for (; len != 0; --len)
+        crc = t[0][(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+#endif
+
+static SIMDPP_INL
+const uint8_t* hash_bytes(const char* p)
+{
+    return reinterpret_cast<const uint8_t*>(p);
+}
+
+} // namespace detail
+
+/** Applies the finalization step of MurmurHash3 to each element. The
+    function is a bijection that mixes all bits of the input into all bits
+    of the output, thus it's a fast hash for integer keys such as the ones
+    used for hash table lookups and partitioning.
+
+    @code
+    h ^= h >> 16; h *= 0x85ebca6b;
+    h ^= h >> 13; h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> murmur3_fmix(const uint32<N,E>& keys)
+{
+    uint32<N> h = keys;
+    h = bit_xor(h, shift_r<16>(h));
+    h = mul_lo(h, uint32_t(0x85ebca6b));
+    h = bit_xor(h, shift_r<13>(h));
+    h = mul_lo(h, uint32_t(0xc2b2ae35));
+    h = bit_xor(h, shift_r<16>(h));
+    return h;
+}
+
+/** Applies the 64-bit finalization step of MurmurHash3 to each element.
+
+    @code
+    h ^= h >> 33; h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    @endcode
+
+    64-bit multiplication is emulated using 32-bit multiplications on most
+    architectures except AVX-512DQ.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> murmur3_fmix(const uint64<N,E>& keys)
+{
+    uint64<N> h = keys;
+    h = bit_xor(h, shift_r<33>(h));
+    h = mul_lo(h, uint64_t(0xff51afd7ed558ccdull));
+    h = bit_xor(h, shift_r<33>(h));
+    h = mul_lo(h, uint64_t(0xc4ceb9fe1a85ec53ull));
+    h = bit_xor(h, shift_r<33>(h));
+    return h;
+}
+
+/** Computes the XXH32 hash of each element. The result is the same as that
+    of the bulk xxhash32() applied to the 4-byte little-endian representation
+    of the element, thus the keys may be hashed either way.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N> xxhash32(const uint32<N,E>& keys, uint32_t seed = 0)
+{
+    uint32<N> k = keys;
+    uint32<N> h = splat(seed + detail::xxh32_prime5 + 4);
+    h = add(h, mul_lo(k, detail::xxh32_prime3));
+    h = detail::hash_rotl<17>(h);
+    h = mul_lo(h, detail::xxh32_prime4);
+    return detail::i_xxh32_avalanche(h);
+}
+
+/** Computes the XXH64 hash of each element. The result is the same as that
+    of the bulk xxhash64() applied to the 8-byte little-endian representation
+    of the element.
+
+    64-bit multiplication is emulated using 32-bit multiplications on most
+    architectures except AVX-512DQ.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64<N> xxhash64(const uint64<N,E>& keys, uint64_t seed = 0)
+{
+    uint64<N> k = keys;
+    uint64<N> h = splat(seed + detail::xxh64_prime5 + 8);
+    k = mul_lo(k, detail::xxh64_prime2);
+    k = detail::hash_rotl<31>(k);
+    k = mul_lo(k, detail::xxh64_prime1);
+    h = bit_xor(h, k);
+    h = detail::hash_rotl<27>(h);
+    h = mul_lo(h, detail::xxh64_prime1);
+    h = add(h, uint64<N>(splat(detail::xxh64_prime4)));
+    return detail::i_xxh64_avalanche(h);
+}
+
+/** Computes the XXH32 hash of the bytes in the range [first, last). The
+    result is identical to that of the reference implementation on all
+    architectures.
+
+    The input is processed in stripes of 16 bytes by four independent
+    accumulators. The accumulators are kept in scalar registers, because the
+    multiplications within each stripe depend on each other and vector
+    multiplications have several times larger latency.
+*/
+static SIMDPP_INL
+uint32_t xxhash32(const char* first, const char* last, uint32_t seed = 0)
+{
+    return detail::i_xxhash32(detail::hash_bytes(first), last - first, seed);
+}
+
+/** Computes the XXH64 hash of the bytes in the range [first, last). The
+    result is identical to that of the reference implementation on all
+    architectures.
+
+    The input is processed in stripes of 32 bytes by four independent
+    accumulators in the same way as in xxhash32().
+*/
+static SIMDPP_INL
+uint64_t xxhash64(const char* first, const char* last, uint64_t seed = 0)
+{
+    return detail::i_xxhash64(detail::hash_bytes(first), last - first, seed);
+}
+
+/** Computes the CRC32C (Castagnoli) checksum of the bytes in the range
+    [first, last). @a crc is the checksum of the preceding data, thus the
+    checksum of data split into several ranges can be computed by passing the
+    result of each call to the next one.
+
+    The @c crc32 instruction is used on SSE4.2. Inputs of at least 768 bytes
+    are split into three parts that are processed in parallel, and then the
+    results are combined. Other architectures use the slicing-by-8 algorithm
+    that processes 8 bytes at a time using lookup tables.
+*/
+static SIMDPP_INL
+uint32_t crc32c(const char* first, const char* last, uint32_t crc = 0)
+{
+    return detail::i_crc32c(crc, detail::hash_bytes(first), last - first);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,118 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_SCAN_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_SCAN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/prefix_sum.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/traits.h>
+#include <cstddef>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the inclusive prefix sum of the elements in the range
+    [first, last) and stores it to the range starting at @a out. The output
+    range may be the same as the input range.
+
+    @code
+    out[0] = first[0]
+    out[1] = first[0] + first[1]
+    ...
+    out[N] = first[0] + first[1] + ... + first[N]
+    @endcode
+
+    The elements are processed in native vectors using prefix_sum(). The sum
+    of the preceding vectors is carried in a vector register. The elements
+    that do not fill a whole vector are processed one by one.
+
+    Integer sums wrap around on overflow. The floating-point sums are computed
+    in a different order than a sequential loop would, thus the results may
+    differ in the last bits.
+
+    @a T must be one of the 8, 16, 32 or 64-bit integer types or @c float or
+    @c double.
+*/
+template<class T> SIMDPP_INL
+void inclusive_scan(const T* first, const T* last, T* out)
+{
+    using V = typename detail::native_vector_for<T>::type;
+    const unsigned len = V::length;
+    std::size_t n = last - first;
+    std::size_t i = 0;
+
+    V carry = splat(T(0));
+    for (; i + len <= n; i += len) {
+        V v = load_u(first + i);
+        v = add(prefix_sum(v), carry);
+        store_u(out + i, v);
+        carry = splat<len-1>(v);
+    }
+
+    T sum = extract<0>(carry);
+    for (; i < n; ++i) {
+        sum = T(sum + first[i]);
+        out[i] = sum;
+    }
+}
+
+/** Computes the exclusive prefix sum of the elements in the range
+    [first, last) starting from @a init and stores it to the range starting at
+    @a out. The output range may be the same as the input range.
+
+    @code
+    out[0] = init
+    out[1] = init + first[0]
+    ...
+    out[N] = init + first[0] + ... + first[N-1]
+    @endcode
+
+    The exclusive sums are computed by subtracting the input elements from
+    the inclusive sums, see inclusive_scan() for details.
+*/
+template<class T> SIMDPP_INL
+void exclusive_scan(const T* first, const T* last, T* out, T init)
+{
+    using V = typename detail::native_vector_for<T>::type;
+    const unsigned len = V::length;
+    std::size_t n = last - first;
+    std::size_t i = 0;
+
+    V carry = splat(init);
+    for (; i + len <= n; i += len) {
+        V v = load_u(first + i);
+        V s = prefix_sum(v);
+        store_u(out + i, add(carry, sub(s, v)));
+        carry = add(carry, splat<len-1>(s));
+    }
+
+    T sum = extract<0>(carry);
+    for (; i < n; ++i) {
+        T el = first[i];
+        out[i] = sum;
+        sum = T(sum + el);
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
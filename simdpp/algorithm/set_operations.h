@@ -0,0 +1,497 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_SET_OPERATIONS_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_SET_OPERATIONS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/algorithm/sort.h>
+#include <simdpp/capabilities.h>
+#include <simdpp/core/align.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/extract.h>
+#include <simdpp/core/i_reduce_add.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute2.h>
+#include <simdpp/core/permute4.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/core/store_compress.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/insn/sort_network.h>
+#include <algorithm>
+#include <cstddef>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+// Returns a mask that is set for the elements of a that are equal to any
+// element of b within the same 128-bit lane
+template<unsigned N, class V> SIMDPP_INL
+mask_int32<N> set_match_any(const any_vec32<N,V>& a, const any_vec32<N,V>& b)
+{
+    const V& x = a.wrapped();
+    const V& y = b.wrapped();
+    return bit_or(bit_or(cmp_eq(x, y), cmp_eq(x, permute4<1,2,3,0>(y))),
+                  bit_or(cmp_eq(x, permute4<2,3,0,1>(y)),
+                         cmp_eq(x, permute4<3,0,1,2>(y))));
+}
+
+template<unsigned N, class V> SIMDPP_INL
+mask_int64<N> set_match_any(const any_vec64<N,V>& a, const any_vec64<N,V>& b)
+{
+    const V& x = a.wrapped();
+    const V& y = b.wrapped();
+    return bit_or(cmp_eq(x, y), cmp_eq(x, permute2<1,0>(y)));
+}
+
+// Moves the last element of a into the first element of the result followed
+// by the first elements of b
+template<unsigned N, class V> SIMDPP_INL
+V set_shift_in(const any_vec32<N,V>& a, const any_vec32<N,V>& b)
+{
+    return align4<3>(a.wrapped(), b.wrapped());
+}
+
+template<unsigned N, class V> SIMDPP_INL
+V set_shift_in(const any_vec64<N,V>& a, const any_vec64<N,V>& b)
+{
+    return align2<1>(a.wrapped(), b.wrapped());
+}
+
+// If one range is this many times longer than the other, the intersection
+// searches for the elements of the shorter range in the longer one and the
+// other operations use the scalar algorithms, whose branches are then
+// predictable
+static const std::size_t set_skew_ratio = 32;
+
+// Searches for each element of [a, a+na) in [b, b+nb) by exponential search
+// starting from the position of the previous element. Stores the found elements to out if Store
+// is set. Returns the number of the found elements.
+template<bool Store, class T> SIMDPP_INL
+std::size_t set_intersection_galloping(const T* a, std::size_t na,
+                                       const T* b, std::size_t nb, T* out)
+{
+    const T* b_end = b + nb;
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < na && b != b_end; ++i) {
+        T el = a[i];
+        std::size_t step = 1;
+        while (step < std::size_t(b_end - b) && b[step] < el) {
+            b += step;
+            step *= 2;
+        }
+        b = std::lower_bound(b, b + std::min(step, std::size_t(b_end - b)), el);
+        if (b != b_end && *b == el) {
+            if (Store)
+                out[count] = el;
+            ++count;
+            ++b;
+        }
+    }
+    return count;
+}
+
+static SIMDPP_INL
+bool set_is_skewed(std::size_t na, std::size_t nb)
+{
+    return na / set_skew_ratio > nb || nb / set_skew_ratio > na;
+}
+
+/*  The set operations compare one vector from each range with all elements
+    of the other vector by rotating it. The range whose current vector ends
+    with a smaller or equal element is advanced. Because the elements within
+    each range are unique, each element is matched in exactly one step.
+    Once a range runs out of whole vectors, the remaining elements are
+    processed one by one.
+
+    The elements of a vector are stored by store_compress_unsafe_tail() as
+    long as the whole vector fits into the space that the output range is
+    required to have.
+*/
+template<class T> SIMDPP_INL
+T* set_intersection_impl(const T* a, std::size_t na,
+                         const T* b, std::size_t nb, T* out)
+{
+    using V = typename sort_vector_for<T>::type;
+    const unsigned len = V::length;
+
+    if (set_is_skewed(na, nb)) {
+        if (na > nb)
+            return out + set_intersection_galloping<true>(b, nb, a, na, out);
+        return out + set_intersection_galloping<true>(a, na, b, nb, out);
+    }
+
+    std::size_t i = 0, j = 0;
+    if (na >= len && nb >= len) {
+        T* out_limit = out + std::min(na, nb) - len;
+        V va = load_u(a);
+        V vb = load_u(b);
+        for (;;) {
+            if (out <= out_limit)
+                out += store_compress_unsafe_tail(out, va, set_match_any(va, vb));
+            else
+                out += store_compress(out, va, set_match_any(va, vb));
+
+            T a_max = a[i + len - 1];
+            T b_max = b[j + len - 1];
+            if (a_max <= b_max) {
+                i += len;
+                if (i + len > na)
+                    break;
+                va = load_u(a + i);
+            }
+            if (b_max <= a_max) {
+                j += len;
+                if (j + len > nb)
+                    break;
+                vb = load_u(b + j);
+            }
+        }
+    }
+    // The elements of the current vectors that have already been matched
+    // won't match again
+    return std::set_intersection(a + i, a + na, b + j, b + nb, out);
+}
+
+template<class T> SIMDPP_INL
+std::size_t set_intersection_size_impl(const T* a, std::size_t na,
+                                       const T* b, std::size_t nb)
+{
+    using V = typename sort_vector_for<T>::type;
+    using U = typename sort_vector_for<T>::uint_type;
+    const unsigned len = V::length;
+
+    if (set_is_skewed(na, nb)) {
+        if (na > nb)
+            return set_intersection_galloping<false, T>(b, nb, a, na, nullptr);
+        return set_intersection_galloping<false, T>(a, na, b, nb, nullptr);
+    }
+
+    std::size_t i = 0, j = 0;
+    std::size_t count = 0;
+    if (na >= len && nb >= len) {
+        V va = load_u(a);
+        V vb = load_u(b);
+        // the set mask elements are equal to -1, thus subtracting them
+        // counts the matches
+        U counts = make_uint(0);
+        for (;;) {
+            counts = sub(counts, bit_cast<U>(set_match_any(va, vb)));
+
+            T a_max = a[i + len - 1];
+            T b_max = b[j + len - 1];
+            if (a_max <= b_max) {
+                i += len;
+                if (i + len > na)
+                    break;
+                va = load_u(a + i);
+            }
+            if (b_max <= a_max) {
+                j += len;
+                if (j + len > nb)
+                    break;
+                vb = load_u(b + j);
+            }
+        }
+        count = reduce_add(counts);
+    }
+
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            ++i;
+        } else if (b[j] < a[i]) {
+            ++j;
+        } else {
+            ++count; ++i; ++j;
+        }
+    }
+    return count;
+}
+
+template<class T> SIMDPP_INL
+T* set_difference_impl(const T* a, std::size_t na,
+                       const T* b, std::size_t nb, T* out)
+{
+    using V = typename sort_vector_for<T>::type;
+    using M = typename sort_vector_for<T>::mask_type;
+    const unsigned len = V::length;
+
+    if (set_is_skewed(na, nb))
+        return std::set_difference(a, a + na, b, b + nb, out);
+
+    std::size_t i = 0, j = 0;
+    if (na >= len && nb >= len) {
+        // the output doesn't run ahead of the current position in a, thus va
+        // can be stored whole
+        V va = load_u(a);
+        V vb = load_u(b);
+        // the elements of va that have been matched in any vector of b
+        M found = cmp_neq(va, va);
+        for (;;) {
+            found = bit_or(found, set_match_any(va, vb));
+
+            T a_max = a[i + len - 1];
+            T b_max = b[j + len - 1];
+            if (a_max <= b_max) {
+                out += store_compress_unsafe_tail(out, va,
+                                                  bit_andnot(cmp_eq(va, va), found));
+                found = cmp_neq(va, va);
+                i += len;
+                if (i + len > na)
+                    break;
+                va = load_u(a + i);
+            }
+            if (b_max <= a_max) {
+                j += len;
+                if (j + len > nb) {
+                    // The elements of va that have been matched must not be
+                    // stored. The rest are processed one by one.
+                    T els[len], matched[len];
+                    store_u(els, va);
+                    store_u(matched, bit_cast<V>(found));
+                    for (unsigned k = 0; k < len; ++k) {
+                        T el = els[k];
+                        if (matched[k] != 0)
+                            continue;
+                        while (j < nb && b[j] < el)
+                            ++j;
+                        if (j < nb && b[j] == el)
+                            ++j;
+                        else
+                            *out++ = el;
+                    }
+                    i += len;
+                    break;
+                }
+                vb = load_u(b + j);
+            }
+        }
+    }
+    return std::set_difference(a + i, a + na, b + j, b + nb, out);
+}
+
+/*  The union is computed by merging the two ranges as in sort() and then
+    removing the duplicate elements. Because the elements within each range
+    are unique, each element occurs at most twice in the merged sequence.
+    The stored elements and the four vectors in the registers never outnumber
+    the loaded elements, thus the vectors can be stored whole.
+*/
+template<class T> SIMDPP_INL
+T* set_union_impl(const T* a, std::size_t na,
+                  const T* b, std::size_t nb, T* out)
+{
+    using V = typename sort_vector_for<T>::type;
+    const unsigned len = V::length;
+    const unsigned step = 2 * len;
+
+    if (na < step || nb < step || set_is_skewed(na, nb)) {
+        return std::set_union(a, a + na, b, b + nb, out);
+    }
+
+    V va0 = load_u(a);
+    V va1 = load_u(a + len);
+    V vb0 = load_u(b);
+    V vb1 = load_u(b + len);
+    std::size_t ia = step, ib = step;
+
+    // any value not equal to the first output element
+    V last = splat(T(std::min(a[0], b[0]) - 1));
+    for (;;) {
+        insn::i_sort_net_merge4(va0, va1, vb0, vb1);
+        out += store_compress_unsafe_tail(out, va0,
+                                          cmp_neq(va0, set_shift_in(last, va0)));
+        out += store_compress_unsafe_tail(out, va1,
+                                          cmp_neq(va1, set_shift_in(va0, va1)));
+        last = va1;
+
+        const T* next;
+        if (ia < na && (ib == nb || a[ia] <= b[ib])) {
+            if (ia + step > na)
+                break;
+            next = a + ia;
+            ia += step;
+        } else {
+            if (ib + step > nb)
+                break;
+            next = b + ib;
+            ib += step;
+        }
+        va0 = load_u(next);
+        va1 = load_u(next + len);
+    }
+
+    // Merge the remaining elements of the two ranges and the elements in
+    // vb0, vb1 as in sort_merge() and then remove the duplicates, including
+    // the elements equal to the last stored element.
+    T buf[step];
+    store_u(buf, vb0);
+    store_u(buf + len, vb1);
+    std::size_t ra = na - ia, rb = nb - ib;
+    sort_merge_scalar(a + ia, ra, b + ib, rb, out + step);
+    sort_merge_scalar(buf, step, out + step, ra + rb, out);
+
+    T prev = extract<len-1>(last);
+    T* end = out + step + ra + rb;
+    T* r = out;
+    for (T* p = out; p != end; ++p) {
+        if (*p != prev) {
+            prev = *p;
+            *r++ = prev;
+        }
+    }
+    return r;
+}
+
+template<class T> SIMDPP_INL
+T* merge_sorted_impl(const T* a, std::size_t na,
+                     const T* b, std::size_t nb, T* out)
+{
+    if (set_is_skewed(na, nb))
+        return std::merge(a, a + na, b, b + nb, out);
+    sort_merge(a, na, b, nb, out);
+    return out + na + nb;
+}
+
+// Without native or comparison-based min() and max() of 64-bit elements the
+// merge network is slower than the scalar merge
+#if !SIMDPP_HAS_INT64_MIN_MAX
+static SIMDPP_INL
+uint64_t* set_union_impl(const uint64_t* a, std::size_t na,
+                         const uint64_t* b, std::size_t nb, uint64_t* out)
+{
+    return std::set_union(a, a + na, b, b + nb, out);
+}
+
+static SIMDPP_INL
+uint64_t* merge_sorted_impl(const uint64_t* a, std::size_t na,
+                            const uint64_t* b, std::size_t nb, uint64_t* out)
+{
+    return std::merge(a, a + na, b, b + nb, out);
+}
+#endif
+
+} // namespace detail
+
+/** Merges the sorted ranges [first1, last1) and [first2, last2) into the
+    range starting at @a out. Returns the end of the output range.
+
+    The elements are merged as in sort(). If one range is more than 32 times
+    longer than the other, std::merge is used instead. The output range must
+    not overlap the input ranges.
+
+    @a T must be either @c uint32_t or @c uint64_t. The 64-bit elements are
+    merged by std::merge on instruction sets that don't support min() and
+    max() of 64-bit integers (see SIMDPP_HAS_INT64_MIN_MAX).
+*/
+template<class T> SIMDPP_INL
+T* merge_sorted(const T* first1, const T* last1,
+                const T* first2, const T* last2, T* out)
+{
+    return detail::merge_sorted_impl(first1, last1 - first1,
+                                     first2, last2 - first2, out);
+}
+
+/** Stores the elements that are present in both of the sorted ranges
+    [first1, last1) and [first2, last2) to the range starting at @a out.
+    Returns the end of the output range.
+
+    The elements within each input range must be unique. The output range
+    must not overlap the input ranges and must have space for as many
+    elements as the shorter input range has. The elements past the end of
+    the returned range may be overwritten.
+
+    Each vector of one range is compared with all rotations of a vector of
+    the other range. The matching elements are stored by
+    store_compress_unsafe_tail(). If one range is more than 32 times longer
+    than the other, each element of the shorter range is searched for in the
+    longer range by exponential search instead.
+
+    @a T must be either @c uint32_t or @c uint64_t.
+*/
+template<class T> SIMDPP_INL
+T* set_intersection(const T* first1, const T* last1,
+                    const T* first2, const T* last2, T* out)
+{
+    return detail::set_intersection_impl(first1, last1 - first1,
+                                         first2, last2 - first2, out);
+}
+
+/** Returns the number of elements that are present in both of the sorted
+    ranges [first1, last1) and [first2, last2).
+
+    The elements within each input range must be unique. See
+    set_intersection() for details.
+*/
+template<class T> SIMDPP_INL
+std::size_t set_intersection_size(const T* first1, const T* last1,
+                                  const T* first2, const T* last2)
+{
+    return detail::set_intersection_size_impl(first1, last1 - first1,
+                                              first2, last2 - first2);
+}
+
+/** Stores the elements that are present in any of the sorted ranges
+    [first1, last1) and [first2, last2) to the range starting at @a out.
+    Returns the end of the output range.
+
+    The elements within each input range must be unique. The output range
+    must not overlap the input ranges and must have space for all elements
+    of both input ranges.
+
+    The ranges are merged as in merge_sorted() and the duplicate elements are
+    removed using store_compress_unsafe_tail(). The elements past the end of
+    the returned range may be overwritten. If one range is more than 32 times
+    longer than the other, std::set_union is used instead.
+
+    @a T must be either @c uint32_t or @c uint64_t. The 64-bit elements are
+    processed by std::set_union on instruction sets that don't support min()
+    and max() of 64-bit integers (see SIMDPP_HAS_INT64_MIN_MAX).
+*/
+template<class T> SIMDPP_INL
+T* set_union(const T* first1, const T* last1,
+             const T* first2, const T* last2, T* out)
+{
+    return detail::set_union_impl(first1, last1 - first1,
+                                  first2, last2 - first2, out);
+}
+
+/** Stores the elements of the sorted range [first1, last1) that are not
+    present in the sorted range [first2, last2) to the range starting at
+    @a out. Returns the end of the output range.
+
+    The elements within each input range must be unique. The output range
+    must not overlap the input ranges and must have space for all elements
+    of the first input range. The elements past the end of the returned range
+    may be overwritten. See set_intersection() for details. If one range is
+    more than 32 times longer than the other, std::set_difference is used
+    instead.
+
+    @a T must be either @c uint32_t or @c uint64_t.
+*/
+template<class T> SIMDPP_INL
+T* set_difference(const T* first1, const T* last1,
+                  const T* first2, const T* last2, T* out)
+{
+    return detail::set_difference_impl(first1, last1 - first1,
+                                       first2, last2 - first2, out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,520 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_SORT_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_SORT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/capabilities.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/sort_network.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/insn/sort_network.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+// The vector types used to sort the elements of type T
+template<class T> struct sort_vector_for;
+
+template<> struct sort_vector_for<int32_t> {
+    using type = int32<4>; using uint_type = uint32<4>; using mask_type = mask_int32<4>;
+};
+template<> struct sort_vector_for<uint32_t> {
+    using type = uint32<4>; using uint_type = uint32<4>; using mask_type = mask_int32<4>;
+};
+template<> struct sort_vector_for<int64_t> {
+    using type = int64<2>; using uint_type = uint64<2>; using mask_type = mask_int64<2>;
+};
+template<> struct sort_vector_for<uint64_t> {
+    using type = uint64<2>; using uint_type = uint64<2>; using mask_type = mask_int64<2>;
+};
+
+// Merges the sorted ranges [a, a+na) and [b, b+nb) into out. The range b may
+// overlap the end of the output range as long as b >= out + na.
+template<class T> SIMDPP_INL
+void sort_merge_scalar(const T* a, std::size_t na,
+                       const T* b, std::size_t nb, T* out)
+{
+    const T* a_end = a + na;
+    const T* b_end = b + nb;
+    while (a != a_end && b != b_end) {
+        if (*b < *a)
+            *out++ = *b++;
+        else
+            *out++ = *a++;
+    }
+    while (a != a_end)
+        *out++ = *a++;
+    while (b != b_end)
+        *out++ = *b++;
+}
+
+/*  Merges the sorted ranges [a, a+na) and [b, b+nb) into out. The output
+    range must not overlap the input ranges.
+
+    Two vectors from each range are merged by a bitonic network. The lower
+    half of the result is stored and the next two vectors are loaded from the
+    range whose next element is smaller. Once that range runs out of whole
+    vectors, the remaining elements are merged one by one.
+*/
+template<class T> SIMDPP_INL
+void sort_merge(const T* a, std::size_t na,
+                const T* b, std::size_t nb, T* out)
+{
+    using V = typename sort_vector_for<T>::type;
+    const unsigned len = V::length;
+    const unsigned step = 2 * len;
+
+    if (na < step || nb < step) {
+        sort_merge_scalar(a, na, b, nb, out);
+        return;
+    }
+
+    V va0 = load_u(a);
+    V va1 = load_u(a + len);
+    V vb0 = load_u(b);
+    V vb1 = load_u(b + len);
+    std::size_t ia = step, ib = step;
+    for (;;) {
+        insn::i_sort_net_merge4(va0, va1, vb0, vb1);
+        store_u(out, va0);
+        store_u(out + len, va1);
+        out += step;
+
+        const T* next;
+        if (ia < na && (ib == nb || a[ia] <= b[ib])) {
+            if (ia + step > na)
+                break;
+            next = a + ia;
+            ia += step;
+        } else {
+            if (ib + step > nb)
+                break;
+            next = b + ib;
+            ib += step;
+        }
+        va0 = load_u(next);
+        va1 = load_u(next + len);
+    }
+
+    // All remaining elements are not smaller than the elements already
+    // stored. Merge the elements of the two ranges into the end of the output
+    // range first and then merge the result with the elements in vb0, vb1.
+    T buf[step];
+    store_u(buf, vb0);
+    store_u(buf + len, vb1);
+    std::size_t ra = na - ia, rb = nb - ib;
+    sort_merge_scalar(a + ia, ra, b + ib, rb, out + step);
+    sort_merge_scalar(buf, step, out + step, ra + rb, out);
+}
+
+/*  Sorts the elements in data using tmp as a temporary buffer of the same
+    size. Returns a pointer to the buffer containing the sorted data.
+
+    The blocks of 4 vectors are sorted by sort_network() and then merged
+    pairwise until a single sorted run remains.
+*/
+template<class T> SIMDPP_INL
+T* sort_merge_runs(T* data, T* tmp, std::size_t n)
+{
+    using V = typename sort_vector_for<T>::type;
+    const std::size_t len = V::length;
+    const std::size_t block = 4 * len;
+
+    std::size_t i = 0;
+    for (; i + block <= n; i += block) {
+        V a0 = load_u(data + i);
+        V a1 = load_u(data + i + len);
+        V a2 = load_u(data + i + 2 * len);
+        V a3 = load_u(data + i + 3 * len);
+        sort_network(a0, a1, a2, a3);
+        store_u(data + i, a0);
+        store_u(data + i + len, a1);
+        store_u(data + i + 2 * len, a2);
+        store_u(data + i + 3 * len, a3);
+    }
+
+    // The remaining elements are padded to whole vectors with the largest
+    // value and sorted by a network of one to four vectors
+    std::size_t rem = n - i;
+    if (rem > 0) {
+        T buf[block];
+        std::fill(buf, buf + block, std::numeric_limits<T>::max());
+        std::copy(data + i, data + n, buf);
+        V a0 = load_u(buf);
+        V a1 = load_u(buf + len);
+        V a2 = load_u(buf + 2 * len);
+        V a3 = load_u(buf + 3 * len);
+        if (rem <= len) {
+            sort_network(a0);
+        } else if (rem <= 2 * len) {
+            sort_network(a0, a1);
+        } else if (rem <= 3 * len) {
+            sort_network(a0, a1, a2);
+        } else {
+            sort_network(a0, a1, a2, a3);
+        }
+        store_u(buf, a0);
+        store_u(buf + len, a1);
+        store_u(buf + 2 * len, a2);
+        store_u(buf + 3 * len, a3);
+        std::copy(buf, buf + rem, data + i);
+    }
+
+    T* src = data;
+    T* dst = tmp;
+    for (std::size_t width = block; width < n; width *= 2) {
+        for (std::size_t j = 0; j < n; j += 2 * width) {
+            std::size_t na = std::min(width, n - j);
+            std::size_t nb = std::min(width, n - j - na);
+            sort_merge(src + j, na, src + j + na, nb, dst + j);
+        }
+        std::swap(src, dst);
+    }
+    return src;
+}
+
+template<class T> SIMDPP_INL
+void sort_integers(T* first, T* last)
+{
+    std::size_t n = last - first;
+    std::vector<T> tmp(n);
+    T* r = sort_merge_runs(first, tmp.data(), n);
+    if (r != first)
+        std::copy(r, r + n, first);
+}
+
+static SIMDPP_INL void i_sort(int32_t* first, int32_t* last) { sort_integers(first, last); }
+static SIMDPP_INL void i_sort(uint32_t* first, uint32_t* last) { sort_integers(first, last); }
+#if SIMDPP_HAS_INT64_MIN_MAX
+static SIMDPP_INL void i_sort(int64_t* first, int64_t* last) { sort_integers(first, last); }
+static SIMDPP_INL void i_sort(uint64_t* first, uint64_t* last) { sort_integers(first, last); }
+#else
+static SIMDPP_INL void i_sort(int64_t* first, int64_t* last) { std::sort(first, last); }
+static SIMDPP_INL void i_sort(uint64_t* first, uint64_t* last) { std::sort(first, last); }
+#endif
+
+// Converts the bits of a floating-point number to a signed integer that has
+// the same ordering. Negative zero is ordered before positive zero, the NaNs
+// with the sign bit set before all other values and the rest of the NaNs
+// after all other values. The conversion is its own inverse.
+static SIMDPP_INL
+uint32_t sort_float_order(uint32_t x)
+{
+    return x ^ ((0u - (x >> 31)) >> 1);
+}
+
+static SIMDPP_INL
+uint64_t sort_float_order(uint64_t x)
+{
+    return x ^ ((0u - (x >> 63)) >> 1);
+}
+
+template<class T, class I> SIMDPP_INL
+void sort_floats(T* first, T* last)
+{
+    std::size_t n = last - first;
+    std::vector<I> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        typename std::make_unsigned<I>::type bits;
+        std::memcpy(&bits, first + i, sizeof(bits));
+        data[i] = I(sort_float_order(bits));
+    }
+    i_sort(data.data(), data.data() + n);
+    for (std::size_t i = 0; i < n; ++i) {
+        typename std::make_unsigned<I>::type bits = sort_float_order(
+                    typename std::make_unsigned<I>::type(data[i]));
+        std::memcpy(first + i, &bits, sizeof(bits));
+    }
+}
+
+static SIMDPP_INL void i_sort(float* first, float* last) { sort_floats<float, int32_t>(first, last); }
+#if SIMDPP_HAS_INT64_MIN_MAX
+static SIMDPP_INL void i_sort(double* first, double* last) { sort_floats<double, int64_t>(first, last); }
+#else
+// The total order comparison is considerably slower than the comparison of
+// doubles, thus std::sort with the latter is used unless there are NaNs. Then
+// only the negative and positive zeros need to be put into order.
+struct sort_float_less {
+    bool operator()(double a, double b) const
+    {
+        uint64_t ba, bb;
+        std::memcpy(&ba, &a, sizeof(ba));
+        std::memcpy(&bb, &b, sizeof(bb));
+        return int64_t(sort_float_order(ba)) < int64_t(sort_float_order(bb));
+    }
+};
+
+static SIMDPP_INL void i_sort(double* first, double* last)
+{
+    bool has_nan = false;
+    for (double* i = first; i != last; ++i)
+        has_nan |= *i != *i;
+    if (has_nan) {
+        std::sort(first, last, sort_float_less());
+        return;
+    }
+
+    std::sort(first, last);
+    std::pair<double*, double*> zeros = std::equal_range(first, last, 0.0);
+    std::partition(zeros.first, zeros.second,
+                   [](double x) { return std::signbit(x); });
+}
+#endif
+
+// Converts a 32-bit key to bits that have the same ordering when interpreted
+// as a signed integer
+static SIMDPP_INL uint32_t sort_key_order(int32_t x) { return uint32_t(x); }
+static SIMDPP_INL uint32_t sort_key_order(uint32_t x) { return x ^ 0x80000000; }
+static SIMDPP_INL uint32_t sort_key_order(float x)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return sort_float_order(bits);
+}
+
+static SIMDPP_INL void sort_key_restore(uint32_t x, int32_t& r) { r = int32_t(x); }
+static SIMDPP_INL void sort_key_restore(uint32_t x, uint32_t& r) { r = x ^ 0x80000000; }
+static SIMDPP_INL void sort_key_restore(uint32_t x, float& r)
+{
+    uint32_t bits = sort_float_order(x);
+    std::memcpy(&r, &bits, sizeof(bits));
+}
+
+using sort_kv_keys = int32<4>;
+using sort_kv_values = uint32<4>;
+
+static SIMDPP_INL
+void sort_kv_insertion(int32_t* keys, uint32_t* values, std::size_t n)
+{
+    for (std::size_t i = 1; i < n; ++i) {
+        int32_t k = keys[i];
+        uint32_t v = values[i];
+        std::size_t j = i;
+        for (; j != 0 && k < keys[j - 1]; --j) {
+            keys[j] = keys[j - 1];
+            values[j] = values[j - 1];
+        }
+        keys[j] = k;
+        values[j] = v;
+    }
+}
+
+// Same as sort_merge_scalar, the values are moved together with the keys
+static SIMDPP_INL
+void sort_kv_merge_scalar(const int32_t* ka, const uint32_t* va, std::size_t na,
+                          const int32_t* kb, const uint32_t* vb, std::size_t nb,
+                          int32_t* kout, uint32_t* vout)
+{
+    std::size_t ia = 0, ib = 0;
+    while (ia != na && ib != nb) {
+        if (kb[ib] < ka[ia]) {
+            *kout++ = kb[ib];
+            *vout++ = vb[ib++];
+        } else {
+            *kout++ = ka[ia];
+            *vout++ = va[ia++];
+        }
+    }
+    for (; ia != na; ++ia) {
+        *kout++ = ka[ia];
+        *vout++ = va[ia];
+    }
+    for (; ib != nb; ++ib) {
+        *kout++ = kb[ib];
+        *vout++ = vb[ib];
+    }
+}
+
+// Same as sort_merge, the values are moved together with the keys
+static SIMDPP_INL
+void sort_kv_merge(const int32_t* ka, const uint32_t* va, std::size_t na,
+                   const int32_t* kb, const uint32_t* vb, std::size_t nb,
+                   int32_t* kout, uint32_t* vout)
+{
+    const unsigned len = sort_kv_keys::length;
+    const unsigned step = 2 * len;
+
+    if (na < step || nb < step) {
+        sort_kv_merge_scalar(ka, va, na, kb, vb, nb, kout, vout);
+        return;
+    }
+
+    sort_kv_keys ka0 = load_u(ka), ka1 = load_u(ka + len);
+    sort_kv_keys kb0 = load_u(kb), kb1 = load_u(kb + len);
+    sort_kv_values va0 = load_u(va), va1 = load_u(va + len);
+    sort_kv_values vb0 = load_u(vb), vb1 = load_u(vb + len);
+    std::size_t ia = step, ib = step;
+    for (;;) {
+        insn::i_sort_net_kv_merge4(ka0, va0, ka1, va1, kb0, vb0, kb1, vb1);
+        store_u(kout, ka0);
+        store_u(kout + len, ka1);
+        store_u(vout, va0);
+        store_u(vout + len, va1);
+        kout += step;
+        vout += step;
+
+        std::size_t next;
+        const int32_t* knext;
+        const uint32_t* vnext;
+        if (ia < na && (ib == nb || ka[ia] <= kb[ib])) {
+            if (ia + step > na)
+                break;
+            next = ia;
+            knext = ka;
+            vnext = va;
+            ia += step;
+        } else {
+            if (ib + step > nb)
+                break;
+            next = ib;
+            knext = kb;
+            vnext = vb;
+            ib += step;
+        }
+        ka0 = load_u(knext + next);
+        ka1 = load_u(knext + next + len);
+        va0 = load_u(vnext + next);
+        va1 = load_u(vnext + next + len);
+    }
+
+    int32_t kbuf[step];
+    uint32_t vbuf[step];
+    store_u(kbuf, kb0);
+    store_u(kbuf + len, kb1);
+    store_u(vbuf, vb0);
+    store_u(vbuf + len, vb1);
+    std::size_t ra = na - ia, rb = nb - ib;
+    sort_kv_merge_scalar(ka + ia, va + ia, ra, kb + ib, vb + ib, rb,
+                         kout + step, vout + step);
+    sort_kv_merge_scalar(kbuf, vbuf, step, kout + step, vout + step, ra + rb,
+                         kout, vout);
+}
+
+/*  Same as sort_merge_runs, the values are moved together with the keys.
+    Returns whether the sorted data is in the temporary buffers.
+*/
+static SIMDPP_INL
+bool sort_kv_merge_runs(int32_t* keys, uint32_t* values,
+                        int32_t* ktmp, uint32_t* vtmp, std::size_t n)
+{
+    const std::size_t len = sort_kv_keys::length;
+    const std::size_t block = 4 * len;
+
+    std::size_t i = 0;
+    for (; i + block <= n; i += block) {
+        sort_kv_keys k0 = load_u(keys + i), k1 = load_u(keys + i + len),
+                k2 = load_u(keys + i + 2 * len), k3 = load_u(keys + i + 3 * len);
+        sort_kv_values v0 = load_u(values + i), v1 = load_u(values + i + len),
+                v2 = load_u(values + i + 2 * len), v3 = load_u(values + i + 3 * len);
+        insn::i_sort_net_kv_network(k0, v0, k1, v1, k2, v2, k3, v3);
+        store_u(keys + i, k0);
+        store_u(keys + i + len, k1);
+        store_u(keys + i + 2 * len, k2);
+        store_u(keys + i + 3 * len, k3);
+        store_u(values + i, v0);
+        store_u(values + i + len, v1);
+        store_u(values + i + 2 * len, v2);
+        store_u(values + i + 3 * len, v3);
+    }
+    sort_kv_insertion(keys + i, values + i, n - i);
+
+    bool in_tmp = false;
+    for (std::size_t width = block; width < n; width *= 2) {
+        int32_t* ksrc = in_tmp ? ktmp : keys;
+        uint32_t* vsrc = in_tmp ? vtmp : values;
+        int32_t* kdst = in_tmp ? keys : ktmp;
+        uint32_t* vdst = in_tmp ? values : vtmp;
+        for (std::size_t j = 0; j < n; j += 2 * width) {
+            std::size_t na = std::min(width, n - j);
+            std::size_t nb = std::min(width, n - j - na);
+            sort_kv_merge(ksrc + j, vsrc + j, na,
+                          ksrc + j + na, vsrc + j + na, nb,
+                          kdst + j, vdst + j);
+        }
+        in_tmp = !in_tmp;
+    }
+    return in_tmp;
+}
+
+} // namespace detail
+
+/** Sorts the elements in the range [first, last) in ascending order.
+
+    The range is split into blocks of four 128-bit vectors that are sorted by
+    sort_network(). The sorted blocks are then merged pairwise by a bitonic
+    merge network until a single sorted run remains. A temporary buffer of
+    the size of the range is allocated. The sort is not stable.
+
+    The floating-point numbers are sorted according to the IEEE 754 total
+    order: negative zero is ordered before positive zero, NaNs with the sign
+    bit set are ordered before all other values and the rest of the NaNs after
+    all other values.
+
+    @a T must be one of @c int32_t, @c uint32_t, @c int64_t, @c uint64_t,
+    @c float or @c double. The 64-bit elements are sorted by std::sort on
+    instruction sets that don't support min() and max() of 64-bit integers
+    (see SIMDPP_HAS_INT64_MIN_MAX).
+*/
+template<class T> SIMDPP_INL
+void sort(T* first, T* last)
+{
+    detail::i_sort(first, last);
+}
+
+/** Sorts the keys in the range [first, last) in ascending order and reorders
+    the 32-bit values in the range starting at @a values in the same way.
+
+    The keys are sorted in the same way as in sort() and the values are moved
+    by the same permutations and blends as their keys. Two temporary buffers
+    of twice the size of the range are allocated. The sort is not stable, the
+    order of the values of equal keys is unspecified.
+
+    @a K must be one of @c int32_t, @c uint32_t or @c float. @a P must be a
+    trivially copyable 32-bit type. The keys are ordered as described in
+    sort().
+*/
+template<class K, class P> SIMDPP_INL
+void sort_by_key(K* first, K* last, P* values)
+{
+    static_assert(sizeof(K) == 4, "Only 32-bit keys are supported");
+    static_assert(sizeof(P) == 4, "Only 32-bit values are supported");
+
+    std::size_t n = last - first;
+    std::vector<int32_t> keys(2 * n);
+    std::vector<uint32_t> vals(2 * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        keys[i] = int32_t(detail::sort_key_order(first[i]));
+        std::memcpy(&vals[i], values + i, sizeof(uint32_t));
+    }
+    bool in_tmp = detail::sort_kv_merge_runs(keys.data(), vals.data(),
+                                             keys.data() + n, vals.data() + n, n);
+    std::size_t offset = in_tmp ? n : 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        detail::sort_key_restore(uint32_t(keys[offset + i]), first[i]);
+        std::memcpy(values + i, &vals[offset + i], sizeof(uint32_t));
+    }
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
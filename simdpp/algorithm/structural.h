@@ -0,0 +1,374 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_STRUCTURAL_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_STRUCTURAL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/algorithm/find.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/detail/bit_scan.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  The input is processed in blocks of 64 bytes. Each kind of character is
+    represented by a 64-bit mask with the i-th bit set if the i-th byte of the
+    block is of that kind. The state carried between the blocks is kept in
+    the same form, thus the masks of consecutive blocks are joined by shifts
+    of single bits.
+*/
+static const unsigned structural_block_size = 64;
+
+// Returns the mask of the set bytes of m, which is the i-th vector of a block
+static SIMDPP_INL
+uint64_t structural_bits(const find_vector& m, unsigned i)
+{
+    return uint64_t(find_bits(m)) << (i * find_vector::length);
+}
+
+class structural_block {
+public:
+    static const unsigned size = structural_block_size / find_vector::length;
+
+    structural_block(const uint8_t* p)
+    {
+        for (unsigned i = 0; i < size; ++i)
+            v_[i] = load_u(p + i * find_vector::length);
+    }
+
+    const find_vector& operator[](unsigned i) const { return v_[i]; }
+
+    // Returns the mask of bytes matched by the given matcher
+    template<class M> SIMDPP_INL
+    uint64_t match(const M& m) const
+    {
+        uint64_t r = 0;
+        for (unsigned i = 0; i < size; ++i)
+            r |= structural_bits(m(v_[i]), i);
+        return r;
+    }
+
+private:
+    find_vector v_[size];
+};
+
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+/*  Finds the JSON operators and whitespace by lookups indexed by the low and
+    the high nibble of each byte as in find_set_matcher, but both sets share
+    a single pair of tables. The characters are divided into groups with the
+    same low nibbles: ',' (0x2c), ':' (0x3a), "[]{}" (0x5b, 0x5d, 0x7b, 0x7d)
+    are assigned the bits 1, 2, 4 and ' ' (0x20), "\t\n\r" (0x09, 0x0a, 0x0d)
+    the bits 8, 16. Each byte matches at most one group, thus the operators
+    result in values from 1 to 7 and the whitespace in larger values.
+*/
+class json_char_classifier {
+public:
+    json_char_classifier() :
+        lo_(make_uint(8, 0, 0, 0, 0, 0, 0, 0, 0, 16, 18, 4, 1, 20, 0, 0)),
+        hi_(make_uint(16, 0, 9, 2, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0))
+    {}
+
+    SIMDPP_INL void operator()(const find_vector& v, find_vector& op,
+                               find_vector& space) const
+    {
+        using int8_vector = int8<find_vector::length>;
+        find_vector vlo = bit_and(v, find_vector(splat(uint8_t(0x0f))));
+        find_vector vhi = shift_r<4>(v);
+        int8_vector r = bit_and(permute_bytes16(lo_, vlo),
+                                permute_bytes16(hi_, vhi));
+        find_vector any = find_vector(cmp_gt(r, int8_vector(make_zero())));
+        space = find_vector(cmp_gt(r, int8_vector(splat(7))));
+        op = bit_andnot(any, space);
+    }
+
+private:
+    find_vector lo_, hi_;
+};
+#else
+class json_char_classifier {
+public:
+    json_char_classifier() :
+        ops_(reinterpret_cast<const uint8_t*>("{}[]:,"), 6),
+        spaces_(reinterpret_cast<const uint8_t*>(" \t\n\r"), 4)
+    {}
+
+    SIMDPP_INL void operator()(const find_vector& v, find_vector& op,
+                               find_vector& space) const
+    {
+        op = ops_(v);
+        space = spaces_(v);
+    }
+
+private:
+    find_set_matcher ops_;
+    find_set_matcher spaces_;
+};
+#endif
+
+/*  Returns a mask with the i-th bit set to the XOR of the bits 0 to i of x.
+    This is equivalent to a carry-less multiplication by an all-ones value,
+    which is computed by shifts as instruction sets that support it are not
+    exposed by the library.
+*/
+static SIMDPP_INL
+uint64_t structural_prefix_xor(uint64_t x)
+{
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+/*  Stores base plus the index of each set bit of bits to out. The indices are
+    stored in groups of 4, thus up to 3 elements past the returned end are
+    overwritten. This avoids a hard to predict branch per index.
+*/
+static SIMDPP_INL
+uint32_t* structural_flatten(uint32_t* out, uint32_t base, uint64_t bits)
+{
+    if (bits == 0)
+        return out;
+    uint32_t* end = out + bit_count64(bits);
+    // the highest bit is set so that the index is defined when the set bits
+    // have run out within a group
+    const uint64_t sentinel = uint64_t(1) << 63;
+    do {
+        out[0] = base + bit_scan_forward64(bits | sentinel);
+        bits &= bits - 1;
+        out[1] = base + bit_scan_forward64(bits | sentinel);
+        bits &= bits - 1;
+        out[2] = base + bit_scan_forward64(bits | sentinel);
+        bits &= bits - 1;
+        out[3] = base + bit_scan_forward64(bits | sentinel);
+        bits &= bits - 1;
+        out += 4;
+    } while (out < end);
+    return end;
+}
+
+/*  Finds the structural characters of JSON text. The state consists of
+    whether the next block starts with an escaped character, within a string
+    and after a scalar character.
+*/
+class json_structural_scanner {
+public:
+    json_structural_scanner() :
+        quote_('"'),
+        backslash_('\\'),
+        prev_escaped_(0),
+        prev_in_string_(0),
+        prev_scalar_(0)
+    {}
+
+    // Stores the indices of the structural characters of the block to out.
+    // Only the bytes with bits set in valid are considered.
+    SIMDPP_INL uint32_t* next(const uint8_t* p, uint32_t base, uint64_t valid,
+                              uint32_t* out)
+    {
+        structural_block block(p);
+        uint64_t quote = block.match(quote_);
+        uint64_t backslash = block.match(backslash_);
+        uint64_t op = 0, space = 0;
+        for (unsigned i = 0; i < structural_block::size; ++i) {
+            find_vector vop, vspace;
+            classify_(block[i], vop, vspace);
+            op |= structural_bits(vop, i);
+            space |= structural_bits(vspace, i);
+        }
+
+        quote &= ~escaped(backslash);
+        // includes the opening quote, but not the closing one
+        uint64_t in_string = structural_prefix_xor(quote) ^ prev_in_string_;
+        prev_in_string_ = 0 - (in_string >> 63);
+
+        // a scalar starts at each non-whitespace, non-operator byte that
+        // doesn't follow another such byte, quotes start strings instead
+        uint64_t scalar = ~(op | space);
+        uint64_t nonquote_scalar = scalar & ~quote;
+        uint64_t follows_scalar = (nonquote_scalar << 1) | prev_scalar_;
+        prev_scalar_ = nonquote_scalar >> 63;
+
+        uint64_t string_tail = in_string ^ quote;
+        uint64_t structural = (op | (scalar & ~follows_scalar)) & ~string_tail;
+        return structural_flatten(out, base, structural & valid);
+    }
+
+    bool in_string() const { return prev_in_string_ != 0; }
+
+private:
+    /*  Returns the mask of characters that are escaped by a backslash. A
+        sequence of backslashes escapes the following character if its
+        length is odd. The sequences that start at odd positions are
+        extended to the following character by an addition, which flips the
+        parity of the bits of the escaped characters.
+    */
+    SIMDPP_INL uint64_t escaped(uint64_t backslash)
+    {
+        const uint64_t even_bits = 0x5555555555555555;
+        backslash &= ~prev_escaped_;
+        uint64_t follows_escape = (backslash << 1) | prev_escaped_;
+        uint64_t odd_starts = backslash & ~even_bits & ~follows_escape;
+        uint64_t even_ends = odd_starts + backslash;
+        prev_escaped_ = even_ends < backslash ? 1 : 0;
+        return (even_bits ^ (even_ends << 1)) & follows_escape;
+    }
+
+    json_char_classifier classify_;
+    find_byte_matcher quote_;
+    find_byte_matcher backslash_;
+    uint64_t prev_escaped_;
+    uint64_t prev_in_string_;
+    uint64_t prev_scalar_;
+};
+
+/*  Finds the field and record separators of CSV text. Quotes within quoted
+    fields are doubled, which toggles the quoted state twice, thus they don't
+    need to be handled separately.
+*/
+class csv_structural_scanner {
+public:
+    csv_structural_scanner(char separator) :
+        quote_('"'),
+        separator_(uint8_t(separator)),
+        newline_('\n'),
+        prev_in_quotes_(0)
+    {}
+
+    SIMDPP_INL uint32_t* next(const uint8_t* p, uint32_t base, uint64_t valid,
+                              uint32_t* out)
+    {
+        structural_block block(p);
+        uint64_t quote = block.match(quote_);
+        uint64_t separator = block.match(separator_) | block.match(newline_);
+
+        uint64_t in_quotes = structural_prefix_xor(quote) ^ prev_in_quotes_;
+        prev_in_quotes_ = 0 - (in_quotes >> 63);
+        return structural_flatten(out, base, separator & ~in_quotes & valid);
+    }
+
+    bool in_string() const { return prev_in_quotes_ != 0; }
+
+private:
+    find_byte_matcher quote_;
+    find_byte_matcher separator_;
+    find_byte_matcher newline_;
+    uint64_t prev_in_quotes_;
+};
+
+template<class S> SIMDPP_INL
+uint32_t* i_structural_index(const uint8_t* first, const uint8_t* last,
+                             uint32_t* out, S& scanner)
+{
+    const uint8_t* p = first;
+    for (; last - p >= std::ptrdiff_t(structural_block_size); p += structural_block_size)
+        out = scanner.next(p, uint32_t(p - first), ~uint64_t(0), out);
+
+    if (p != last) {
+        // the bytes past the end are not considered, only the last block is
+        // copied so that they can be loaded
+        uint8_t buf[structural_block_size] = {};
+        std::size_t n = last - p;
+        std::memcpy(buf, p, n);
+        out = scanner.next(buf, uint32_t(p - first), (uint64_t(1) << n) - 1, out);
+    }
+    if (scanner.in_string())
+        return nullptr;
+    return out;
+}
+
+static SIMDPP_INL
+const uint8_t* structural_bytes(const char* p)
+{
+    return reinterpret_cast<const uint8_t*>(p);
+}
+
+} // namespace detail
+
+/** Finds the structural characters of the JSON text in the range
+    [first, last) and stores their offsets from @a first in increasing order
+    to the range starting at @a out. Returns the end of the stored offsets, or
+    @c nullptr if the text ends within a string.
+
+    The structural characters are the @c {}[]:, characters outside strings,
+    the opening quotes of strings and the first characters of other values
+    such as numbers and literals. A parser can thus visit each value and
+    punctuation character without looking at the other bytes. The text is
+    not validated: invalid text produces offsets that a parser is expected to
+    reject.
+
+    The output range must have space for @c (last-first)+3 elements; the
+    elements past the returned end are overwritten. The text must be shorter
+    than 4 GiB.
+
+    The text is processed in blocks of 64 bytes. The quotes, backslashes,
+    operators and whitespace of each block are found by comparisons, or by
+    lookups using permute_bytes16() where supported, and are converted to
+    64-bit masks by extract_bits_any(). The escaped characters are found by
+    an addition of the masks and the characters within strings by a prefix
+    XOR. The offsets are extracted from the resulting mask by bit scans.
+*/
+static SIMDPP_INL
+uint32_t* json_structural_index(const char* first, const char* last,
+                                uint32_t* out)
+{
+    detail::json_structural_scanner scanner;
+    return detail::i_structural_index(detail::structural_bytes(first),
+                                      detail::structural_bytes(last),
+                                      out, scanner);
+}
+
+/** Finds the field separators and the newline characters outside quoted
+    fields of the CSV text in the range [first, last) and stores their
+    offsets from @a first in increasing order to the range starting at
+    @a out. Returns the end of the stored offsets, or @c nullptr if the text
+    ends within a quoted field.
+
+    Quoted fields may contain separators, newlines and doubled quotes. The
+    carriage return of a CRLF line ending is not treated specially, it
+    precedes the offset of the newline.
+
+    The output range must have space for @c (last-first)+3 elements; the
+    elements past the returned end are overwritten. The text must be shorter
+    than 4 GiB.
+
+    The text is processed in blocks of 64 bytes in the same way as in
+    json_structural_index().
+*/
+static SIMDPP_INL
+uint32_t* csv_structural_index(const char* first, const char* last,
+                               uint32_t* out, char separator = ',')
+{
+    detail::csv_structural_scanner scanner(separator);
+    return detail::i_structural_index(detail::structural_bytes(first),
+                                      detail::structural_bytes(last),
+                                      out, scanner);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
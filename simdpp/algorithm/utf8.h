@@ -0,0 +1,764 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_ALGORITHM_UTF8_H
+#define LIBSIMDPP_SIMDPP_ALGORITHM_UTF8_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/align.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/i_sub_sat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/move_l.h>
+#include <simdpp/core/permute_bytes16.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store_compress.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/core/to_int8.h>
+#include <simdpp/core/to_int16.h>
+#include <simdpp/core/to_int32.h>
+#include <simdpp/core/zip_hi.h>
+#include <simdpp/core/zip_lo.h>
+#include <simdpp/detail/insn/compress_lut.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  The validator and the decoder operate on blocks of SIMDPP_FAST_INT8_SIZE
+    bytes, that is, 32 bytes on AVX2 and 64 bytes on AVX-512BW. The bytes
+    preceding a block are read by unaligned loads instead of being shifted
+    in across the 128-bit lanes. The decoded code points are left-packed 16
+    at a time using lookup tables. The encoders process 16 code units at a
+    time using 16-bit arithmetic, which fills a 256-bit vector. The blocks
+    that contain characters outside the Basic Multilingual Plane are
+    processed one character at a time.
+*/
+
+// Decodes the UTF-8 character at p. Returns the length of the character in
+// bytes, or 0 if the sequence is invalid, truncated, overlong or encodes a
+// surrogate or a value above U+10FFFF.
+static SIMDPP_INL
+unsigned utf8_decode_char(const uint8_t* p, const uint8_t* last, uint32_t& cp)
+{
+    uint8_t b0 = p[0];
+    if (b0 < 0x80) {
+        cp = b0;
+        return 1;
+    }
+    unsigned len;
+    uint32_t min;
+    if (b0 < 0xc2) {
+        return 0;
+    } else if (b0 < 0xe0) {
+        len = 2; cp = b0 & 0x1f; min = 0x80;
+    } else if (b0 < 0xf0) {
+        len = 3; cp = b0 & 0x0f; min = 0x800;
+    } else if (b0 < 0xf5) {
+        len = 4; cp = b0 & 0x07; min = 0x10000;
+    } else {
+        return 0;
+    }
+    if (std::size_t(last - p) < len)
+        return 0;
+    for (unsigned i = 1; i < len; ++i) {
+        if ((p[i] & 0xc0) != 0x80)
+            return 0;
+        cp = (cp << 6) | (p[i] & 0x3f);
+    }
+    if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp < 0xe000))
+        return 0;
+    return len;
+}
+
+// Decodes the UTF-16 character at p. Returns the number of code units, or 0
+// if the character is an unpaired surrogate.
+static SIMDPP_INL
+unsigned utf16_decode_char(const char16_t* p, const char16_t* last, uint32_t& cp)
+{
+    uint32_t hi = p[0];
+    if (hi < 0xd800 || hi >= 0xe000) {
+        cp = hi;
+        return 1;
+    }
+    if (hi >= 0xdc00 || last - p < 2)
+        return 0;
+    uint32_t lo = p[1];
+    if (lo < 0xdc00 || lo >= 0xe000)
+        return 0;
+    cp = 0x10000 + ((hi - 0xd800) << 10) + (lo - 0xdc00);
+    return 2;
+}
+
+static SIMDPP_INL
+char* utf_encode_char(uint32_t cp, char* out)
+{
+    if (cp < 0x80) {
+        *out++ = char(cp);
+    } else if (cp < 0x800) {
+        *out++ = char(0xc0 | (cp >> 6));
+        *out++ = char(0x80 | (cp & 0x3f));
+    } else if (cp < 0x10000) {
+        *out++ = char(0xe0 | (cp >> 12));
+        *out++ = char(0x80 | ((cp >> 6) & 0x3f));
+        *out++ = char(0x80 | (cp & 0x3f));
+    } else {
+        *out++ = char(0xf0 | (cp >> 18));
+        *out++ = char(0x80 | ((cp >> 12) & 0x3f));
+        *out++ = char(0x80 | ((cp >> 6) & 0x3f));
+        *out++ = char(0x80 | (cp & 0x3f));
+    }
+    return out;
+}
+
+static SIMDPP_INL
+char16_t* utf_encode_char(uint32_t cp, char16_t* out)
+{
+    if (cp < 0x10000) {
+        *out++ = char16_t(cp);
+    } else {
+        cp -= 0x10000;
+        *out++ = char16_t(0xd800 | (cp >> 10));
+        *out++ = char16_t(0xdc00 | (cp & 0x3ff));
+    }
+    return out;
+}
+
+static SIMDPP_INL
+char32_t* utf_encode_char(uint32_t cp, char32_t* out)
+{
+    *out++ = char32_t(cp);
+    return out;
+}
+
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+/*  Validates UTF-8 using the lookup algorithm by Keiser and Lemire. Each
+    byte and the high nibble of the byte preceding it are looked up in three
+    tables indexed by nibbles. The results are bit sets of the errors that
+    the pair of bytes may be part of; a pair is invalid if all three results
+    share a bit. The third and fourth bytes of multi-byte characters are
+    checked against the bytes two and three positions before them.
+
+    The preceding bytes are loaded from memory, thus the first block and the
+    tail of the input are checked from a zero-padded copy.
+*/
+template<unsigned N>
+class utf8_checker {
+public:
+    utf8_checker(const uint8_t* first, const uint8_t* last) :
+        first_(first), last_(last), error_(make_zero()),
+        incomplete_(make_zero()), prev_incomplete_(make_zero())
+    {}
+
+    // Checks the block [p, p+N), which must be within the input
+    SIMDPP_INL void check(const uint8_t* p)
+    {
+        // the bytes before the first block can't be read
+        if (p == first_)
+            check_copy(p, p + N);
+        else
+            check_block(p);
+    }
+
+    // Checks the bytes in [p, last)
+    SIMDPP_INL void check_tail(const uint8_t* p)
+    {
+        while (p != last_) {
+            const uint8_t* end = p + std::min<std::size_t>(N, last_ - p);
+            check_copy(p, end);
+            p = end;
+        }
+    }
+
+    SIMDPP_INL bool finish()
+    {
+        incomplete_ = bit_or(incomplete_, prev_incomplete_);
+        return !test_bits_any(error_) && !test_bits_any(incomplete_);
+    }
+
+private:
+    SIMDPP_INL void check_copy(const uint8_t* p, const uint8_t* end)
+    {
+        uint8_t buf[N + 3] = {};
+        std::size_t before = std::min<std::size_t>(3, p - first_);
+        std::memcpy(buf + 3 - before, p - before, before + (end - p));
+        check_block(buf + 3);
+    }
+
+    SIMDPP_INL void check_block(const uint8_t* p)
+    {
+        const uint8_t too_short = 1 << 0;
+        const uint8_t too_long = 1 << 1;
+        const uint8_t overlong_3 = 1 << 2;
+        const uint8_t too_large = 1 << 3;
+        const uint8_t surrogate = 1 << 4;
+        const uint8_t overlong_2 = 1 << 5;
+        const uint8_t too_large_1000 = 1 << 6;
+        const uint8_t overlong_4 = 1 << 6;
+        const uint8_t two_conts = 1 << 7;
+        const uint8_t carry = too_short | too_long | two_conts;
+
+        uint8<N> in = load_u(p);
+        uint8<N> high_bit = splat(uint8_t(0x80));
+        if (!test_bits_any(bit_and(in, high_bit))) {
+            // an ASCII block is valid unless it follows an incomplete
+            // character
+            incomplete_ = bit_or(incomplete_, prev_incomplete_);
+            prev_incomplete_ = make_zero();
+            return;
+        }
+
+        // the tables are repeated in each 128-bit lane
+        uint8<N> byte_1_high_table = make_uint(
+            too_long, too_long, too_long, too_long,
+            too_long, too_long, too_long, too_long,
+            two_conts, two_conts, two_conts, two_conts,
+            too_short | overlong_2,
+            too_short,
+            too_short | overlong_3 | surrogate,
+            too_short | too_large | too_large_1000 | overlong_4);
+        uint8<N> byte_1_low_table = make_uint(
+            carry | overlong_3 | overlong_2 | overlong_4,
+            carry | overlong_2,
+            carry,
+            carry,
+            carry | too_large,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000 | surrogate,
+            carry | too_large | too_large_1000,
+            carry | too_large | too_large_1000);
+        uint8<N> byte_2_high_table = make_uint(
+            too_short, too_short, too_short, too_short,
+            too_short, too_short, too_short, too_short,
+            too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+            too_long | overlong_2 | two_conts | overlong_3 | too_large,
+            too_long | overlong_2 | two_conts | surrogate | too_large,
+            too_long | overlong_2 | two_conts | surrogate | too_large,
+            too_short, too_short, too_short, too_short);
+        uint8<N> low_nibble = splat(uint8_t(0x0f));
+
+        uint8<N> prev1 = load_u(p - 1);
+        uint8<N> byte_1_high = permute_bytes16(byte_1_high_table, shift_r<4>(prev1));
+        uint8<N> byte_1_low = permute_bytes16(byte_1_low_table, bit_and(prev1, low_nibble));
+        uint8<N> byte_2_high = permute_bytes16(byte_2_high_table, shift_r<4>(in));
+        uint8<N> special = bit_and(bit_and(byte_1_high, byte_1_low), byte_2_high);
+
+        // the high bit is set where a third or fourth byte is expected
+        uint8<N> prev2 = load_u(p - 2);
+        uint8<N> prev3 = load_u(p - 3);
+        uint8<N> third = sub_sat(prev2, uint8<N>(splat(uint8_t(0xe0 - 0x80))));
+        uint8<N> fourth = sub_sat(prev3, uint8<N>(splat(uint8_t(0xf0 - 0x80))));
+        uint8<N> must23 = bit_and(bit_or(third, fourth), high_bit);
+        error_ = bit_or(error_, bit_xor(must23, special));
+
+        // nonzero if the last character of the block is incomplete
+        uint8<16> max_complete = make_uint(0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                           0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                           0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1);
+        prev_incomplete_ = sub_sat(uint8<16>(load_u(p + N - 16)), max_complete);
+    }
+
+    const uint8_t* first_;
+    const uint8_t* last_;
+    uint8<N> error_;
+    uint8<16> incomplete_, prev_incomplete_;
+};
+#else
+/*  Without permute_bytes16() the characters that start within each block are
+    decoded one at a time. The blocks of ASCII characters are skipped.
+*/
+template<unsigned N>
+class utf8_checker {
+public:
+    utf8_checker(const uint8_t* first, const uint8_t* last) :
+        next_(first), last_(last), valid_(true)
+    {}
+
+    // Checks the characters that start within the block [p, p+N)
+    SIMDPP_INL void check(const uint8_t* p)
+    {
+        const uint8_t* end = p + N;
+        uint8<N> high_bit = splat(uint8_t(0x80));
+        if (next_ <= p && !test_bits_any(bit_and(uint8<N>(load_u(p)), high_bit))) {
+            next_ = end;
+            return;
+        }
+        check_chars(end);
+    }
+
+    // Checks the characters that start within [p, last)
+    SIMDPP_INL void check_tail(const uint8_t*)
+    {
+        check_chars(last_);
+    }
+
+    SIMDPP_INL bool finish() { return valid_; }
+
+private:
+    SIMDPP_INL void check_chars(const uint8_t* end)
+    {
+        while (next_ < end) {
+            uint32_t cp = 0;
+            unsigned len = utf8_decode_char(next_, last_, cp);
+            if (len == 0) {
+                valid_ = false;
+                next_ = last_;
+                return;
+            }
+            next_ += len;
+        }
+    }
+
+    const uint8_t* next_;
+    const uint8_t* last_;
+    bool valid_;
+};
+#endif
+
+static SIMDPP_INL
+bool i_utf8_validate(const uint8_t* first, const uint8_t* last)
+{
+    const unsigned N = SIMDPP_FAST_INT8_SIZE;
+    utf8_checker<N> checker(first, last);
+    const uint8_t* p = first;
+    for (; std::size_t(last - p) >= N; p += N)
+        checker.check(p);
+    checker.check_tail(p);
+    return checker.finish();
+}
+
+// Decodes the characters whose first byte is within [p, end). The
+// continuation bytes at the beginning are skipped, the last character may
+// extend past end. Returns nullptr if an invalid character is found.
+template<class C> SIMDPP_INL
+C* utf8_decode_scalar(const uint8_t* p, const uint8_t* end, const uint8_t* last,
+                      C* out)
+{
+    while (p < end) {
+        if ((*p & 0xc0) == 0x80) {
+            ++p;
+            continue;
+        }
+        uint32_t cp = 0;
+        unsigned len = utf8_decode_char(p, last, cp);
+        if (len == 0)
+            return nullptr;
+        p += len;
+        out = utf_encode_char(cp, out);
+    }
+    return out;
+}
+
+template<unsigned N> SIMDPP_INL
+char16_t* utf8_store_ascii(const uint8<N>& a, char16_t* out)
+{
+    store_u(out, to_uint16(a));
+    return out + N;
+}
+
+template<unsigned N> SIMDPP_INL
+char32_t* utf8_store_ascii(const uint8<N>& a, char32_t* out)
+{
+    store_u(out, to_uint32(a));
+    return out + N;
+}
+
+/*  Stores the code points at the positions of the lead bytes. The unused
+    elements are moved to the end of the vector by permute_zbytes16() and
+    the whole vector is stored, thus up to 16 elements may be written to
+    out. The caller must ensure that this doesn't exceed the output buffer.
+*/
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+static SIMDPP_INL uint16<8> utf8_widen(const uint16<8>& a, char16_t*) { return a; }
+static SIMDPP_INL uint32<8> utf8_widen(const uint16<8>& a, char32_t*) { return to_uint32(a); }
+
+template<class C> SIMDPP_INL
+C* utf8_store_chars(const uint16<16>& cp, const uint8<16>& lead, C* out)
+{
+    unsigned bits = extract_bits_any(lead);
+    uint16<8> cp_lo, cp_hi;
+    split(cp, cp_lo, cp_hi);
+
+    uint8<16> idx = load_u(insn::i_compress_lut_row<2>(false, bits & 0xff));
+    uint16<8> c = bit_cast<uint16<8>>(permute_zbytes16(bit_cast<uint8<16>>(cp_lo), idx));
+    store_u(out, utf8_widen(c, out));
+    out += insn::i_compress_popcnt(bits & 0xff);
+
+    idx = load_u(insn::i_compress_lut_row<2>(false, bits >> 8));
+    c = bit_cast<uint16<8>>(permute_zbytes16(bit_cast<uint8<16>>(cp_hi), idx));
+    store_u(out, utf8_widen(c, out));
+    return out + insn::i_compress_popcnt(bits >> 8);
+}
+#else
+static SIMDPP_INL
+char16_t* utf8_store_chars(const uint16<16>& cp, const uint8<16>& lead,
+                           char16_t* out)
+{
+    return out + store_compress_unsafe_tail(out, cp,
+                                            cmp_neq(to_uint16(lead), uint16<16>(make_zero())));
+}
+
+static SIMDPP_INL
+char32_t* utf8_store_chars(const uint16<16>& cp, const uint8<16>& lead,
+                           char32_t* out)
+{
+    return out + store_compress_unsafe_tail(out, to_uint32(cp),
+                                            cmp_neq(to_uint32(lead), uint32<16>(make_zero())));
+}
+#endif
+
+// The wider vectors are stored 16 elements at a time
+template<unsigned N, class C> SIMDPP_INL
+C* utf8_store_chars(const uint16<N>& cp, const uint8<N>& lead, C* out)
+{
+    uint16<N/2> cp_lo, cp_hi;
+    uint8<N/2> lead_lo, lead_hi;
+    split(cp, cp_lo, cp_hi);
+    split(lead, lead_lo, lead_hi);
+    out = utf8_store_chars(cp_lo, lead_lo, out);
+    return utf8_store_chars(cp_hi, lead_hi, out);
+}
+
+/*  Decodes UTF-8 and validates each block before decoding it. Each block is
+    loaded three times at offsets 0, 1 and 2, thus every byte position holds
+    the first three bytes of the character that may start there. The code
+    points of 1 to 3 byte characters are computed at all positions and the
+    ones at the positions of the lead bytes are stored. Returns nullptr if
+    the input is invalid.
+
+    At most one element is stored per input byte before the end of the
+    current block, thus the vector stores stay within the output range.
+*/
+template<class C> SIMDPP_INL
+C* i_utf8_decode(const uint8_t* first, const uint8_t* last, C* out)
+{
+    const unsigned N = SIMDPP_FAST_INT8_SIZE;
+    uint8<N> high_bit = splat(uint8_t(0x80));
+    uint8<N> max_3byte = splat(uint8_t(0xef));
+    uint8<N> cont_bits = splat(uint8_t(0x3f));
+
+    utf8_checker<N> checker(first, last);
+    const uint8_t* p = first;
+    while (std::size_t(last - p) >= N + 2) {
+        checker.check(p);
+        uint8<N> b0 = load_u(p);
+        if (!test_bits_any(bit_and(b0, high_bit))) {
+            out = utf8_store_ascii(b0, out);
+            p += N;
+            continue;
+        }
+        if (test_bits_any(sub_sat(b0, max_3byte))) {
+            out = utf8_decode_scalar(p, p + N, last, out);
+            if (out == nullptr)
+                return nullptr;
+            p += N;
+            continue;
+        }
+        uint8<N> b1 = load_u(p + 1);
+        uint8<N> b2 = load_u(p + 2);
+        uint16<N> c0 = to_uint16(b0);
+        uint16<N> c1 = to_uint16(bit_and(b1, cont_bits));
+        uint16<N> c2 = to_uint16(bit_and(b2, cont_bits));
+
+        uint16<N> cp2 = bit_or(shift_l<6>(bit_and(c0, uint16<N>(splat(0x1f)))), c1);
+        uint16<N> cp3 = bit_or(bit_or(shift_l<12>(c0), shift_l<6>(c1)), c2);
+        int16<N> sc0 = c0;
+        uint16<N> cp = blend(cp2, c0, cmp_gt(sc0, int16<N>(splat(0xbf))));
+        cp = blend(cp3, cp, cmp_gt(sc0, int16<N>(splat(0xdf))));
+
+        // the continuation bytes are in the range [0x80, 0xbf]
+        uint8<N> lead = uint8<N>(cmp_gt(int8<N>(b0), int8<N>(splat(-0x41))));
+        out = utf8_store_chars(cp, lead, out);
+        p += N;
+    }
+    checker.check_tail(p);
+    if (!checker.finish())
+        return nullptr;
+    return utf8_decode_scalar(p, last, last, out);
+}
+
+/*  Stores the bytes at the positions of the nonzero elements of keep. Each
+    half of the vector is compressed separately and stored as a whole
+    vector, thus up to 24 bytes may be written to out. The caller must ensure
+    that this doesn't exceed the output buffer.
+*/
+#if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+static SIMDPP_INL
+char* utf8_store_bytes(const uint8<16>& bytes, const uint8<16>& keep, char* out)
+{
+    unsigned bits = extract_bits_any(keep);
+    uint64<2> idx_lo = load_u(insn::i_compress_lut_row<1>(false, bits & 0xff));
+    uint64<2> idx_hi = load_u(insn::i_compress_lut_row<1>(false, bits >> 8));
+    uint8<16> idx = bit_cast<uint8<16>>(uint64<2>(zip2_lo(idx_lo, idx_hi)));
+    uint8<16> offset = make_uint(0,0,0,0,0,0,0,0,8,8,8,8,8,8,8,8);
+    idx = add(idx, offset);
+
+    uint8<16> c = permute_zbytes16(bytes, idx);
+    store_u(out, c);
+    out += insn::i_compress_popcnt(bits & 0xff);
+    store_u(out, move16_l<8>(c));
+    return out + insn::i_compress_popcnt(bits >> 8);
+}
+#else
+static SIMDPP_INL
+char* utf8_store_bytes(const uint8<16>& bytes, const uint8<16>& keep, char* out)
+{
+    return out + store_compress_unsafe_tail(out, bytes,
+                                            cmp_neq(keep, uint8<16>(make_zero())));
+}
+#endif
+
+/*  Encodes 16 code points of the Basic Multilingual Plane, none of which is
+    a surrogate. The bytes of the characters are computed in three vectors
+    and interleaved by zip16_lo() and zip16_hi(), the unused bytes are then
+    removed by utf8_store_bytes(). Up to 58 bytes may be written to out.
+*/
+static SIMDPP_INL
+char* utf8_encode_block(const uint16<16>& u, char* out)
+{
+    uint16<16> cont_bits = splat(0x3f);
+    uint16<16> cont_tag = splat(0x80);
+    if (!test_bits_any(bit_and(u, uint16<16>(splat(0xff80))))) {
+        store_u(out, to_uint8(u));
+        return out + 16;
+    }
+
+    uint16<16> is2 = uint16<16>(cmp_gt(u, uint16<16>(splat(0x7f))));
+    uint16<16> is3 = uint16<16>(cmp_gt(u, uint16<16>(splat(0x7ff))));
+    uint16<16> lead2 = bit_or(shift_r<6>(u), uint16<16>(splat(0xc0)));
+    uint16<16> lead3 = bit_or(shift_r<12>(u), uint16<16>(splat(0xe0)));
+    uint16<16> low = bit_or(bit_and(u, cont_bits), cont_tag);
+    uint16<16> lead = blend(lead3, blend(lead2, u, is2), is3);
+
+    uint8<16> zero = make_zero();
+    uint8<16> ones = make_ones();
+    uint8<16> b0 = to_uint8(lead);
+    uint8<16> k1 = to_uint8(is2);
+
+    if (!test_bits_any(is3)) {
+        uint8<16> b1 = to_uint8(low);
+        out = utf8_store_bytes(zip16_lo(b0, b1), zip16_lo(ones, k1), out);
+        out = utf8_store_bytes(zip16_hi(b0, b1), zip16_hi(ones, k1), out);
+        return out;
+    }
+
+    uint16<16> mid = bit_or(bit_and(shift_r<6>(u), cont_bits), cont_tag);
+    uint8<16> b1 = to_uint8(blend(mid, low, is3));
+    uint8<16> b2 = to_uint8(low);
+    uint8<16> k2 = to_uint8(is3);
+
+    // bytes b0, b1, b2 and one unused byte for each character
+    uint8<16> b02_lo = zip16_lo(b0, b2), b02_hi = zip16_hi(b0, b2);
+    uint8<16> b1z_lo = zip16_lo(b1, zero), b1z_hi = zip16_hi(b1, zero);
+    uint8<16> k02_lo = zip16_lo(ones, k2), k02_hi = zip16_hi(ones, k2);
+    uint8<16> k1z_lo = zip16_lo(k1, zero), k1z_hi = zip16_hi(k1, zero);
+    out = utf8_store_bytes(zip16_lo(b02_lo, b1z_lo), zip16_lo(k02_lo, k1z_lo), out);
+    out = utf8_store_bytes(zip16_hi(b02_lo, b1z_lo), zip16_hi(k02_lo, k1z_lo), out);
+    out = utf8_store_bytes(zip16_lo(b02_hi, b1z_hi), zip16_lo(k02_hi, k1z_hi), out);
+    out = utf8_store_bytes(zip16_hi(b02_hi, b1z_hi), zip16_hi(k02_hi, k1z_hi), out);
+    return out;
+}
+
+static SIMDPP_INL
+char* i_utf16_encode(const char16_t* p, const char16_t* last, char* out)
+{
+    uint16<16> surrogate_first = splat(0xd800);
+    uint16<16> surrogate_count = splat(0x800);
+
+    // the output buffer has room for 3 bytes per code unit, leave enough
+    // space for the vector stores of utf8_encode_block()
+    while (last - p >= 20) {
+        uint16<16> u = load_u(p);
+        uint16<16> is_surrogate = uint16<16>(cmp_lt(sub(u, surrogate_first), surrogate_count));
+        if (!test_bits_any(is_surrogate)) {
+            out = utf8_encode_block(u, out);
+            p += 16;
+            continue;
+        }
+        // the last surrogate pair may extend past the block
+        const char16_t* end = p + 16;
+        while (p < end) {
+            uint32_t cp = 0;
+            unsigned len = utf16_decode_char(p, last, cp);
+            if (len == 0)
+                return nullptr;
+            out = utf_encode_char(cp, out);
+            p += len;
+        }
+    }
+    while (p != last) {
+        uint32_t cp = 0;
+        unsigned len = utf16_decode_char(p, last, cp);
+        if (len == 0)
+            return nullptr;
+        out = utf_encode_char(cp, out);
+        p += len;
+    }
+    return out;
+}
+
+static SIMDPP_INL
+bool utf32_valid_char(uint32_t cp)
+{
+    return cp <= 0x10ffff && (cp < 0xd800 || cp >= 0xe000);
+}
+
+static SIMDPP_INL
+char* i_utf32_encode(const char32_t* p, const char32_t* last, char* out)
+{
+    uint32<16> surrogate_first = splat(0xd800);
+    uint32<16> surrogate_count = splat(0x800);
+    uint32<16> max_bmp = splat(0xffff);
+
+    for (; last - p >= 16; p += 16) {
+        uint32<16> u = load_u(p);
+        uint32<16> is_surrogate = uint32<16>(cmp_lt(sub(u, surrogate_first), surrogate_count));
+        uint32<16> above_bmp = uint32<16>(cmp_gt(u, max_bmp));
+        if (!test_bits_any(bit_or(is_surrogate, above_bmp))) {
+            out = utf8_encode_block(to_uint16(u), out);
+            continue;
+        }
+        for (unsigned i = 0; i < 16; ++i) {
+            if (!utf32_valid_char(p[i]))
+                return nullptr;
+            out = utf_encode_char(p[i], out);
+        }
+    }
+    for (; p != last; ++p) {
+        if (!utf32_valid_char(*p))
+            return nullptr;
+        out = utf_encode_char(*p, out);
+    }
+    return out;
+}
+
+static SIMDPP_INL
+const uint8_t* utf8_bytes(const char* p)
+{
+    return reinterpret_cast<const uint8_t*>(p);
+}
+
+} // namespace detail
+
+/** Returns true if the range [first, last) contains valid UTF-8 text.
+
+    Overlong encodings, surrogates, code points above U+10FFFF and truncated
+    characters are rejected.
+
+    The bytes are validated in blocks of native vector size by the lookup
+    algorithm of Keiser and Lemire that classifies each pair of adjacent bytes
+    with three nibble lookups using permute_bytes16(). The blocks containing
+    only ASCII characters are skipped. On instruction sets that don't support
+    permute_bytes16() the characters are decoded one at a time.
+*/
+static SIMDPP_INL
+bool utf8_validate(const char* first, const char* last)
+{
+    return detail::i_utf8_validate(detail::utf8_bytes(first),
+                                   detail::utf8_bytes(last));
+}
+
+/** Converts the UTF-8 text in the range [first, last) to UTF-16 and stores it
+    to the range starting at @a out. Returns the end of the output range, or
+    @c nullptr if the input is not valid UTF-8 (see utf8_validate()).
+
+    The output range must have space for @c last-first code units. The
+    elements past the returned end may be overwritten. If the input is not
+    valid, the contents of the output range are unspecified.
+
+    Each block of native vector size is validated as in utf8_validate() and
+    then decoded. The characters of up to 3 bytes are decoded using vector
+    operations, the blocks containing 4-byte characters are decoded one
+    character at a time.
+*/
+static SIMDPP_INL
+char16_t* utf8_to_utf16(const char* first, const char* last, char16_t* out)
+{
+    return detail::i_utf8_decode(detail::utf8_bytes(first),
+                                 detail::utf8_bytes(last), out);
+}
+
+/** Converts the UTF-8 text in the range [first, last) to UTF-32 and stores it
+    to the range starting at @a out. Returns the end of the output range, or
+    @c nullptr if the input is not valid UTF-8 (see utf8_validate()).
+
+    The output range must have space for @c last-first code points. See
+    utf8_to_utf16() for details.
+*/
+static SIMDPP_INL
+char32_t* utf8_to_utf32(const char* first, const char* last, char32_t* out)
+{
+    return detail::i_utf8_decode(detail::utf8_bytes(first),
+                                 detail::utf8_bytes(last), out);
+}
+
+/** Converts the UTF-16 text in the range [first, last) to UTF-8 and stores it
+    to the range starting at @a out. Returns the end of the output range, or
+    @c nullptr if the input contains unpaired surrogates.
+
+    The output range must have space for @c 3*(last-first) bytes. The
+    elements past the returned end may be overwritten. The blocks
+    of 16 code units that don't contain surrogates are encoded using vector
+    operations, the rest one character at a time.
+*/
+static SIMDPP_INL
+char* utf16_to_utf8(const char16_t* first, const char16_t* last, char* out)
+{
+    return detail::i_utf16_encode(first, last, out);
+}
+
+/** Converts the UTF-32 text in the range [first, last) to UTF-8 and stores it
+    to the range starting at @a out. Returns the end of the output range, or
+    @c nullptr if the input contains surrogates or values above U+10FFFF.
+
+    The output range must have space for @c 4*(last-first) bytes. The
+    elements past the returned end may be overwritten. The blocks
+    of 16 code points of the Basic Multilingual Plane are encoded using vector
+    operations, the rest one character at a time.
+*/
+static SIMDPP_INL
+char* utf32_to_utf8(const char32_t* first, const char32_t* last, char* out)
+{
+    return detail::i_utf32_encode(first, last, out);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -43,4 +43,10 @@
 #define SIMDPP_HAS_FLOAT64_TO_UINT64_CONVERSION 0
 #endif
 
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA || SIMDPP_USE_ALTIVEC
+#define SIMDPP_HAS_INT64_MIN_MAX 1
+#else
+#define SIMDPP_HAS_INT64_MIN_MAX 0
+#endif
+
 #endif
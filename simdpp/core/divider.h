@@ -0,0 +1,158 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+#define LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cstdint>
+#include <type_traits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+/*  Computes floor((hi * 2^B + lo) / d) where B is the number of bits in U.
+    hi must be less than d, so that the result fits into U.
+*/
+template<class U> SIMDPP_INL
+U divider_div_wide(U hi, U lo, U d)
+{
+    const unsigned B = sizeof(U) * 8;
+    for (unsigned i = 0; i < B; ++i) {
+        bool carry = (hi >> (B-1)) != 0;
+        hi = U((hi << 1) | (lo >> (B-1)));
+        lo = U(lo << 1);
+        if (carry || hi >= d) {
+            hi = U(hi - d);
+            lo = U(lo | 1);
+        }
+    }
+    return lo;
+}
+
+// Returns ceil(log2(d)) for d >= 1
+template<class U> SIMDPP_INL
+unsigned divider_ceil_log2(U d)
+{
+    const unsigned B = sizeof(U) * 8;
+    unsigned l = 0;
+    while (l < B && (U(1) << l) < d)
+        l++;
+    return l;
+}
+
+} // namespace detail
+
+/** Holds precomputed constants for the division of integer vectors by a
+    divisor that is known only at runtime and used for many elements. Only
+    the construction involves an actual division, thus it should be done
+    outside loops.
+
+    @a T must be one of uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t,
+    uint64_t and int64_t. The divisor must not be zero.
+
+    The division itself is implemented as a multiplication by a magic number
+    and several shifts (see T. Granlund, P. L. Montgomery, "Division by
+    Invariant Integers using Multiplication"):
+
+    For unsigned types:
+    @code
+    l = ceil(log2(d))
+    m = floor(2^B * (2^l - d) / d) + 1
+    t = high(m * n)
+    q = (t + ((n - t) >> min(l, 1))) >> max(l - 1, 0)
+    @endcode
+
+    For signed types:
+    @code
+    l = max(ceil(log2(abs(d))), 1)
+    m = floor(2^(B+l-1) / abs(d)) + 1 - 2^B
+    q = ((n + high(m * n)) >> (l - 1)) - (n >> (B - 1))
+    q = d < 0 ? -q : q
+    @endcode
+*/
+template<class T>
+class divider {
+public:
+    static_assert(std::is_integral<T>::value && sizeof(T) <= 8 &&
+                  !std::is_same<T, bool>::value,
+                  "T must be an integer type of at most 64 bits");
+
+    using value_type = T;
+
+    explicit divider(T d) :
+        d_(d)
+    {
+        compute(std::is_signed<T>());
+    }
+
+    /// Returns the divisor
+    T divisor() const { return d_; }
+
+    /// Returns the magic multiplier
+    T magic() const { return magic_; }
+
+    /** Returns the shift that is applied before adding the high part of the
+        product. Zero or one. Always zero for signed types.
+    */
+    unsigned pre_shift() const { return pre_shift_; }
+
+    /// Returns the shift that is applied to the final sum
+    unsigned shift() const { return shift_; }
+
+    /// Returns all ones if the divisor is negative, zero otherwise
+    T sign() const { return sign_; }
+
+private:
+    using U = typename std::make_unsigned<T>::type;
+
+    void compute(std::false_type)
+    {
+        U d = U(d_);
+        unsigned l = detail::divider_ceil_log2(d);
+        // 2^l - d wraps around correctly if l is the bit width of the type
+        U hi = U((l < sizeof(U)*8 ? U(U(1) << l) : U(0)) - d);
+        magic_ = T(U(detail::divider_div_wide<U>(hi, 0, d) + 1));
+        pre_shift_ = l > 0 ? 1 : 0;
+        shift_ = l > 0 ? l - 1 : 0;
+        sign_ = 0;
+    }
+
+    void compute(std::true_type)
+    {
+        U ad = d_ < 0 ? U(U(0) - U(d_)) : U(d_);
+        unsigned l = detail::divider_ceil_log2(ad);
+        if (l < 1)
+            l = 1;
+        U m = 0;
+        if (ad != 1) {
+            U hi = U(U(1) << (l - 1));
+            m = detail::divider_div_wide<U>(hi, 0, ad);
+        }
+        // 2^B is not representable, thus the subtraction is implicit
+        magic_ = T(U(m + 1));
+        pre_shift_ = 0;
+        shift_ = l - 1;
+        sign_ = d_ < 0 ? T(-1) : T(0);
+    }
+
+    T d_;
+    T magic_;
+    unsigned pre_shift_;
+    unsigned shift_;
+    T sign_;
+};
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,57 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_EXP_H
+#define LIBSIMDPP_SIMDPP_CORE_F_EXP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+
+/** Computes the base-e exponential.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum error is 1.5 ULP. Subnormal results are supported.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float32<N,expr_empty> exp(const float32<N,E1>& a)
+{
+    return detail::insn::i_exp(a.eval());
+}
+
+/** Computes the base-e exponential.
+
+    @code
+    r0 = exp(a0)
+    ...
+    rN = exp(aN)
+    @endcode
+
+    The maximum error is 2 ULP. Subnormal results are supported.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float64<N,expr_empty> exp(const float64<N,E1>& a)
+{
+    return detail::insn::i_exp(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
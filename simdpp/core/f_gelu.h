@@ -0,0 +1,59 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_GELU_H
+#define LIBSIMDPP_SIMDPP_CORE_F_GELU_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_gelu.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+
+/** Computes the Gaussian error linear unit x/2 * (1 + erf(x/sqrt(2))).
+
+    @code
+    r0 = gelu(a0)
+    ...
+    rN = gelu(aN)
+    @endcode
+
+    The maximum error is 8 ULP for a >= -9 and 16 ULP otherwise.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float32<N,expr_empty> gelu(const float32<N,E1>& a)
+{
+    return detail::insn::i_gelu(a.eval());
+}
+
+/** Computes an approximation of the Gaussian error linear unit.
+
+    @code
+    r0 = gelu(a0)
+    ...
+    rN = gelu(aN)
+    @endcode
+
+    The absolute error is dominated by the error of @c rcp_e, which depends on
+    the architecture (about 12 bits on x86). The relative error is large when
+    the result is close to zero.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float32<N,expr_empty> gelu_e(const float32<N,E1>& a)
+{
+    return detail::insn::i_gelu_e(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,57 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_LOG_H
+#define LIBSIMDPP_SIMDPP_CORE_F_LOG_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_log.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+
+/** Computes the natural logarithm.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 1 ULP.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float32<N,expr_empty> log(const float32<N,E1>& a)
+{
+    return detail::insn::i_log(a.eval());
+}
+
+/** Computes the natural logarithm.
+
+    @code
+    r0 = log(a0)
+    ...
+    rN = log(aN)
+    @endcode
+
+    The maximum error is 1 ULP.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float64<N,expr_empty> log(const float64<N,E1>& a)
+{
+    return detail::insn::i_log(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,57 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_LOG1P_H
+#define LIBSIMDPP_SIMDPP_CORE_F_LOG1P_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_log.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+
+/** Computes the natural logarithm of one plus the argument.
+
+    @code
+    r0 = log1p(a0)
+    ...
+    rN = log1p(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float32<N,expr_empty> log1p(const float32<N,E1>& a)
+{
+    return detail::insn::i_log1p(a.eval());
+}
+
+/** Computes the natural logarithm of one plus the argument.
+
+    @code
+    r0 = log1p(a0)
+    ...
+    rN = log1p(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float64<N,expr_empty> log1p(const float64<N,E1>& a)
+{
+    return detail::insn::i_log1p(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,65 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_POW_H
+#define LIBSIMDPP_SIMDPP_CORE_F_POW_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_pow.h>
+#include <simdpp/core/detail/scalar_arg_impl.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+
+/** Raises the values of the first vector to the power given by the values of
+    the second vector. The special cases follow the C99 pow function.
+
+    @code
+    r0 = pow(a0, b0)
+    ...
+    rN = pow(aN, bN)
+    @endcode
+
+    The computation is performed in float64 precision, the maximum error
+    is 1 ULP.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float32<N,expr_empty> pow(const float32<N,E1>& a, const float32<N,E2>& b)
+{
+    return detail::insn::i_pow(a.eval(), b.eval());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(pow, float32, float32)
+
+/** Raises the values of the first vector to the power given by the values of
+    the second vector. The special cases follow the C99 pow function.
+
+    @code
+    r0 = pow(a0, b0)
+    ...
+    rN = pow(aN, bN)
+    @endcode
+
+    The maximum error is 4.5 ULP.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float64<N,expr_empty> pow(const float64<N,E1>& a, const float64<N,E2>& b)
+{
+    return detail::insn::i_pow(a.eval(), b.eval());
+}
+
+SIMDPP_SCALAR_ARG_IMPL_VEC(pow, float64, float64)
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,65 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_SINCOS_H
+#define LIBSIMDPP_SIMDPP_CORE_F_SINCOS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_sincos.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+
+/** Computes the sine and the cosine at the same time. This is faster than
+    computing them separately.
+
+    @code
+    s0 = sin(a0)
+    c0 = cos(a0)
+    ...
+    sN = sin(aN)
+    cN = cos(aN)
+    @endcode
+
+    The maximum error is 2 ULP for |a| <= 1e8. Larger arguments lose
+    precision. The argument reduction is performed in float64 precision.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+void sincos(float32<N>& s, float32<N>& c, const float32<N,E1>& a)
+{
+    detail::insn::i_sincos(s, c, a.eval());
+}
+
+/** Computes the sine and the cosine at the same time. This is faster than
+    computing them separately.
+
+    @code
+    s0 = sin(a0)
+    c0 = cos(a0)
+    ...
+    sN = sin(aN)
+    cN = cos(aN)
+    @endcode
+
+    The maximum error is 2 ULP for |a| <= 1e7. Larger arguments lose
+    precision.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+void sincos(float64<N>& s, float64<N>& c, const float64<N,E1>& a)
+{
+    detail::insn::i_sincos(s, c, a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,58 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_SOFTPLUS_H
+#define LIBSIMDPP_SIMDPP_CORE_F_SOFTPLUS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_softplus.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+
+/** Computes the softplus function log(1 + exp(x)).
+
+    @code
+    r0 = softplus(a0)
+    ...
+    rN = softplus(aN)
+    @endcode
+
+    The maximum error is 3 ULP.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float32<N,expr_empty> softplus(const float32<N,E1>& a)
+{
+    return detail::insn::i_softplus(a.eval());
+}
+
+/** Computes an approximation of the softplus function.
+
+    @code
+    r0 = softplus(a0)
+    ...
+    rN = softplus(aN)
+    @endcode
+
+    The relative error is dominated by the error of @c rcp_e, which depends on
+    the architecture (about 12 bits on x86).
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float32<N,expr_empty> softplus_e(const float32<N,E1>& a)
+{
+    return detail::insn::i_softplus_e(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,59 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_TAN_H
+#define LIBSIMDPP_SIMDPP_CORE_F_TAN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_sincos.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+
+/** Computes the tangent.
+
+    @code
+    r0 = tan(a0)
+    ...
+    rN = tan(aN)
+    @endcode
+
+    The maximum error is 3.5 ULP for |a| <= 1e8. Larger arguments lose
+    precision. The argument reduction is performed in float64 precision.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float32<N,expr_empty> tan(const float32<N,E1>& a)
+{
+    return detail::insn::i_tan(a.eval());
+}
+
+/** Computes the tangent.
+
+    @code
+    r0 = tan(a0)
+    ...
+    rN = tan(aN)
+    @endcode
+
+    The maximum error is 3.5 ULP for |a| <= 1e7. Larger arguments lose
+    precision.
+*/
+template<unsigned N, class E1> SIMDPP_INL
+float64<N,expr_empty> tan(const float64<N,E1>& a)
+{
+    return detail::insn::i_tan(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
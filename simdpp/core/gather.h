@@ -0,0 +1,228 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_GATHER_H
+#define LIBSIMDPP_SIMDPP_CORE_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/to_int64.h>
+#include <simdpp/detail/insn/gather.h>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads elements from memory locations specified by a vector of indices.
+    The indices are in units of elements.
+
+    @code
+    r0 = p[idx0]
+    ...
+    rN = p[idxN]
+    @endcode
+
+    32-bit indices must be in range [0, 2^31) because the native gather
+    instructions treat them as signed values.
+
+    Native gather instructions are used on AVX2 and AVX512F. On other
+    architectures each element is loaded separately.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> gather(const uint32_t* p, const uint32<N,E>& idx)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return r;
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> gather(const int32_t* p, const uint32<N,E>& idx)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return (int32<N>) r;
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> gather(const float* p, const uint32<N,E>& idx)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return bit_cast<float32<N>>(r);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> gather(const uint64_t* p, const uint32<N,E>& idx)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return r;
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> gather(const int64_t* p, const uint32<N,E>& idx)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return (int64<N>) r;
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> gather(const double* p, const uint32<N,E>& idx)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return bit_cast<float64<N>>(r);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> gather(const uint64_t* p, const uint64<N,E>& idx)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return r;
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> gather(const int64_t* p, const uint64<N,E>& idx)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return (int64<N>) r;
+}
+
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> gather(const double* p, const uint64<N,E>& idx)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> r = detail::insn::i_gather(reinterpret_cast<const char*>(p), i);
+    return bit_cast<float64<N>>(r);
+}
+
+/** Loads elements from memory locations specified by a vector of indices.
+    Only the elements for which the corresponding lane of the mask is set are
+    loaded; the rest of the elements are set to zero and the memory
+    locations they refer to are not accessed. The indices are in units of
+    elements.
+
+    @code
+    r0 = mask0 ? p[idx0] : 0
+    ...
+    rN = maskN ? p[idxN] : 0
+    @endcode
+
+    32-bit indices must be in range [0, 2^31) because the native gather
+    instructions treat them as signed values.
+*/
+template<unsigned N, class E, class M> SIMDPP_INL
+uint32<N,expr_empty> gather_masked(const uint32_t* p, const uint32<N,E>& idx,
+                                   const mask_int32<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint32<N> i = idx.eval();
+    mask_int32<N> m = mask.eval();
+    uint32<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return r;
+}
+
+template<unsigned N, class E, class M> SIMDPP_INL
+int32<N,expr_empty> gather_masked(const int32_t* p, const uint32<N,E>& idx,
+                                  const mask_int32<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint32<N> i = idx.eval();
+    mask_int32<N> m = mask.eval();
+    uint32<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return (int32<N>) r;
+}
+
+template<unsigned N, class E, class M> SIMDPP_INL
+float32<N,expr_empty> gather_masked(const float* p, const uint32<N,E>& idx,
+                                    const mask_float32<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint32<N> i = idx.eval();
+    mask_int32<N> m = bit_cast<mask_int32<N>>(mask.eval());
+    uint32<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return bit_cast<float32<N>>(r);
+}
+
+template<unsigned N, class E, class M> SIMDPP_INL
+uint64<N,expr_empty> gather_masked(const uint64_t* p, const uint32<N,E>& idx,
+                                   const mask_int64<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint64<N> i = to_uint64(idx);
+    mask_int64<N> m = mask.eval();
+    uint64<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return r;
+}
+
+template<unsigned N, class E, class M> SIMDPP_INL
+int64<N,expr_empty> gather_masked(const int64_t* p, const uint32<N,E>& idx,
+                                  const mask_int64<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint64<N> i = to_uint64(idx);
+    mask_int64<N> m = mask.eval();
+    uint64<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return (int64<N>) r;
+}
+
+template<unsigned N, class E, class M> SIMDPP_INL
+float64<N,expr_empty> gather_masked(const double* p, const uint32<N,E>& idx,
+                                    const mask_float64<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint64<N> i = to_uint64(idx);
+    mask_int64<N> m = bit_cast<mask_int64<N>>(mask.eval());
+    uint64<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return bit_cast<float64<N>>(r);
+}
+
+template<unsigned N, class E, class M> SIMDPP_INL
+uint64<N,expr_empty> gather_masked(const uint64_t* p, const uint64<N,E>& idx,
+                                   const mask_int64<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint64<N> i = idx.eval();
+    mask_int64<N> m = mask.eval();
+    uint64<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return r;
+}
+
+template<unsigned N, class E, class M> SIMDPP_INL
+int64<N,expr_empty> gather_masked(const int64_t* p, const uint64<N,E>& idx,
+                                  const mask_int64<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint64<N> i = idx.eval();
+    mask_int64<N> m = mask.eval();
+    uint64<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return (int64<N>) r;
+}
+
+template<unsigned N, class E, class M> SIMDPP_INL
+float64<N,expr_empty> gather_masked(const double* p, const uint64<N,E>& idx,
+                                    const mask_float64<N,M>& mask)
+{
+    const char* cp = reinterpret_cast<const char*>(p);
+    uint64<N> i = idx.eval();
+    mask_int64<N> m = bit_cast<mask_int64<N>>(mask.eval());
+    uint64<N> r = detail::insn::i_gather_masked(cp, i, m);
+    return bit_cast<float64<N>>(r);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
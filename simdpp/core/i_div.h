@@ -0,0 +1,150 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+#define LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/detail/insn/i_div.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Divides integer elements by a divisor that is known only at runtime. The
+    result is rounded towards zero, as in the scalar integer division. See
+    the documentation of divider for the details of the algorithm.
+
+    @code
+    r0 = a0 / d
+    ...
+    rN = aN / d
+    @endcode
+
+    The division is implemented as a multiplication of the elements by a
+    magic number, followed by several additions and shifts. 8-bit elements are
+    multiplied as 16-bit elements, 32-bit elements are multiplied using mull.
+    The high halves of the products of 64-bit elements are computed one
+    element at a time on all architectures.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> div(const uint8<N,E>& a, const divider<uint8_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> div(const int8<N,E>& a, const divider<int8_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> div(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> div(const int16<N,E>& a, const divider<int16_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> div(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> div(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> div(const uint64<N,E>& a, const divider<uint64_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> div(const int64<N,E>& a, const divider<int64_t>& d)
+{
+    return detail::insn::i_div(a.eval(), d);
+}
+
+/** Computes the remainder of the division of integer elements by a divisor
+    that is known only at runtime. The sign of the result is the same as the
+    sign of the dividend, as in the scalar integer division.
+
+    @code
+    r0 = a0 % d
+    ...
+    rN = aN % d
+    @endcode
+
+    The remainder is computed as <tt>a - div(a, d) * d</tt>.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> mod(const uint8<N,E>& a, const divider<uint8_t>& d)
+{
+    return detail::insn::i_mod(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> mod(const int8<N,E>& a, const divider<int8_t>& d)
+{
+    return detail::insn::i_mod(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> mod(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_mod(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> mod(const int16<N,E>& a, const divider<int16_t>& d)
+{
+    return detail::insn::i_mod(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> mod(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_mod(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> mod(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_mod(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> mod(const uint64<N,E>& a, const divider<uint64_t>& d)
+{
+    return detail::insn::i_mod(a.eval(), d);
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> mod(const int64<N,E>& a, const divider<int64_t>& d)
+{
+    return detail::insn::i_mod(a.eval(), d);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
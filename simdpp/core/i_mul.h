@@ -126,6 +126,164 @@ typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
 
 SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int32, int32, uint32)
 
+/** Multiplies signed 32-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSSE3, 13-17}
+    @icost{SSE4.1-AVX, 6}
+    @icost{NEON, 3}
+
+    @par 256-bit version:
+    @icost{SSE2-SSSE3, 26-34}
+    @icost{SSE4.1-AVX, 12}
+    @icost{AVX2, 6}
+    @icost{NEON, 6}
+
+    @par 512-bit version:
+    @icost{AVX512F, 6}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N, expr_mul_hi<int32<N,E1>,
+                     int32<N,E2>>> mul_hi(const int32<N,E1>& a,
+                                          const int32<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, int32, int32)
+
+/** Multiplies unsigned 32-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 6-7}
+    @icost{NEON, 3}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 12-14}
+    @icost{AVX2, 6}
+    @icost{NEON, 6}
+
+    @par 512-bit version:
+    @icost{AVX512F, 6}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N, expr_mul_hi<uint32<N,E1>,
+                      uint32<N,E2>>> mul_hi(const uint32<N,E1>& a,
+                                            const uint32<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, uint32, uint32)
+
+/** Multiplies 64-bit values and returns the lower half of the result.
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    The multiplication is composed of three 32x32-bit multiplications on
+    architectures that don't support 64-bit multiplication natively.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, 8-12}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 16-24}
+    @icost{AVX2-AVX512F, 8}
+
+    @par 512-bit version:
+    @icost{AVX512F, 8}
+    @icost{AVX512DQ, 1}
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
+        mul_lo(const any_int64<N,V1>& a,
+               const any_int64<N,V2>& b)
+{
+    using expr = typename detail::get_expr_uint<expr_mul_lo, V1, V2>;
+    return { { detail::cast_expr<typename expr::v1_type>(a.wrapped()),
+               detail::cast_expr<typename expr::v2_type>(b.wrapped()) } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(mul_lo, expr_mul_lo, any_int64, int64, uint64)
+
+/** Multiplies signed 64-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    The multiplication is composed of four 32x32-bit multiplications. The
+    signed result is computed from the unsigned one.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, 25-36}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 50-72}
+    @icost{AVX2-AVX512F, 25-30}
+
+    @par 512-bit version:
+    @icost{AVX512F, 25}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N, expr_mul_hi<int64<N,E1>,
+                     int64<N,E2>>> mul_hi(const int64<N,E1>& a,
+                                          const int64<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, int64, int64)
+
+/** Multiplies unsigned 64-bit values and returns the higher half of the
+    result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    The multiplication is composed of four 32x32-bit multiplications.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, 18-26}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 36-52}
+    @icost{AVX2-AVX512F, 18}
+
+    @par 512-bit version:
+    @icost{AVX512F, 18}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N, expr_mul_hi<uint64<N,E1>,
+                      uint64<N,E2>>> mul_hi(const uint64<N,E1>& a,
+                                            const uint64<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, uint64, uint64)
+
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
@@ -141,6 +141,113 @@ uint64<N,expr_empty> shift_l(const uint64<N,E>& a, unsigned count)
     return detail::insn::i_shift_l(a.eval(), count);
 }
 
+/** Shifts 16-bit values left by the number of bits in the corresponding
+    element of @a count while shifting in zeros.
+
+    @code
+    r0 = a0 << count0
+    ...
+    rN = aN << countN
+    @endcode
+
+    The result is unspecified for elements whose count is 16 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 23}
+    @icost{AVX2, 8}
+    @icost{NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 46}
+    @icost{AVX2, 8}
+    @icost{NEON, ALTIVEC, 2}
+
+    @par 512-bit version:
+    @icost{AVX512BW, 1}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int16<N,expr_empty> shift_l(const int16<N,E1>& a, const uint16<N,E2>& count)
+{
+    uint16<N> qa = a.eval();
+    return detail::insn::i_shift_l(qa, count.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint16<N,expr_empty> shift_l(const uint16<N,E1>& a, const uint16<N,E2>& count)
+{
+    return detail::insn::i_shift_l(a.eval(), count.eval());
+}
+
+/** Shifts 32-bit values left by the number of bits in the corresponding
+    element of @a count while shifting in zeros.
+
+    @code
+    r0 = a0 << count0
+    ...
+    rN = aN << countN
+    @endcode
+
+    The result is unspecified for elements whose count is 32 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-SSSE3, 11}
+    @icost{SSE4.1-AVX, 4}
+    @icost{AVX2, NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-SSSE3, 22}
+    @icost{SSE4.1-AVX, 8}
+    @icost{AVX2, 1}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N,expr_empty> shift_l(const int32<N,E1>& a, const uint32<N,E2>& count)
+{
+    uint32<N> qa = a.eval();
+    return detail::insn::i_shift_l(qa, count.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N,expr_empty> shift_l(const uint32<N,E1>& a, const uint32<N,E2>& count)
+{
+    return detail::insn::i_shift_l(a.eval(), count.eval());
+}
+
+/** Shifts 64-bit values left by the number of bits in the corresponding
+    element of @a count while shifting in zeros.
+
+    @code
+    r0 = a0 << count0
+    ...
+    rN = aN << countN
+    @endcode
+
+    The result is unspecified for elements whose count is 64 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 4}
+    @icost{AVX2, NEON, 1}
+    @unimp{ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 8}
+    @icost{AVX2, 1}
+    @icost{NEON, 2}
+    @unimp{ALTIVEC}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N,expr_empty> shift_l(const int64<N,E1>& a, const uint64<N,E2>& count)
+{
+    uint64<N> qa = a.eval();
+    return detail::insn::i_shift_l(qa, count.eval());
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N,expr_empty> shift_l(const uint64<N,E1>& a, const uint64<N,E2>& count)
+{
+    return detail::insn::i_shift_l(a.eval(), count.eval());
+}
+
 /** Shifts 8-bit values left by @a count bits while shifting in zeros.
 
     @code
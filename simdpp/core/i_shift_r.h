@@ -220,6 +220,178 @@ uint64<N,expr_empty> shift_r(const uint64<N,E>& a, unsigned count)
     return detail::insn::i_shift_r(a.eval(), count);
 }
 
+/** Shifts signed 16-bit values right by the number of bits in the
+    corresponding element of @a count while shifting in the sign bit.
+
+    @code
+    r0 = a0 >> count0
+    ...
+    rN = aN >> countN
+    @endcode
+
+    The result is unspecified for elements whose count is 16 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 23}
+    @icost{AVX2, 10}
+    @icost{NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 46}
+    @icost{AVX2, 10}
+    @icost{NEON, ALTIVEC, 2}
+
+    @par 512-bit version:
+    @icost{AVX512BW, 1}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int16<N,expr_empty> shift_r(const int16<N,E1>& a, const uint16<N,E2>& count)
+{
+    return detail::insn::i_shift_r(a.eval(), count.eval());
+}
+
+/** Shifts unsigned 16-bit values right by the number of bits in the
+    corresponding element of @a count while shifting in zeros.
+
+    @code
+    r0 = a0 >> count0
+    ...
+    rN = aN >> countN
+    @endcode
+
+    The result is unspecified for elements whose count is 16 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 23}
+    @icost{AVX2, 10}
+    @icost{NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 46}
+    @icost{AVX2, 10}
+    @icost{NEON, ALTIVEC, 2}
+
+    @par 512-bit version:
+    @icost{AVX512BW, 1}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint16<N,expr_empty> shift_r(const uint16<N,E1>& a, const uint16<N,E2>& count)
+{
+    return detail::insn::i_shift_r(a.eval(), count.eval());
+}
+
+/** Shifts signed 32-bit values right by the number of bits in the
+    corresponding element of @a count while shifting in the sign bit.
+
+    @code
+    r0 = a0 >> count0
+    ...
+    rN = aN >> countN
+    @endcode
+
+    The result is unspecified for elements whose count is 32 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 14}
+    @icost{AVX2, NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 28}
+    @icost{AVX2, 1}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N,expr_empty> shift_r(const int32<N,E1>& a, const uint32<N,E2>& count)
+{
+    return detail::insn::i_shift_r(a.eval(), count.eval());
+}
+
+/** Shifts unsigned 32-bit values right by the number of bits in the
+    corresponding element of @a count while shifting in zeros.
+
+    @code
+    r0 = a0 >> count0
+    ...
+    rN = aN >> countN
+    @endcode
+
+    The result is unspecified for elements whose count is 32 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 14}
+    @icost{AVX2, NEON, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 28}
+    @icost{AVX2, 1}
+    @icost{NEON, ALTIVEC, 2}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N,expr_empty> shift_r(const uint32<N,E1>& a, const uint32<N,E2>& count)
+{
+    return detail::insn::i_shift_r(a.eval(), count.eval());
+}
+
+/** Shifts signed 64-bit values right by the number of bits in the
+    corresponding element of @a count while shifting in the sign bit.
+
+    @code
+    r0 = a0 >> count0
+    ...
+    rN = aN >> countN
+    @endcode
+
+    The result is unspecified for elements whose count is 64 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 9}
+    @icost{AVX2, 5}
+    @icost{NEON, 2}
+    @unimp{ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 18}
+    @icost{AVX2, 5}
+    @icost{NEON, 4}
+    @unimp{ALTIVEC}
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N,expr_empty> shift_r(const int64<N,E1>& a, const uint64<N,E2>& count)
+{
+    return detail::insn::i_shift_r(a.eval(), count.eval());
+}
+
+/** Shifts unsigned 64-bit values right by the number of bits in the
+    corresponding element of @a count while shifting in zeros.
+
+    @code
+    r0 = a0 >> count0
+    ...
+    rN = aN >> countN
+    @endcode
+
+    The result is unspecified for elements whose count is 64 or more.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX, 4}
+    @icost{AVX2, NEON, 1}
+    @unimp{ALTIVEC}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 8}
+    @icost{AVX2, 1}
+    @icost{NEON, 2}
+    @unimp{ALTIVEC}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N,expr_empty> shift_r(const uint64<N,E1>& a, const uint64<N,E2>& count)
+{
+    return detail::insn::i_shift_r(a.eval(), count.eval());
+}
+
 /** Shifts signed 8-bit values right by @a count bits while shifting in the
     sign bit.
 
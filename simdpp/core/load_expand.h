@@ -0,0 +1,142 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_EXPAND_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_EXPAND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/load_expand.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads consecutive elements from memory to the lanes of a vector for which
+    the mask is set. The rest of the lanes are set to zero. The type of the
+    result is determined by the type of the mask. Only the loaded elements
+    are accessed, thus the memory past them does not need to be readable.
+
+    @code
+    n = 0
+    for (i = 0; i < N; ++i)
+        r[i] = mask[i] ? p[n++] : 0
+    @endcode
+
+    The pointer does not need to be aligned.
+
+    Native expand instructions are used for 32-bit and 64-bit elements on
+    AVX512F. On AVX2 256-bit vectors of 32-bit and 64-bit elements are
+    distributed using a permutation with lookup tables indexed by the mask
+    bits. On SSSE3, NEON, ALTIVEC and MSA the elements are distributed using a
+    byte shuffle with lookup tables within each 128-bit lane. On other
+    architectures each element is loaded separately.
+
+    The elements are loaded as in load_partial(). load_expand_unsafe_tail()
+    is faster if the memory past the loaded elements is known to be
+    readable.
+*/
+template<unsigned N, class M> SIMDPP_INL
+uint8<N,expr_empty> load_expand(const void* p, const mask_int8<N,M>& mask)
+{
+    mask_int8<N> rm = mask.wrapped().eval();
+    return detail::insn::i_load_expand<uint8<N>, false>(reinterpret_cast<const char*>(p), rm);
+}
+template<unsigned N, class M> SIMDPP_INL
+uint16<N,expr_empty> load_expand(const void* p, const mask_int16<N,M>& mask)
+{
+    mask_int16<N> rm = mask.wrapped().eval();
+    return detail::insn::i_load_expand<uint16<N>, false>(reinterpret_cast<const char*>(p), rm);
+}
+template<unsigned N, class M> SIMDPP_INL
+uint32<N,expr_empty> load_expand(const void* p, const mask_int32<N,M>& mask)
+{
+    mask_int32<N> rm = mask.wrapped().eval();
+    return detail::insn::i_load_expand<uint32<N>, false>(reinterpret_cast<const char*>(p), rm);
+}
+template<unsigned N, class M> SIMDPP_INL
+uint64<N,expr_empty> load_expand(const void* p, const mask_int64<N,M>& mask)
+{
+    mask_int64<N> rm = mask.wrapped().eval();
+    return detail::insn::i_load_expand<uint64<N>, false>(reinterpret_cast<const char*>(p), rm);
+}
+template<unsigned N, class M> SIMDPP_INL
+float32<N,expr_empty> load_expand(const void* p, const mask_float32<N,M>& mask)
+{
+    mask_int32<N> rm = bit_cast<mask_int32<N>>(mask.wrapped().eval());
+    uint32<N> r = detail::insn::i_load_expand<uint32<N>, false>(reinterpret_cast<const char*>(p), rm);
+    return bit_cast<float32<N>>(r);
+}
+template<unsigned N, class M> SIMDPP_INL
+float64<N,expr_empty> load_expand(const void* p, const mask_float64<N,M>& mask)
+{
+    mask_int64<N> rm = bit_cast<mask_int64<N>>(mask.wrapped().eval());
+    uint64<N> r = detail::insn::i_load_expand<uint64<N>, false>(reinterpret_cast<const char*>(p), rm);
+    return bit_cast<float64<N>>(r);
+}
+
+/** Loads consecutive elements from memory to the lanes of a vector for which
+    the mask is set. The rest of the lanes are set to zero. The type of the
+    result is determined by the type of the mask. Unlike load_expand(), up to
+    one vector of memory past the loaded elements may be read, thus it must
+    be readable.
+
+    @code
+    n = 0
+    for (i = 0; i < N; ++i)
+        r[i] = mask[i] ? p[n++] : 0
+    // p[n] ... p[n+N-1] may be read
+    @endcode
+
+    The pointer does not need to be aligned.
+*/
+template<unsigned N, class M> SIMDPP_INL
+uint8<N,expr_empty> load_expand_unsafe_tail(const void* p, const mask_int8<N,M>& mask)
+{
+    mask_int8<N> rm = mask.wrapped().eval();
+    return detail::insn::i_load_expand<uint8<N>, true>(reinterpret_cast<const char*>(p), rm);
+}
+template<unsigned N, class M> SIMDPP_INL
+uint16<N,expr_empty> load_expand_unsafe_tail(const void* p, const mask_int16<N,M>& mask)
+{
+    mask_int16<N> rm = mask.wrapped().eval();
+    return detail::insn::i_load_expand<uint16<N>, true>(reinterpret_cast<const char*>(p), rm);
+}
+template<unsigned N, class M> SIMDPP_INL
+uint32<N,expr_empty> load_expand_unsafe_tail(const void* p, const mask_int32<N,M>& mask)
+{
+    mask_int32<N> rm = mask.wrapped().eval();
+    return detail::insn::i_load_expand<uint32<N>, true>(reinterpret_cast<const char*>(p), rm);
+}
+template<unsigned N, class M> SIMDPP_INL
+uint64<N,expr_empty> load_expand_unsafe_tail(const void* p, const mask_int64<N,M>& mask)
+{
+    mask_int64<N> rm = mask.wrapped().eval();
+    return detail::insn::i_load_expand<uint64<N>, true>(reinterpret_cast<const char*>(p), rm);
+}
+template<unsigned N, class M> SIMDPP_INL
+float32<N,expr_empty> load_expand_unsafe_tail(const void* p, const mask_float32<N,M>& mask)
+{
+    mask_int32<N> rm = bit_cast<mask_int32<N>>(mask.wrapped().eval());
+    uint32<N> r = detail::insn::i_load_expand<uint32<N>, true>(reinterpret_cast<const char*>(p), rm);
+    return bit_cast<float32<N>>(r);
+}
+template<unsigned N, class M> SIMDPP_INL
+float64<N,expr_empty> load_expand_unsafe_tail(const void* p, const mask_float64<N,M>& mask)
+{
+    mask_int64<N> rm = bit_cast<mask_int64<N>>(mask.wrapped().eval());
+    uint64<N> r = detail::insn::i_load_expand<uint64<N>, true>(reinterpret_cast<const char*>(p), rm);
+    return bit_cast<float64<N>>(r);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,66 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_MASKED_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_masked.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the elements of a 32-bit or 64-bit integer or floating-point vector
+    for which the corresponding mask element is set. The inactive elements of
+    the result are set to zero.
+
+    @code
+    r0 = mask[0] ? *(p) : 0
+    ...
+    rN = mask[N] ? *(p+N) : 0
+    @endcode
+
+    The pointer must be aligned to the native vector size. Memory of the
+    inactive elements is not accessed on AVX and AVX512F. On other
+    architectures the whole native vector is loaded if at least one of its
+    elements is active. This never faults because an aligned vector does not
+    cross a page boundary.
+*/
+template<unsigned N, class M> SIMDPP_INL
+uint32<N> load_masked(const void* p, const mask_int32<N,M>& mask)
+{
+    return detail::insn::i_load_masked<uint32<N>>(reinterpret_cast<const char*>(p),
+                                                  mask.wrapped().eval());
+}
+template<unsigned N, class M> SIMDPP_INL
+uint64<N> load_masked(const void* p, const mask_int64<N,M>& mask)
+{
+    return detail::insn::i_load_masked<uint64<N>>(reinterpret_cast<const char*>(p),
+                                                  mask.wrapped().eval());
+}
+template<unsigned N, class M> SIMDPP_INL
+float32<N> load_masked(const void* p, const mask_float32<N,M>& mask)
+{
+    return detail::insn::i_load_masked<float32<N>>(reinterpret_cast<const char*>(p),
+                                                   mask.wrapped().eval());
+}
+template<unsigned N, class M> SIMDPP_INL
+float64<N> load_masked(const void* p, const mask_float64<N,M>& mask)
+{
+    return detail::insn::i_load_masked<float64<N>>(reinterpret_cast<const char*>(p),
+                                                   mask.wrapped().eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,55 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_PARTIAL_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_PARTIAL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_partial.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the first @a n elements of a vector from an unaligned memory
+    location. The rest of the elements are set to zero. If @a n is not less
+    than the number of elements in the vector, the whole vector is loaded.
+
+    @code
+    r0 = 0 < n ? *(p) : 0
+    ...
+    rN = N < n ? *(p+N) : 0
+    @endcode
+
+    @a p must be aligned to the element size. The load never faults on memory
+    past the first @a n elements. On AVX and AVX2 the 32-bit and 64-bit
+    elements are loaded with masked loads, on AVX512F (and AVX512BW for 8-bit
+    and 16-bit elements) with mask registers. On other architectures the whole
+    vector is loaded and the trailing elements are cleared if the vector does
+    not cross a page boundary. Otherwise the elements are loaded one by one.
+*/
+SIMDPP_INL expr_vec_load_partial load_partial(const void* p, unsigned n)
+{
+    return { reinterpret_cast<const char*>(p), n };
+}
+
+template<class V> SIMDPP_INL
+V load_partial(const void* p, unsigned n)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value,
+                  "V must be a non-mask vector");
+    return detail::insn::i_load_partial_any<V>(reinterpret_cast<const char*>(p), n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,52 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_PREFIX_SUM_H
+#define LIBSIMDPP_SIMDPP_CORE_PREFIX_SUM_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/get_expr.h>
+#include <simdpp/detail/insn/prefix_sum.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the inclusive prefix sum of the elements in the vector.
+
+    @code
+    r0 = a0
+    r1 = a0 + a1
+    ...
+    rN = a0 + a1 + ... + aN
+    @endcode
+
+    Integer sums wrap around on overflow. The floating-point sums are computed
+    in a different order than a sequential loop would, thus the results may
+    differ in the last bits.
+
+    The sum within each 128-bit lane is computed in log2(L) shift-and-add
+    steps, where L is the number of elements in the lane. The sums of the
+    preceding lanes and native vectors are then added to the higher ones.
+*/
+template<unsigned N, class V> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        prefix_sum(const any_vec<N,V>& a)
+{
+    static_assert(!is_mask<V>::value, "Masks are not supported");
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_prefix_sum(ra);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
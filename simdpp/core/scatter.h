@@ -0,0 +1,221 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+#define LIBSIMDPP_SIMDPP_CORE_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/to_int64.h>
+#include <simdpp/detail/insn/scatter.h>
+#include <cstdint>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores elements to memory locations specified by a vector of indices.
+    The indices are in units of elements. The elements are stored in the
+    order of increasing lane index, thus if several indices refer to the same
+    location, the element in the last of these lanes is stored.
+
+    @code
+    p[idx0] = a0
+    ...
+    p[idxN] = aN
+    @endcode
+
+    32-bit indices must be in range [0, 2^31) because the native scatter
+    instructions treat them as signed values.
+
+    Native scatter instructions are used on AVX512F. On other architectures
+    each element is stored separately.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(uint32_t* p, const uint32<N,E1>& idx, const uint32<N,E2>& a)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> ra = a.eval();
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(int32_t* p, const uint32<N,E1>& idx, const int32<N,E2>& a)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> ra = bit_cast<uint32<N>>(a.eval());
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(float* p, const uint32<N,E1>& idx, const float32<N,E2>& a)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> ra = bit_cast<uint32<N>>(a.eval());
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(uint64_t* p, const uint32<N,E1>& idx, const uint64<N,E2>& a)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> ra = a.eval();
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(int64_t* p, const uint32<N,E1>& idx, const int64<N,E2>& a)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> ra = bit_cast<uint64<N>>(a.eval());
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(double* p, const uint32<N,E1>& idx, const float64<N,E2>& a)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> ra = bit_cast<uint64<N>>(a.eval());
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(uint64_t* p, const uint64<N,E1>& idx, const uint64<N,E2>& a)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> ra = a.eval();
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(int64_t* p, const uint64<N,E1>& idx, const int64<N,E2>& a)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> ra = bit_cast<uint64<N>>(a.eval());
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void scatter(double* p, const uint64<N,E1>& idx, const float64<N,E2>& a)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> ra = bit_cast<uint64<N>>(a.eval());
+    detail::insn::i_scatter(reinterpret_cast<char*>(p), i, ra);
+}
+
+/** Stores elements to memory locations specified by a vector of indices.
+    Only the elements for which the corresponding lane of the mask is set are
+    stored. The indices are in units of elements. If several active lanes
+    refer to the same location, the element in the last of these lanes is
+    stored.
+
+    @code
+    if (mask0) p[idx0] = a0
+    ...
+    if (maskN) p[idxN] = aN
+    @endcode
+
+    32-bit indices must be in range [0, 2^31) because the native scatter
+    instructions treat them as signed values.
+*/
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(uint32_t* p, const uint32<N,E1>& idx, const uint32<N,E2>& a,
+                    const mask_int32<N,M>& mask)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> ra = a.eval();
+    mask_int32<N> m = mask.eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(int32_t* p, const uint32<N,E1>& idx, const int32<N,E2>& a,
+                    const mask_int32<N,M>& mask)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> ra = bit_cast<uint32<N>>(a.eval());
+    mask_int32<N> m = mask.eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(float* p, const uint32<N,E1>& idx, const float32<N,E2>& a,
+                    const mask_float32<N,M>& mask)
+{
+    uint32<N> i = idx.eval();
+    uint32<N> ra = bit_cast<uint32<N>>(a.eval());
+    mask_int32<N> m = bit_cast<mask_int32<N>>(mask.eval());
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(uint64_t* p, const uint32<N,E1>& idx, const uint64<N,E2>& a,
+                    const mask_int64<N,M>& mask)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> ra = a.eval();
+    mask_int64<N> m = mask.eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(int64_t* p, const uint32<N,E1>& idx, const int64<N,E2>& a,
+                    const mask_int64<N,M>& mask)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> ra = bit_cast<uint64<N>>(a.eval());
+    mask_int64<N> m = mask.eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(double* p, const uint32<N,E1>& idx, const float64<N,E2>& a,
+                    const mask_float64<N,M>& mask)
+{
+    uint64<N> i = to_uint64(idx);
+    uint64<N> ra = bit_cast<uint64<N>>(a.eval());
+    mask_int64<N> m = bit_cast<mask_int64<N>>(mask.eval());
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(uint64_t* p, const uint64<N,E1>& idx, const uint64<N,E2>& a,
+                    const mask_int64<N,M>& mask)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> ra = a.eval();
+    mask_int64<N> m = mask.eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(int64_t* p, const uint64<N,E1>& idx, const int64<N,E2>& a,
+                    const mask_int64<N,M>& mask)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> ra = bit_cast<uint64<N>>(a.eval());
+    mask_int64<N> m = mask.eval();
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+template<unsigned N, class E1, class E2, class M> SIMDPP_INL
+void scatter_masked(double* p, const uint64<N,E1>& idx, const float64<N,E2>& a,
+                    const mask_float64<N,M>& mask)
+{
+    uint64<N> i = idx.eval();
+    uint64<N> ra = bit_cast<uint64<N>>(a.eval());
+    mask_int64<N> m = bit_cast<mask_int64<N>>(mask.eval());
+    detail::insn::i_scatter_masked(reinterpret_cast<char*>(p), i, ra, m);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
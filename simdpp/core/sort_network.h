@@ -0,0 +1,204 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_SORT_NETWORK_H
+#define LIBSIMDPP_SIMDPP_CORE_SORT_NETWORK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/sort_network.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Sorts the 32-bit elements within each 128-bit lane of a vector in
+    ascending order.
+
+    Mask or expression vectors are not supported.
+
+    @code
+    r = [ sort(a0, a1, a2, a3) ; sort(a4, a5, a6, a7) ; ... ]
+    @endcode
+
+    A bitonic sorting network built from min(), max(), permute4() and
+    shuffle4x2() is used. The floating-point elements must not be NaN. The
+    sign of zero elements is not preserved.
+
+    On SSE2-SSSE3 min() and max() of 32-bit integers are emulated, thus the
+    network is considerably slower there.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void sort_network(any_vec32<N,V>& a)
+{
+    static_assert(!is_mask<V>::value, "Mask vectors are not supported");
+    static_assert(is_value_vector<V>::value, "Expression vectors are not supported");
+    detail::insn::i_sort_network(a.wrapped());
+}
+
+/** Sorts the 64-bit elements within each 128-bit lane of a vector in
+    ascending order.
+
+    Mask or expression vectors are not supported.
+
+    @code
+    r = [ sort(a0, a1) ; sort(a2, a3) ; ... ]
+    @endcode
+
+    The floating-point elements must not be NaN. The sign of zero elements is
+    not preserved.
+
+    Supported since AVX2, NEON64 for 64-bit integer elements. Not supported on
+    SSE2-AVX, NEON32.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void sort_network(any_vec64<N,V>& a)
+{
+    static_assert(!is_mask<V>::value, "Mask vectors are not supported");
+    static_assert(is_value_vector<V>::value, "Expression vectors are not supported");
+    detail::insn::i_sort_network(a.wrapped());
+}
+
+/** Sorts the 32-bit elements within the same 128-bit lanes of two vectors in
+    ascending order. The sorted sequence of each lane starts in @a a0 and
+    continues in @a a1.
+
+    Mask or expression vectors are not supported.
+
+    @code
+    [ r0_0 .. r0_3 ; r1_0 .. r1_3 ] = sort(a0_0 .. a0_3 ; a1_0 .. a1_3)
+    ...
+    @endcode
+
+    See sort_network(any_vec32&) for details.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void sort_network(any_vec32<N,V>& a0, any_vec32<N,V>& a1)
+{
+    static_assert(!is_mask<V>::value, "Mask vectors are not supported");
+    static_assert(is_value_vector<V>::value, "Expression vectors are not supported");
+    detail::insn::i_sort_network(a0.wrapped(), a1.wrapped());
+}
+
+/** Sorts the 64-bit elements within the same 128-bit lanes of two vectors in
+    ascending order. The sorted sequence of each lane starts in @a a0 and
+    continues in @a a1.
+
+    Mask or expression vectors are not supported.
+
+    @code
+    [ r0_0, r0_1 ; r1_0, r1_1 ] = sort(a0_0, a0_1 ; a1_0, a1_1)
+    ...
+    @endcode
+
+    See sort_network(any_vec64&) for details.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void sort_network(any_vec64<N,V>& a0, any_vec64<N,V>& a1)
+{
+    static_assert(!is_mask<V>::value, "Mask vectors are not supported");
+    static_assert(is_value_vector<V>::value, "Expression vectors are not supported");
+    detail::insn::i_sort_network(a0.wrapped(), a1.wrapped());
+}
+
+/** Sorts the 32-bit elements within the same 128-bit lanes of three vectors
+    in ascending order. The sorted sequence of each lane starts in @a a0 and
+    continues in @a a1 and @a a2.
+
+    Mask or expression vectors are not supported.
+
+    @code
+    [ r0_0 .. r0_3 ; ... ; r2_0 .. r2_3 ] = sort(a0_0 .. a0_3 ; ... ; a2_0 .. a2_3)
+    ...
+    @endcode
+
+    The lanes of @a a0 and @a a1 are sorted as a pair, the lanes of @a a2
+    separately and the results are merged. See sort_network(any_vec32&) for
+    details.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void sort_network(any_vec32<N,V>& a0, any_vec32<N,V>& a1, any_vec32<N,V>& a2)
+{
+    static_assert(!is_mask<V>::value, "Mask vectors are not supported");
+    static_assert(is_value_vector<V>::value, "Expression vectors are not supported");
+    detail::insn::i_sort_network(a0.wrapped(), a1.wrapped(), a2.wrapped());
+}
+
+/** Sorts the 64-bit elements within the same 128-bit lanes of three vectors
+    in ascending order. The sorted sequence of each lane starts in @a a0 and
+    continues in @a a1 and @a a2.
+
+    Mask or expression vectors are not supported.
+
+    @code
+    [ r0_0, r0_1 ; ... ; r2_0, r2_1 ] = sort(a0_0, a0_1 ; ... ; a2_0, a2_1)
+    ...
+    @endcode
+
+    See sort_network(any_vec64&) for details.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void sort_network(any_vec64<N,V>& a0, any_vec64<N,V>& a1, any_vec64<N,V>& a2)
+{
+    static_assert(!is_mask<V>::value, "Mask vectors are not supported");
+    static_assert(is_value_vector<V>::value, "Expression vectors are not supported");
+    detail::insn::i_sort_network(a0.wrapped(), a1.wrapped(), a2.wrapped());
+}
+
+/** Sorts the 32-bit elements within the same 128-bit lanes of four vectors
+    in ascending order. The sorted sequence of each lane starts in @a a0 and
+    continues in @a a1, @a a2 and @a a3.
+
+    Mask or expression vectors are not supported.
+
+    @code
+    [ r0_0 .. r0_3 ; ... ; r3_0 .. r3_3 ] = sort(a0_0 .. a0_3 ; ... ; a3_0 .. a3_3)
+    ...
+    @endcode
+
+    The columns are sorted first by comparing whole vectors, then the lanes
+    are transposed and merged. See sort_network(any_vec32&) for details.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void sort_network(any_vec32<N,V>& a0, any_vec32<N,V>& a1,
+                  any_vec32<N,V>& a2, any_vec32<N,V>& a3)
+{
+    static_assert(!is_mask<V>::value, "Mask vectors are not supported");
+    static_assert(is_value_vector<V>::value, "Expression vectors are not supported");
+    detail::insn::i_sort_network(a0.wrapped(), a1.wrapped(),
+                                 a2.wrapped(), a3.wrapped());
+}
+
+/** Sorts the 64-bit elements within the same 128-bit lanes of four vectors
+    in ascending order. The sorted sequence of each lane starts in @a a0 and
+    continues in @a a1, @a a2 and @a a3.
+
+    Mask or expression vectors are not supported.
+
+    @code
+    [ r0_0, r0_1 ; ... ; r3_0, r3_1 ] = sort(a0_0, a0_1 ; ... ; a3_0, a3_1)
+    ...
+    @endcode
+
+    See sort_network(any_vec64&) for details.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void sort_network(any_vec64<N,V>& a0, any_vec64<N,V>& a1,
+                  any_vec64<N,V>& a2, any_vec64<N,V>& a3)
+{
+    static_assert(!is_mask<V>::value, "Mask vectors are not supported");
+    static_assert(is_value_vector<V>::value, "Expression vectors are not supported");
+    detail::insn::i_sort_network(a0.wrapped(), a1.wrapped(),
+                                 a2.wrapped(), a3.wrapped());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,169 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_CORE_STORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/insn/store_compress.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores the elements of a vector in the lanes for which the mask is set to
+    consecutive memory locations. Returns the number of stored elements.
+    Memory locations past the stored elements are not written to.
+
+    @code
+    n = 0
+    for (i = 0; i < N; ++i)
+        if (mask[i])
+            p[n++] = a[i]
+    return n
+    @endcode
+
+    The pointer does not need to be aligned.
+
+    Native compress instructions are used for 32-bit and 64-bit elements on
+    AVX512F. On AVX2 256-bit vectors of 32-bit and 64-bit elements are
+    left-packed using a permutation with lookup tables indexed by the mask
+    bits. On SSSE3, NEON, ALTIVEC and MSA the elements are left-packed using a
+    byte shuffle with lookup tables within each 128-bit lane. On other
+    architectures each element is stored separately.
+
+    Only the stored elements are written, thus unless masked stores are
+    available (AVX for 32-bit elements, AVX2 for 256-bit vectors of 64-bit
+    elements, AVX512F), the left-packed vector is written in several
+    power-of-two sized pieces. store_compress_unsafe_tail() is faster if the destination
+    has room for a whole vector past the stored elements.
+*/
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress(void* p, const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    uint8<N> ra;
+    ra = a.wrapped().eval();
+    mask_int8<N> rm = mask.wrapped().eval();
+    return detail::insn::i_store_compress<false>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress(void* p, const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    uint16<N> ra;
+    ra = a.wrapped().eval();
+    mask_int16<N> rm = mask.wrapped().eval();
+    return detail::insn::i_store_compress<false>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress(void* p, const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    uint32<N> ra;
+    ra = a.wrapped().eval();
+    mask_int32<N> rm = mask.wrapped().eval();
+    return detail::insn::i_store_compress<false>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress(void* p, const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    uint64<N> ra;
+    ra = a.wrapped().eval();
+    mask_int64<N> rm = mask.wrapped().eval();
+    return detail::insn::i_store_compress<false>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress(void* p, const any_float32<N,V>& a, const mask_float32<N,M>& mask)
+{
+    float32<N> fa = a.wrapped().eval();
+    uint32<N> ra = bit_cast<uint32<N>>(fa);
+    mask_int32<N> rm = bit_cast<mask_int32<N>>(mask.wrapped().eval());
+    return detail::insn::i_store_compress<false>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress(void* p, const any_float64<N,V>& a, const mask_float64<N,M>& mask)
+{
+    float64<N> fa = a.wrapped().eval();
+    uint64<N> ra = bit_cast<uint64<N>>(fa);
+    mask_int64<N> rm = bit_cast<mask_int64<N>>(mask.wrapped().eval());
+    return detail::insn::i_store_compress<false>(reinterpret_cast<char*>(p), ra, rm);
+}
+
+/** Stores the elements of a vector in the lanes for which the mask is set to
+    consecutive memory locations. Returns the number of stored elements.
+    Unlike store_compress(), memory up to one vector past the stored elements
+    may be overwritten with unspecified values.
+
+    @code
+    n = 0
+    for (i = 0; i < N; ++i)
+        if (mask[i])
+            p[n++] = a[i]
+    // p[n] ... p[n+N-1] may be overwritten
+    return n
+    @endcode
+
+    The pointer does not need to be aligned. The left-packed vector is
+    written by whole vector stores. On SSSE3, NEON, ALTIVEC and MSA vectors
+    wider than 128 bits are stored as 128-bit parts that overlap the unused
+    elements of the preceding parts.
+*/
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress_unsafe_tail(void* p, const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    uint8<N> ra;
+    ra = a.wrapped().eval();
+    mask_int8<N> rm = mask.wrapped().eval();
+    return detail::insn::i_store_compress<true>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress_unsafe_tail(void* p, const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    uint16<N> ra;
+    ra = a.wrapped().eval();
+    mask_int16<N> rm = mask.wrapped().eval();
+    return detail::insn::i_store_compress<true>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress_unsafe_tail(void* p, const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    uint32<N> ra;
+    ra = a.wrapped().eval();
+    mask_int32<N> rm = mask.wrapped().eval();
+    return detail::insn::i_store_compress<true>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress_unsafe_tail(void* p, const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    uint64<N> ra;
+    ra = a.wrapped().eval();
+    mask_int64<N> rm = mask.wrapped().eval();
+    return detail::insn::i_store_compress<true>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress_unsafe_tail(void* p, const any_float32<N,V>& a, const mask_float32<N,M>& mask)
+{
+    float32<N> fa = a.wrapped().eval();
+    uint32<N> ra = bit_cast<uint32<N>>(fa);
+    mask_int32<N> rm = bit_cast<mask_int32<N>>(mask.wrapped().eval());
+    return detail::insn::i_store_compress<true>(reinterpret_cast<char*>(p), ra, rm);
+}
+template<unsigned N, class V, class M> SIMDPP_INL
+unsigned store_compress_unsafe_tail(void* p, const any_float64<N,V>& a, const mask_float64<N,M>& mask)
+{
+    float64<N> fa = a.wrapped().eval();
+    uint64<N> ra = bit_cast<uint64<N>>(fa);
+    mask_int64<N> rm = bit_cast<mask_int64<N>>(mask.wrapped().eval());
+    return detail::insn::i_store_compress<true>(reinterpret_cast<char*>(p), ra, rm);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,52 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STORE_PARTIAL_H
+#define LIBSIMDPP_SIMDPP_CORE_STORE_PARTIAL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/store_partial.h>
+#include <simdpp/detail/traits.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores the first @a n elements of a vector to an unaligned memory
+    location. If @a n is not less than the number of elements in the vector,
+    the whole vector is stored. Memory past the first @a n elements is not
+    accessed.
+
+    @code
+    *(p) = a0          if 0 < n
+    ...
+    *(p+N) = aN        if N < n
+    @endcode
+
+    @a p must be aligned to the element size. On AVX and AVX2 the 32-bit and
+    64-bit elements are stored with masked stores, on AVX512F (and AVX512BW for
+    8-bit and 16-bit elements) with mask registers. On other architectures the
+    elements are stored one by one unless the whole vector is stored.
+*/
+template<unsigned N, class V> SIMDPP_INL
+void store_partial(void* p, const any_vec<N,V>& a, unsigned n)
+{
+    static_assert(!is_mask<V>::value, "Masks can not be stored");
+    using E = decltype(a.wrapped().eval());
+    typename detail::remove_sign<E>::type ra;
+    ra = a.wrapped().eval();
+    detail::insn::i_store_partial(reinterpret_cast<char*>(p), ra, n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
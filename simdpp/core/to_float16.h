@@ -0,0 +1,65 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_float_to_float16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts 32-bit floating-point values to IEEE 754 half-precision values.
+
+    The values are rounded to nearest even. Values too large to be represented
+    are converted to infinities, NaNs are converted to quiet NaNs.
+
+    @code
+    r0 = (half) a0
+    ...
+    rN = (half) aN
+    @endcode
+
+    @par 256-bit version:
+    @icost{F16C, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, 20-30}
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float16<N> to_float16(const float32<N,E>& a)
+{
+    return detail::insn::i_to_float16(a.eval());
+}
+
+/** Converts 32-bit floating-point values to bfloat16 values. bfloat16 has the
+    same exponent range as float32 and 8 bits of precision.
+
+    The values are rounded to nearest even, NaNs are converted to quiet NaNs.
+
+    @code
+    r0 = (bfloat16) a0
+    ...
+    rN = (bfloat16) aN
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+bfloat16<N> to_bfloat16(const float32<N,E>& a)
+{
+    return detail::insn::i_to_bfloat16(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
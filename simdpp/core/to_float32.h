@@ -96,6 +96,31 @@ float32<N,expr_empty> to_float32(const float64<N,E>& a)
     return detail::insn::i_to_float32(a.eval());
 }
 
+/** Converts IEEE 754 half-precision values to 32-bit floating-point values.
+    The conversion is exact.
+
+    @par 256-bit version:
+    @icost{F16C, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, 15-25}
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> to_float32(const float16<N,E>& a)
+{
+    return detail::insn::i_to_float32(a.eval());
+}
+
+/** Converts bfloat16 values to 32-bit floating-point values. The conversion
+    is exact.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> to_float32(const bfloat16<N,E>& a)
+{
+    return detail::insn::i_to_float32(a.eval());
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
@@ -29,7 +29,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
     The lower and higher 128-bit halves are processed as if 128-bit instruction
     was applied to each of them separately.
 
-    @icost{SSV2-AVX, NEON, ALTIVEC, 2}
+    @icost{SSE2-AVX, NEON, ALTIVEC, 2}
 */
 template<unsigned N, class V1, class V2> SIMDPP_INL
 typename detail::get_expr2_nomask<V1, V2>::empty
@@ -0,0 +1,104 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_BIT_SCAN_H
+#define LIBSIMDPP_SIMDPP_DETAIL_BIT_SCAN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <cstdint>
+#if _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+// Returns the index of the lowest set bit. x must not be zero.
+static SIMDPP_INL
+unsigned bit_scan_forward(uint32_t x)
+{
+#if __GNUC__ || __clang__
+    return __builtin_ctz(x);
+#elif _MSC_VER
+    unsigned long r;
+    _BitScanForward(&r, x);
+    return r;
+#else
+    unsigned r = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        r++;
+    }
+    return r;
+#endif
+}
+
+// Returns the index of the highest set bit. x must not be zero.
+static SIMDPP_INL
+unsigned bit_scan_reverse(uint32_t x)
+{
+#if __GNUC__ || __clang__
+    return 31 - __builtin_clz(x);
+#elif _MSC_VER
+    unsigned long r;
+    _BitScanReverse(&r, x);
+    return r;
+#else
+    unsigned r = 0;
+    while (x >>= 1)
+        r++;
+    return r;
+#endif
+}
+
+// Returns the number of set bits
+static SIMDPP_INL
+unsigned bit_count(uint32_t x)
+{
+#if __GNUC__ || __clang__
+    return __builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    x = (x + (x >> 4)) & 0x0f0f0f0f;
+    return (x * 0x01010101) >> 24;
+#endif
+}
+
+// Returns the index of the lowest set bit. x must not be zero.
+static SIMDPP_INL
+unsigned bit_scan_forward64(uint64_t x)
+{
+#if __GNUC__ || __clang__
+    return __builtin_ctzll(x);
+#else
+    uint32_t lo = uint32_t(x);
+    return lo != 0 ? bit_scan_forward(lo) : 32 + bit_scan_forward(uint32_t(x >> 32));
+#endif
+}
+
+// Returns the number of set bits
+static SIMDPP_INL
+unsigned bit_count64(uint64_t x)
+{
+#if __GNUC__ || __clang__
+    return __builtin_popcountll(x);
+#else
+    return bit_count(uint32_t(x)) + bit_count(uint32_t(x >> 32));
+#endif
+}
+
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -34,6 +34,9 @@ void construct_eval(V& v, const expr_vec_load& e);
 template<class V> SIMDPP_INL
 void construct_eval(V& v, const expr_vec_load_u& e);
 
+template<class V> SIMDPP_INL
+void construct_eval(V& v, const expr_vec_load_partial& e);
+
 template<class V, class VE, unsigned N> SIMDPP_INL
 void construct_eval(V& v, const expr_vec_make_const<VE, N>& e);
 
@@ -13,11 +13,19 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/i_add.h>
 #include <simdpp/core/i_mull.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/shuffle2.h>
 #include <simdpp/core/unzip_hi.h>
+#include <simdpp/core/unzip_lo.h>
 #include <simdpp/detail/null/math.h>
 
 namespace simdpp {
@@ -300,6 +308,393 @@ uint32<N> expr_eval_mul_lo(const uint32<N,E1>& qa,
     SIMDPP_VEC_ARRAY_IMPL2(uint32<N>, mul_lo, a, b);
 }
 
+// -----------------------------------------------------------------------------
+
+template<class R, class E1, class E2> SIMDPP_INL
+uint32<4> expr_eval_mul_hi(const uint32<4,E1>& qa,
+                           const uint32<4,E2>& qb)
+{
+    uint32<4> a = qa.eval();
+    uint32<4> b = qb.eval();
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = (uint64_t(a.el(i)) * b.el(i)) >> 32;
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    // _mm_mul_epu32 multiplies the even elements
+    __m128i ev = _mm_mul_epu32(a.native(), b.native());
+    __m128i od = _mm_mul_epu32(_mm_srli_epi64(a.native(), 32),
+                               _mm_srli_epi64(b.native(), 32));
+    ev = _mm_srli_epi64(ev, 32);
+#if SIMDPP_USE_SSE4_1
+    return _mm_blend_epi16(ev, od, 0xcc);
+#else
+    uint32<4> mask = make_uint(0, 0xffffffff);
+    return bit_or(uint32<4>(ev), bit_and(uint32<4>(od), mask));
+#endif
+#elif SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    uint64<4> ab = mull(a, b);
+#if SIMDPP_BIG_ENDIAN
+    return unzip4_lo(uint32<4>(ab.vec(0)), uint32<4>(ab.vec(1)));
+#else
+    return unzip4_hi(uint32<4>(ab.vec(0)), uint32<4>(ab.vec(1)));
+#endif
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<class R, class E1, class E2> SIMDPP_INL
+uint32<8> expr_eval_mul_hi(const uint32<8,E1>& qa,
+                           const uint32<8,E2>& qb)
+{
+    uint32<8> a = qa.eval();
+    uint32<8> b = qb.eval();
+    __m256i ev = _mm256_mul_epu32(a.native(), b.native());
+    __m256i od = _mm256_mul_epu32(_mm256_srli_epi64(a.native(), 32),
+                                  _mm256_srli_epi64(b.native(), 32));
+    ev = _mm256_srli_epi64(ev, 32);
+    return _mm256_blend_epi32(ev, od, 0xaa);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<class R, class E1, class E2> SIMDPP_INL
+uint32<16> expr_eval_mul_hi(const uint32<16,E1>& qa,
+                            const uint32<16,E2>& qb)
+{
+    uint32<16> a = qa.eval();
+    uint32<16> b = qb.eval();
+    __m512i ev = _mm512_mul_epu32(a.native(), b.native());
+    __m512i od = _mm512_mul_epu32(_mm512_srli_epi64(a.native(), 32),
+                                  _mm512_srli_epi64(b.native(), 32));
+    ev = _mm512_srli_epi64(ev, 32);
+    return _mm512_mask_blend_epi32(0xaaaa, ev, od);
+}
+#endif
+
+template<class R, unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N> expr_eval_mul_hi(const uint32<N,E1>& qa,
+                           const uint32<N,E2>& qb)
+{
+    uint32<N> a = qa.eval();
+    uint32<N> b = qb.eval();
+    SIMDPP_VEC_ARRAY_IMPL2(uint32<N>, mul_hi, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+/*  Computes the signed high half from the unsigned one:
+    high_s(a * b) = high_u(a * b) - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+*/
+template<class V> SIMDPP_INL
+V v_mul_hi_fix_sign(const V& r, const V& a, const V& b)
+{
+    const unsigned B = sizeof(typename V::element_type) * 8;
+    V sa = shift_r<B-1>(a);
+    V sb = shift_r<B-1>(b);
+    V ur = sub(r, bit_and(sa, b));
+    return sub(ur, bit_and(sb, a));
+}
+
+template<class R, class E1, class E2> SIMDPP_INL
+int32<4> expr_eval_mul_hi(const int32<4,E1>& qa,
+                          const int32<4,E2>& qb)
+{
+    int32<4> a = qa.eval();
+    int32<4> b = qb.eval();
+#if SIMDPP_USE_NULL
+    int32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = (int64_t(a.el(i)) * b.el(i)) >> 32;
+    }
+    return r;
+#elif SIMDPP_USE_SSE4_1
+    __m128i ev = _mm_mul_epi32(a.native(), b.native());
+    __m128i od = _mm_mul_epi32(_mm_srli_epi64(a.native(), 32),
+                               _mm_srli_epi64(b.native(), 32));
+    ev = _mm_srli_epi64(ev, 32);
+    return _mm_blend_epi16(ev, od, 0xcc);
+#elif SIMDPP_USE_NEON || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+    int64<4> ab = mull(a, b);
+#if SIMDPP_BIG_ENDIAN
+    return unzip4_lo(int32<4>(ab.vec(0)), int32<4>(ab.vec(1)));
+#else
+    return unzip4_hi(int32<4>(ab.vec(0)), int32<4>(ab.vec(1)));
+#endif
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_ALTIVEC
+    // no signed widening multiplication
+    int32<4> r = expr_eval_mul_hi<uint32<4>>(uint32<4>(a), uint32<4>(b));
+    return v_mul_hi_fix_sign(r, a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<class R, class E1, class E2> SIMDPP_INL
+int32<8> expr_eval_mul_hi(const int32<8,E1>& qa,
+                          const int32<8,E2>& qb)
+{
+    int32<8> a = qa.eval();
+    int32<8> b = qb.eval();
+    __m256i ev = _mm256_mul_epi32(a.native(), b.native());
+    __m256i od = _mm256_mul_epi32(_mm256_srli_epi64(a.native(), 32),
+                                  _mm256_srli_epi64(b.native(), 32));
+    ev = _mm256_srli_epi64(ev, 32);
+    return _mm256_blend_epi32(ev, od, 0xaa);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<class R, class E1, class E2> SIMDPP_INL
+int32<16> expr_eval_mul_hi(const int32<16,E1>& qa,
+                           const int32<16,E2>& qb)
+{
+    int32<16> a = qa.eval();
+    int32<16> b = qb.eval();
+    __m512i ev = _mm512_mul_epi32(a.native(), b.native());
+    __m512i od = _mm512_mul_epi32(_mm512_srli_epi64(a.native(), 32),
+                                  _mm512_srli_epi64(b.native(), 32));
+    ev = _mm512_srli_epi64(ev, 32);
+    return _mm512_mask_blend_epi32(0xaaaa, ev, od);
+}
+#endif
+
+template<class R, unsigned N, class E1, class E2> SIMDPP_INL
+int32<N> expr_eval_mul_hi(const int32<N,E1>& qa,
+                          const int32<N,E2>& qb)
+{
+    int32<N> a = qa.eval();
+    int32<N> b = qb.eval();
+    SIMDPP_VEC_ARRAY_IMPL2(int32<N>, mul_hi, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+/*  Multiplies the low 32 bits of each 64-bit element and returns the 64-bit
+    products. This is the building block of the 64-bit multiplications.
+*/
+static SIMDPP_INL
+uint64<2> v_mul_lo32_u64(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = (a.el(i) & 0xffffffff) * (b.el(i) & 0xffffffff);
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    return _mm_mul_epu32(a.native(), b.native());
+#elif SIMDPP_USE_NEON
+    return vmull_u32(vmovn_u64(a.native()), vmovn_u64(b.native()));
+#elif SIMDPP_USE_MSA
+    uint64<2> mask = make_uint(0xffffffff);
+    uint64<2> al = bit_and(a, mask);
+    uint64<2> bl = bit_and(b, mask);
+    return (v2u64) __msa_mulv_d((v2i64) al.native(), (v2i64) bl.native());
+#elif SIMDPP_USE_ALTIVEC
+    mem_block<uint64<2>> ba = a;
+    mem_block<uint64<2>> bb = b;
+    ba[0] = (ba[0] & 0xffffffff) * (bb[0] & 0xffffffff);
+    ba[1] = (ba[1] & 0xffffffff) * (bb[1] & 0xffffffff);
+    return ba;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> v_mul_lo32_u64(const uint64<4>& a, const uint64<4>& b)
+{
+    return _mm256_mul_epu32(a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> v_mul_lo32_u64(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_mul_epu32(a.native(), b.native());
+}
+#endif
+
+// Only native vectors are accepted
+template<class V> SIMDPP_INL
+V v_emul_mul_lo_u64(const V& a, const V& b)
+{
+    // low(a * b) = al*bl + ((ah*bl + al*bh) << 32)
+    V ah = shift_r<32>(a);
+    V bh = shift_r<32>(b);
+    V r = v_mul_lo32_u64(a, b);
+    V cross = add(v_mul_lo32_u64(ah, b), v_mul_lo32_u64(a, bh));
+    return add(r, shift_l<32>(cross));
+}
+
+template<class V> SIMDPP_INL
+V v_emul_mul_hi_u64(const V& a, const V& b)
+{
+    V mask = make_uint(0xffffffff);
+    V ah = shift_r<32>(a);
+    V bh = shift_r<32>(b);
+    V ll = v_mul_lo32_u64(a, b);
+    V lh = v_mul_lo32_u64(a, bh);
+    V hl = v_mul_lo32_u64(ah, b);
+    V hh = v_mul_lo32_u64(ah, bh);
+
+    // the sum of the middle terms can not overflow 64 bits
+    V mid = add(shift_r<32>(ll), bit_and(lh, mask));
+    mid = add(mid, bit_and(hl, mask));
+    V r = add(hh, shift_r<32>(lh));
+    r = add(r, shift_r<32>(hl));
+    return add(r, shift_r<32>(mid));
+}
+
+template<class R, class E1, class E2> SIMDPP_INL
+uint64<2> expr_eval_mul_lo(const uint64<2,E1>& qa,
+                           const uint64<2,E2>& qb)
+{
+    uint64<2> a = qa.eval();
+    uint64<2> b = qb.eval();
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = a.el(i) * b.el(i);
+    }
+    return r;
+#elif SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm_mullo_epi64(a.native(), b.native());
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_mulv_d((v2i64) a.native(), (v2i64) b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+template<class R, class E1, class E2> SIMDPP_INL
+uint64<4> expr_eval_mul_lo(const uint64<4,E1>& qa,
+                           const uint64<4,E2>& qb)
+{
+    uint64<4> a = qa.eval();
+    uint64<4> b = qb.eval();
+#if SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm256_mullo_epi64(a.native(), b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<class R, class E1, class E2> SIMDPP_INL
+uint64<8> expr_eval_mul_lo(const uint64<8,E1>& qa,
+                           const uint64<8,E2>& qb)
+{
+    uint64<8> a = qa.eval();
+    uint64<8> b = qb.eval();
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_mullo_epi64(a.native(), b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+#endif
+
+template<class R, unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N> expr_eval_mul_lo(const uint64<N,E1>& qa,
+                           const uint64<N,E2>& qb)
+{
+    uint64<N> a = qa.eval();
+    uint64<N> b = qb.eval();
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, mul_lo, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+template<class R, class E1, class E2> SIMDPP_INL
+uint64<2> expr_eval_mul_hi(const uint64<2,E1>& qa,
+                           const uint64<2,E2>& qb)
+{
+    uint64<2> a = qa.eval();
+    uint64<2> b = qb.eval();
+    return v_emul_mul_hi_u64(a, b);
+}
+
+#if SIMDPP_USE_AVX2
+template<class R, class E1, class E2> SIMDPP_INL
+uint64<4> expr_eval_mul_hi(const uint64<4,E1>& qa,
+                           const uint64<4,E2>& qb)
+{
+    uint64<4> a = qa.eval();
+    uint64<4> b = qb.eval();
+    return v_emul_mul_hi_u64(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<class R, class E1, class E2> SIMDPP_INL
+uint64<8> expr_eval_mul_hi(const uint64<8,E1>& qa,
+                           const uint64<8,E2>& qb)
+{
+    uint64<8> a = qa.eval();
+    uint64<8> b = qb.eval();
+    return v_emul_mul_hi_u64(a, b);
+}
+#endif
+
+template<class R, unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N> expr_eval_mul_hi(const uint64<N,E1>& qa,
+                           const uint64<N,E2>& qb)
+{
+    uint64<N> a = qa.eval();
+    uint64<N> b = qb.eval();
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, mul_hi, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+template<class R, class E1, class E2> SIMDPP_INL
+int64<2> expr_eval_mul_hi(const int64<2,E1>& qa,
+                          const int64<2,E2>& qb)
+{
+    int64<2> a = qa.eval();
+    int64<2> b = qb.eval();
+    int64<2> r = expr_eval_mul_hi<uint64<2>>(uint64<2>(a), uint64<2>(b));
+    return v_mul_hi_fix_sign(r, a, b);
+}
+
+#if SIMDPP_USE_AVX2
+template<class R, class E1, class E2> SIMDPP_INL
+int64<4> expr_eval_mul_hi(const int64<4,E1>& qa,
+                          const int64<4,E2>& qb)
+{
+    int64<4> a = qa.eval();
+    int64<4> b = qb.eval();
+    int64<4> r = expr_eval_mul_hi<uint64<4>>(uint64<4>(a), uint64<4>(b));
+    return v_mul_hi_fix_sign(r, a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+template<class R, class E1, class E2> SIMDPP_INL
+int64<8> expr_eval_mul_hi(const int64<8,E1>& qa,
+                          const int64<8,E2>& qb)
+{
+    int64<8> a = qa.eval();
+    int64<8> b = qb.eval();
+    int64<8> r = expr_eval_mul_hi<uint64<8>>(uint64<8>(a), uint64<8>(b));
+    return v_mul_hi_fix_sign(r, a, b);
+}
+#endif
+
+template<class R, unsigned N, class E1, class E2> SIMDPP_INL
+int64<N> expr_eval_mul_hi(const int64<N,E1>& qa,
+                          const int64<N,E2>& qb)
+{
+    int64<N> a = qa.eval();
+    int64<N> b = qb.eval();
+    SIMDPP_VEC_ARRAY_IMPL2(int64<N>, mul_hi, a, b);
+}
+
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
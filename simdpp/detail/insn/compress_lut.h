@@ -0,0 +1,283 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_LUT_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_LUT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/extract_bits.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/detail/workarounds.h>
+#include <cstdint>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Shared helpers of store_compress and load_expand.
+
+    The lookup tables contain permute_zbytes16 masks for each combination of
+    the active lanes of a 128-bit vector. Compress masks move the active
+    lanes to the beginning of the vector, expand masks move the elements at
+    the beginning of the vector to the positions of the active lanes. Unused
+    positions select zero. 8-bit elements are processed as two halves of 8
+    lanes each, thus 256 masks of 8 bytes are enough for them. The compressed
+    halves are joined by the shift8 mask indexed by the number of the active
+    lanes in the lower half.
+
+    On AVX2 256-bit vectors of 32-bit and 64-bit elements are permuted across
+    the whole vector. The corresponding tables contain 32-bit lane indices,
+    one per byte. Unused positions of the expand masks are 0x80.
+*/
+struct compress_lut {
+    uint8_t compress8[256][8];
+    uint8_t expand8[256][8];
+    uint8_t shift8[9][16];
+    uint8_t compress16[256][16];
+    uint8_t expand16[256][16];
+    uint8_t compress32[16][16];
+    uint8_t expand32[16][16];
+    uint8_t compress64[4][16];
+    uint8_t expand64[4][16];
+#if SIMDPP_USE_AVX2
+    uint8_t compress32x8[256][8];
+    uint8_t expand32x8[256][8];
+    uint8_t compress64x4[16][8];
+    uint8_t expand64x4[16][8];
+#endif
+
+    compress_lut()
+    {
+        fill(&compress8[0][0], &expand8[0][0], 8, 1, 8);
+        fill(&compress16[0][0], &expand16[0][0], 8, 2, 16);
+        fill(&compress32[0][0], &expand32[0][0], 4, 4, 16);
+        fill(&compress64[0][0], &expand64[0][0], 2, 8, 16);
+#if SIMDPP_USE_AVX2
+        fill(&compress32x8[0][0], &expand32x8[0][0], 8, 1, 8);
+        fill(&compress64x4[0][0], &expand64x4[0][0], 4, 2, 8);
+#endif
+        for (unsigned k = 0; k <= 8; ++k) {
+            for (unsigned i = 0; i < 16; ++i) {
+                if (i < k)
+                    shift8[k][i] = uint8_t(i);
+                else if (i - k < 8)
+                    shift8[k][i] = uint8_t(i - k + 8);
+                else
+                    shift8[k][i] = 0x80;
+            }
+        }
+    }
+
+    static void fill(uint8_t* c, uint8_t* e, unsigned lanes, unsigned size,
+                     unsigned row_size)
+    {
+        for (unsigned m = 0; m < (1u << lanes); ++m) {
+            uint8_t* crow = c + m * row_size;
+            uint8_t* erow = e + m * row_size;
+            for (unsigned i = 0; i < row_size; ++i) {
+                crow[i] = 0x80;
+                erow[i] = 0x80;
+            }
+            unsigned n = 0;
+            for (unsigned i = 0; i < lanes; ++i) {
+                if ((m & (1u << i)) == 0)
+                    continue;
+                for (unsigned b = 0; b < size; ++b) {
+                    crow[n*size + b] = uint8_t(i*size + b);
+                    erow[i*size + b] = uint8_t(n*size + b);
+                }
+                n++;
+            }
+        }
+    }
+};
+
+SIMDPP_INL const compress_lut& i_get_compress_lut()
+{
+    static const compress_lut lut;
+    return lut;
+}
+
+// Returns the permute_zbytes16 mask for the given lane size and active lanes
+template<unsigned S> SIMDPP_INL
+const uint8_t* i_compress_lut_row(bool expand, unsigned bits)
+{
+    const compress_lut& t = i_get_compress_lut();
+    switch (S) {
+    case 1: return expand ? t.expand8[bits] : t.compress8[bits];
+    case 2: return expand ? t.expand16[bits] : t.compress16[bits];
+    case 4: return expand ? t.expand32[bits] : t.compress32[bits];
+    default: return expand ? t.expand64[bits] : t.compress64[bits];
+    }
+}
+
+static SIMDPP_INL
+unsigned i_compress_popcnt(uint64_t x)
+{
+#if SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
+    return unsigned(_mm_popcnt_u64(x));
+#elif SIMDPP_USE_X86_POPCNT_INSN
+    return unsigned(_mm_popcnt_u32(uint32_t(x)) + _mm_popcnt_u32(uint32_t(x >> 32)));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555);
+    x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0f;
+    return unsigned((x * 0x0101010101010101) >> 56);
+#endif
+}
+
+/*  Same as i_compress_popcnt, but x has at most L bits. Without the popcnt
+    instruction, the bits of small masks are counted using nibble lookups in
+    a constant, which is shorter than the generic bit manipulation sequence.
+*/
+template<unsigned L> SIMDPP_INL
+unsigned i_compress_popcnt_lanes(uint64_t x)
+{
+#if SIMDPP_USE_X86_POPCNT_INSN
+    return i_compress_popcnt(x);
+#else
+    const uint64_t nibble_counts = 0x4332322132212110;
+    if (L <= 4)
+        return unsigned(nibble_counts >> (x * 4)) & 0xf;
+    if (L <= 8)
+        return (unsigned(nibble_counts >> ((x & 0xf) * 4)) & 0xf) +
+               (unsigned(nibble_counts >> ((x >> 4) * 4)) & 0xf);
+    return i_compress_popcnt(x);
+#endif
+}
+
+/*  Returns a if sel is true and b otherwise. Compilers often implement the
+    conditional operator as a branch, which is mispredicted half of the time
+    when the selection depends on random mask bits.
+*/
+template<class T> SIMDPP_INL
+T* i_compress_select_ptr(bool sel, T* a, T* b)
+{
+    uintptr_t m = 0 - uintptr_t(sel);
+    uintptr_t ia = reinterpret_cast<uintptr_t>(a);
+    uintptr_t ib = reinterpret_cast<uintptr_t>(b);
+    return reinterpret_cast<T*>(ib ^ ((ia ^ ib) & m));
+}
+
+/*  Returns the permute_zbytes16 mask for the given lane size and active lanes
+    of a 128-bit vector. The 8-bit compress mask selects the active lanes of
+    both halves contiguously. The upper half of the 8-bit expand mask selects
+    the elements following the ones used by the lower half.
+*/
+template<unsigned S> SIMDPP_INL
+uint8<16> i_compress_lut_idx(bool expand, unsigned bits)
+{
+    if (S == 1) {
+        const compress_lut& t = i_get_compress_lut();
+        unsigned bits_lo = bits & 0xff;
+        unsigned bits_hi = bits >> 8;
+        uint64_t lo, hi;
+        std::memcpy(&lo, i_compress_lut_row<1>(expand, bits_lo), 8);
+        std::memcpy(&hi, i_compress_lut_row<1>(expand, bits_hi), 8);
+        uint64<2> rows;
+        if (expand) {
+            hi += i_compress_popcnt_lanes<8>(bits_lo) * 0x0101010101010101;
+            rows = make_uint(lo, hi);
+            return bit_cast<uint8<16>>(rows);
+        }
+        hi += 0x0808080808080808;
+        rows = make_uint(lo, hi);
+        uint8<16> idx = bit_cast<uint8<16>>(rows);
+        uint8<16> shift = load_u(t.shift8[i_compress_popcnt_lanes<8>(bits_lo)]);
+        return permute_zbytes16(idx, shift);
+    }
+    return load_u(i_compress_lut_row<S>(expand, bits));
+}
+
+/*  Converts the result of extract_bits_any, which contains one bit per byte,
+    to one bit per lane of S bytes. All bytes of a lane are assumed to be
+    equal.
+*/
+template<unsigned S> SIMDPP_INL
+uint32_t i_compress_byte_to_lane_bits(uint32_t x)
+{
+    switch (S) {
+    case 1:
+        return x;
+    case 2:
+        x &= 0x55555555;
+        x = (x | (x >> 1)) & 0x33333333;
+        x = (x | (x >> 2)) & 0x0f0f0f0f;
+        x = (x | (x >> 4)) & 0x00ff00ff;
+        return (x | (x >> 8)) & 0xffff;
+    case 4:
+        x &= 0x11111111;
+        x = (x | (x >> 3)) & 0x03030303;
+        x = (x | (x >> 6)) & 0x000f000f;
+        return (x | (x >> 12)) & 0xff;
+    default:
+        x &= 0x01010101;
+        x = (x | (x >> 7)) & 0x00030003;
+        return (x | (x >> 14)) & 0xf;
+    }
+}
+
+/*  Returns a bit for each lane of a native mask vector. Bit i is set if lane
+    i is active.
+*/
+template<class M> SIMDPP_INL
+uint64_t i_compress_lane_bits(const M& mask)
+{
+    using U = decltype(mask.unmask());
+    const unsigned S = sizeof(typename U::element_type);
+    using B = uint8<U::length * S>;
+    B b = bit_cast<B>(mask.unmask());
+    return i_compress_byte_to_lane_bits<S>(extract_bits_any(b));
+}
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint64_t i_compress_lane_bits(const mask_int8<64>& mask)
+{
+    return mask.native();
+}
+
+SIMDPP_INL uint64_t i_compress_lane_bits(const mask_int16<32>& mask)
+{
+#if SIMDPP_WORKAROUND_AVX512_MASK32_ZERO_EXTEND
+    uint64_t r;
+    __asm("kmovd	%1, %k0" : "=r"(r) : "k"(mask.native()));
+    return r;
+#else
+    return mask.native();
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64_t i_compress_lane_bits(const mask_int32<16>& mask)
+{
+    return mask.native();
+}
+
+static SIMDPP_INL
+uint64_t i_compress_lane_bits(const mask_int64<8>& mask)
+{
+    return mask.native();
+}
+#endif
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
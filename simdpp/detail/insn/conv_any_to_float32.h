@@ -13,10 +13,20 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
 #include <simdpp/core/combine.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/split.h>
 #include <simdpp/core/zip_hi.h>
 #include <simdpp/core/zip_lo.h>
 #include <simdpp/core/insert.h>
+#include <simdpp/core/make_uint.h>
 #include <simdpp/core/f_mul.h>
 #include <simdpp/core/make_shuffle_bytes_mask.h>
 #include <simdpp/core/shuffle_bytes16.h>
@@ -40,7 +50,7 @@ float32<4> i_to_float32(const float64<4>& a)
     float32x4 r1, r2;
     r1 = _mm_cvtpd_ps(a.vec(0).native());
     r2 = _mm_cvtpd_ps(a.vec(1).native());
-    return _mm_movelh_ps(r2.native(), r1.native());
+    return _mm_movelh_ps(r1.native(), r2.native());
 #elif SIMDPP_USE_NEON64
     float32<4> r;
     r = vcvt_high_f32_f64(vcvt_f32_f64(a.vec(0).native()),
@@ -265,6 +275,104 @@ float32<N> i_to_float32(const any_int64<N,V>& a)
 
 // -----------------------------------------------------------------------------
 
+/*  Converts IEEE 754 half-precision values stored in the low 16 bits of the
+    32-bit elements to single precision. The exponent is rebiased by adding
+    (127 - 15) << 23 to the shifted bit pattern. Infinities and NaNs get their
+    exponent rebiased once more so that it becomes all ones, NaNs are made
+    quiet. Zeros and denormals are normalized by letting the floating-point
+    unit subtract 2^-14 from a value with the implicit bit set.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_emul_float16_to_float32(const uint32<N>& h)
+{
+    uint32<N> u, e, sign, u_inf, u_den;
+    mask_int32<N> is_inf, is_nan, is_den;
+    float32<N> f_den, f_magic;
+
+    u = shift_l<13>(bit_and(h, 0x7fff));
+    e = bit_and(u, 0x0f800000);
+    u = add(u, 0x38000000);
+
+    u_inf = add(u, 0x38000000);
+    is_nan = cmp_gt(bit_and(h, 0x7fff), 0x7c00);
+    u_inf = blend(bit_or(u_inf, 0x00400000), u_inf, is_nan);
+    is_inf = cmp_eq(e, 0x0f800000);
+    u = blend(u_inf, u, is_inf);
+
+    f_magic = bit_cast<float32<N>>(uint32<N>(make_uint(0x38800000)));
+    f_den = bit_cast<float32<N>>(uint32<N>(add(u, 0x00800000)));
+    f_den = sub(f_den, f_magic);
+    u_den = bit_cast<uint32<N>>(f_den);
+    is_den = cmp_eq(e, 0);
+    u = blend(u_den, u, is_den);
+
+    sign = shift_l<16>(bit_and(h, 0x8000));
+    u = bit_or(u, sign);
+    return bit_cast<float32<N>>(u);
+}
+
+static SIMDPP_INL
+float32<8> i_float16_to_float32(const uint16<8>& a)
+{
+#if SIMDPP_USE_F16C
+    return _mm256_cvtph_ps(a.native());
+#else
+    return v_emul_float16_to_float32(i_to_uint32(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+float32<16> i_float16_to_float32(const uint16<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtph_ps(a.native());
+#elif SIMDPP_USE_F16C
+    float32<16> r;
+    r.vec(0) = _mm256_cvtph_ps(_mm256_castsi256_si128(a.native()));
+    r.vec(1) = _mm256_cvtph_ps(_mm256_extracti128_si256(a.native(), 1));
+    return r;
+#else
+    return v_emul_float16_to_float32(i_to_uint32(a));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+float32<32> i_float16_to_float32(const uint16<32>& a)
+{
+    uint16<16> a0, a1;
+    split(a, a0, a1);
+    float32<32> r;
+    r.vec(0) = i_float16_to_float32(a0);
+    r.vec(1) = i_float16_to_float32(a1);
+    return r;
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_float16_to_float32(const uint16<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_INSERT(float32<N>, i_float16_to_float32, a)
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_to_float32(const float16<N>& a)
+{
+    return i_float16_to_float32(bit_cast<uint16<N>>(a));
+}
+
+// bfloat16 is the upper half of the float32 representation
+template<unsigned N> SIMDPP_INL
+float32<N> i_to_float32(const bfloat16<N>& a)
+{
+    uint32<N> r = shift_l<16>(i_to_uint32(bit_cast<uint16<N>>(a)));
+    return bit_cast<float32<N>>(r);
+}
+
+// -----------------------------------------------------------------------------
+
 } // namespace insn
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
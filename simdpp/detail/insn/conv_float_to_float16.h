@@ -0,0 +1,149 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT_TO_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT_TO_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/insn/conv_shrink_to_int16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Converts single precision values to IEEE 754 half-precision, rounding to
+    nearest even. The result is stored in the low 16 bits of the 32-bit
+    elements. Normal results are rounded by adding 0xfff plus the lowest kept
+    mantissa bit before truncation, the exponent is rebiased in the same
+    addition. Denormal results are computed by letting the floating-point unit
+    align the mantissa: 0.5f has the exponent for which the lowest mantissa bit
+    has the value of the smallest half-precision denormal.
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> v_emul_float32_to_float16(const float32<N>& a)
+{
+    uint32<N> ua, sign, odd, r, r_den, r_inf, r_nan;
+    int32<N> u;
+    float32<N> f_den;
+
+    ua = bit_cast<uint32<N>>(a);
+    sign = bit_and(ua, 0x80000000);
+    u = bit_xor(ua, sign);
+
+    odd = bit_and(shift_r<13>(uint32<N>(u)), 1);
+    r = add(uint32<N>(u), 0xc8000fff);
+    r = shift_r<13>(add(r, odd));
+
+    f_den = bit_cast<float32<N>>(u);
+    f_den = add(f_den, 0.5f);
+    r_den = sub(bit_cast<uint32<N>>(f_den), 0x3f000000);
+    r = blend(r_den, r, cmp_lt(u, 0x38800000));
+
+    r_inf = make_uint(0x7c00);
+    r = blend(r_inf, r, cmp_gt(u, 0x477fffff));
+
+    r_nan = bit_and(shift_r<13>(uint32<N>(u)), 0x3ff);
+    r_nan = bit_or(r_nan, 0x7e00);
+    r = blend(r_nan, r, cmp_gt(u, 0x7f800000));
+
+    return bit_or(r, shift_r<16>(sign));
+}
+
+static SIMDPP_INL
+uint16<8> i_float32_to_float16(const float32<8>& a)
+{
+#if SIMDPP_USE_F16C
+    return _mm256_cvtps_ph(a.native(), _MM_FROUND_TO_NEAREST_INT);
+#else
+    return i_to_uint16(v_emul_float32_to_float16(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_float32_to_float16(const float32<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtps_ph(a.native(), _MM_FROUND_TO_NEAREST_INT);
+#elif SIMDPP_USE_F16C
+    uint16<8> r0, r1;
+    r0 = _mm256_cvtps_ph(a.vec(0).native(), _MM_FROUND_TO_NEAREST_INT);
+    r1 = _mm256_cvtps_ph(a.vec(1).native(), _MM_FROUND_TO_NEAREST_INT);
+    return combine(r0, r1);
+#else
+    return i_to_uint16(v_emul_float32_to_float16(a));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_float32_to_float16(const float32<32>& a)
+{
+    return combine(i_float32_to_float16(a.vec(0)),
+                   i_float32_to_float16(a.vec(1)));
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_float32_to_float16(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint16<N>, i_float32_to_float16, a)
+}
+
+template<unsigned N> SIMDPP_INL
+float16<N> i_to_float16(const float32<N>& a)
+{
+    return float16<N>(i_float32_to_float16(a));
+}
+
+// -----------------------------------------------------------------------------
+
+/*  bfloat16 is the upper half of the float32 representation. The value is
+    rounded to nearest even, NaNs are kept quiet so that the payload
+    truncation can't turn them into infinities.
+*/
+template<unsigned N> SIMDPP_INL
+bfloat16<N> i_to_bfloat16(const float32<N>& a)
+{
+    uint32<N> u, odd, r, r_nan;
+    int32<N> abs_u;
+
+    u = bit_cast<uint32<N>>(a);
+    odd = bit_and(shift_r<16>(u), 1);
+    r = shift_r<16>(add(add(u, 0x7fff), odd));
+
+    r_nan = bit_or(shift_r<16>(u), 0x40);
+    abs_u = bit_and(u, 0x7fffffff);
+    r = blend(r_nan, r, cmp_gt(abs_u, 0x7f800000));
+
+    return bfloat16<N>(i_to_uint16(r));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,60 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_DIV_APPROX_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_DIV_APPROX_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_rcp_e.h>
+#include <simdpp/core/f_rcp_rh.h>
+#include <simdpp/detail/insn/f_mul_add.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Division helpers used by the approximations of the activation functions.
+    The divisor must be a finite nonzero value.
+*/
+
+// Computes a/b with the precision of rcp_e
+template<unsigned N> SIMDPP_INL
+float32<N> i_div_e(const float32<N>& a, const float32<N>& b)
+{
+    float32<N> x = rcp_e(b);
+    return mul(a, x);
+}
+
+/*  Computes a/b to a few ULP. The reciprocal estimate is refined with a
+    Newton-Raphson step and the quotient is then corrected using its
+    residual.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_div_rh(const float32<N>& a, const float32<N>& b)
+{
+    float32<N> x, q, nb, r;
+    x = rcp_e(b);
+    x = rcp_rh(x, b);
+    q = mul(a, x);
+    nb = neg(b);
+    r = i_mul_add(q, nb, a);
+    return i_mul_add(r, x, q);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
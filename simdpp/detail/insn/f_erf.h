@@ -0,0 +1,159 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_ERF_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_ERF_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/detail/insn/f_div_approx.h>
+#include <simdpp/detail/insn/f_mul_add.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Rational approximation of degree 13/8 on [-4, 4]. Outside this range the
+    result is rounded to +/-1.
+*/
+template<unsigned N> SIMDPP_INL
+void i_erf_parts(float32<N>& p, float32<N>& q, const float32<N>& a)
+{
+    float32<N> x, z;
+    x = min(max(a, -4.0f), 4.0f);
+    z = mul(x, x);
+    p = i_mul_add(z, -2.72614225801306e-10f, 2.77068142495902e-08f);
+    p = i_mul_add(p, z, -2.10102402082508e-06f);
+    p = i_mul_add(p, z, -5.69250639462346e-05f);
+    p = i_mul_add(p, z, -7.34990630326855e-04f);
+    p = i_mul_add(p, z, -2.95459980854025e-03f);
+    p = i_mul_add(p, z, -1.60960333262415e-02f);
+    p = mul(p, x);
+    q = i_mul_add(z, -1.45660718464996e-05f, -2.13374055278905e-04f);
+    q = i_mul_add(q, z, -1.68282697438203e-03f);
+    q = i_mul_add(q, z, -7.37332916720468e-03f);
+    q = i_mul_add(q, z, -1.42647390514189e-02f);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_erf_impl(const float32<N>& a)
+{
+    float32<N> p, q, r, t;
+    i_erf_parts(p, q, a);
+    r = i_div_rh(p, q);
+
+    // p is denormal for tiny arguments, which loses precision
+    t = mul(a, 1.12837916709551257f);
+    r = blend(t, r, cmp_lt(abs(a), 1e-4f));
+    return blend(a, r, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_erf_e_impl(const float32<N>& a)
+{
+    float32<N> p, q, r;
+    i_erf_parts(p, q, a);
+    r = i_div_e(p, q);
+    return blend(a, r, isnan(a));
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_erf(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        float x = a.el(i);
+        r.el(i) = std::erf(x);
+    }
+    return r;
+#else
+    return i_erf_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_erf(const float32x8& a)
+{
+    return i_erf_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_erf(const float32<16>& a)
+{
+    return i_erf_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_erf(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_erf, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_erf_e(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        float x = a.el(i);
+        r.el(i) = std::erf(x);
+    }
+    return r;
+#else
+    return i_erf_e_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_erf_e(const float32x8& a)
+{
+    return i_erf_e_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_erf_e(const float32<16>& a)
+{
+    return i_erf_e_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_erf_e(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_erf_e, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,364 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_EXP_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_EXP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/detail/insn/f_mul_add.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The implementation follows the Cephes library: the argument is reduced to
+    x = n*ln(2) + r, |r| <= ln(2)/2, exp(r) is approximated by a polynomial
+    (float32) or a rational function (float64) and the result is scaled by 2^n
+    by constructing the exponent directly.
+
+    The conversion of n to integer avoids float-to-int instructions: adding
+    1.5*2^23 (or 1.5*2^52) to a value rounds it to integer and leaves the
+    integer in the low bits of the mantissa.
+*/
+
+// Computes p * 2^n for n in [-252, 254]
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp_scale(const float32<N>& p, const int32<N>& n)
+{
+    // 2^n is split into two factors so that each of them is a normal number.
+    // Subnormal results are thus rounded only once.
+    int32<N> n1, n2;
+    n1 = shift_r<1>(n);
+    n2 = sub(n, n1);
+    n1 = shift_l<23>(add(n1, 127));
+    n2 = shift_l<23>(add(n2, 127));
+    float32<N> r = mul(p, bit_cast<float32<N>>(n1));
+    return mul(r, bit_cast<float32<N>>(n2));
+}
+
+// Computes p * 2^n for n in [-2044, 2046]
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp_scale(const float64<N>& p, const int64<N>& n)
+{
+    int64<N> n1, n2;
+    n1 = shift_r<1>(n);
+    n2 = sub(n, n1);
+    n1 = shift_l<52>(add(n1, 1023));
+    n2 = shift_l<52>(add(n2, 1023));
+    float64<N> r = mul(p, bit_cast<float64<N>>(n1));
+    return mul(r, bit_cast<float64<N>>(n2));
+}
+
+// Splits x into n*ln(2) + r. x must be within [-2^21, 2^21]
+template<unsigned N> SIMDPP_INL
+void i_exp_reduce(float32<N>& r, int32<N>& n, const float32<N>& x)
+{
+    float32<N> fn;
+    fn = i_mul_add(x, 1.44269504088896341f, 12582912.0f);
+    n = sub(bit_cast<int32<N>>(fn), 0x4b400000);
+    fn = sub(fn, 12582912.0f);
+    r = i_mul_add(fn, -0.693359375f, x);
+    r = i_mul_add(fn, 2.12194440e-4f, r);
+}
+
+// Splits x into n*ln(2) + r. x must be within [-2^50, 2^50]
+template<unsigned N> SIMDPP_INL
+void i_exp_reduce(float64<N>& r, int64<N>& n, const float64<N>& x)
+{
+    float64<N> fn;
+    fn = i_mul_add(x, 1.4426950408889634074, 6755399441055744.0);
+    n = sub(bit_cast<int64<N>>(fn), 0x4338000000000000LL);
+    fn = sub(fn, 6755399441055744.0);
+    r = i_mul_add(fn, -6.93145751953125e-1, x);
+    r = i_mul_add(fn, -1.42860682030941723212e-6, r);
+}
+
+// Approximates exp(r) for |r| <= ln(2)/2
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp_approx(const float32<N>& r)
+{
+    float32<N> p, r2;
+    p = i_mul_add(r, 1.9875691500e-4f, 1.3981999507e-3f);
+    p = i_mul_add(p, r, 8.3334519073e-3f);
+    p = i_mul_add(p, r, 4.1665795894e-2f);
+    p = i_mul_add(p, r, 1.6666665459e-1f);
+    p = i_mul_add(p, r, 5.0000001201e-1f);
+    r2 = mul(r, r);
+    p = i_mul_add(p, r2, r);
+    return add(p, 1.0f);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp_approx(const float64<N>& r)
+{
+    float64<N> r2, p, q;
+    r2 = mul(r, r);
+    p = i_mul_add(r2, 1.26177193074810590878e-4, 3.02994407707441961300e-2);
+    p = i_mul_add(p, r2, 9.99999999999999999910e-1);
+    p = mul(p, r);
+    q = i_mul_add(r2, 3.00198505138664455042e-6, 2.52448340349684104192e-3);
+    q = i_mul_add(q, r2, 2.27265548208155028766e-1);
+    q = i_mul_add(q, r2, 2.00000000000000000009e0);
+    p = div(p, sub(q, p));
+    return i_mul_add(p, 2.0, 1.0);
+}
+
+// Approximates 2^r for |r| <= 0.5
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp2_approx(const float32<N>& r)
+{
+    float32<N> p;
+    p = i_mul_add(r, 1.535336188319500e-4f, 1.339887440266574e-3f);
+    p = i_mul_add(p, r, 9.618437357674640e-3f);
+    p = i_mul_add(p, r, 5.550332471162809e-2f);
+    p = i_mul_add(p, r, 2.402264791363012e-1f);
+    p = i_mul_add(p, r, 6.931472028550421e-1f);
+    return i_mul_add(p, r, 1.0f);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp2_approx(const float64<N>& r)
+{
+    float64<N> r2, p, q;
+    r2 = mul(r, r);
+    p = i_mul_add(r2, 2.30933477057345225087e-2, 2.02020656693165307700e1);
+    p = i_mul_add(p, r2, 1.51390680115615096133e3);
+    p = mul(p, r);
+    q = add(r2, 2.33184211722314911771e2);
+    q = i_mul_add(q, r2, 4.36821166879210612817e3);
+    p = div(p, sub(q, p));
+    return i_mul_add(p, 2.0, 1.0);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp_impl(const float32<N>& a)
+{
+    float32<N> x, r;
+    int32<N> n;
+    // outside this range the result is zero or infinity anyway
+    x = min(max(a, -104.0f), 89.0f);
+    i_exp_reduce(r, n, x);
+    r = i_exp_scale(i_exp_approx(r), n);
+    return blend(a, r, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp_impl(const float64<N>& a)
+{
+    float64<N> x, r;
+    int64<N> n;
+    x = min(max(a, -746.0), 710.0);
+    i_exp_reduce(r, n, x);
+    r = i_exp_scale(i_exp_approx(r), n);
+    return blend(a, r, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp2_impl(const float32<N>& a)
+{
+    float32<N> x, fn;
+    int32<N> n;
+    x = min(max(a, -151.0f), 129.0f);
+    fn = add(x, 12582912.0f);
+    n = sub(bit_cast<int32<N>>(fn), 0x4b400000);
+    fn = sub(fn, 12582912.0f);
+    x = sub(x, fn);
+    x = i_exp_scale(i_exp2_approx(x), n);
+    return blend(a, x, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp2_impl(const float64<N>& a)
+{
+    float64<N> x, fn;
+    int64<N> n;
+    x = min(max(a, -1076.0), 1025.0);
+    fn = add(x, 6755399441055744.0);
+    n = sub(bit_cast<int64<N>>(fn), 0x4338000000000000LL);
+    fn = sub(fn, 6755399441055744.0);
+    x = sub(x, fn);
+    x = i_exp_scale(i_exp2_approx(x), n);
+    return blend(a, x, isnan(a));
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_exp(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::exp(a.el(i));
+    }
+    return r;
+#else
+    return i_exp_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_exp(const float32x8& a)
+{
+    return i_exp_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_exp(const float32<16>& a)
+{
+    return i_exp_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_exp, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_exp(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::exp(a.el(i));
+    }
+    return r;
+#else
+    return i_exp_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_exp(const float64x4& a)
+{
+    return i_exp_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_exp(const float64<8>& a)
+{
+    return i_exp_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_exp, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_exp2(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::exp2(a.el(i));
+    }
+    return r;
+#else
+    return i_exp2_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_exp2(const float32x8& a)
+{
+    return i_exp2_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_exp2(const float32<16>& a)
+{
+    return i_exp2_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp2(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_exp2, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_exp2(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::exp2(a.el(i));
+    }
+    return r;
+#else
+    return i_exp2_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_exp2(const float64x4& a)
+{
+    return i_exp2_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_exp2(const float64<8>& a)
+{
+    return i_exp2_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp2(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_exp2, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -115,10 +115,10 @@ float64x2 i_floor(const float64x2& a)
     // one special case is when 'a' is in the range of (-1.0, 0.0) in which
     // a & clearbits may still yield to zero. Thus this additional check
     mask_sub1 = bit_or(mask_sub1, bit_and(mask_1to1, mask_neg));
-    float64x2 sub1 = make_float(-1.0);
+    float64x2 sub1 = make_float(1.0);
     sub1 = bit_and(sub1, mask_sub1);
 
-    a2 = bit_andnot(a, mask_1to1);
+    a2 = bit_andnot(a2, mask_1to1);
     a2 = sub(a2, sub1);
 
     return blend(a2, a, mask_range);
@@ -0,0 +1,188 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_GELU_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_GELU_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/make_float.h>
+#include <simdpp/detail/insn/f_div_approx.h>
+#include <simdpp/detail/insn/f_erf.h>
+#include <simdpp/detail/insn/f_exp.h>
+#include <simdpp/detail/insn/f_mul_add.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Computes erfc(|x|/sqrt(2)) using the approximation from Numerical Recipes
+    which has relative error below 1.2e-7 for all arguments. x^2/2 is
+    evaluated as a sum of two values so that the argument of exp does not
+    lose precision. |x| must not exceed 15.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_gelu_erfc(const float32<N>& x)
+{
+    float32<N> z, t, p, xx, err, hi, lo, e, one;
+    z = abs(x);
+    z = mul(z, 0.70710678118654752f);
+    one = make_float(1.0f);
+    t = i_mul_add(z, 0.5f, 1.0f);
+    t = i_div_rh(one, t);
+
+    p = i_mul_add(t, 0.17087277f, -0.82215223f);
+    p = i_mul_add(p, t, 1.48851587f);
+    p = i_mul_add(p, t, -1.13520398f);
+    p = i_mul_add(p, t, 0.27886807f);
+    p = i_mul_add(p, t, -0.18628806f);
+    p = i_mul_add(p, t, 0.09678418f);
+    p = i_mul_add(p, t, 0.37409196f);
+    p = i_mul_add(p, t, 1.00002368f);
+    p = i_mul_add(p, t, -1.26551223f);
+
+    xx = mul(x, x);
+    err = i_mul_err(x, x, xx);
+    xx = mul(xx, 0.5f);
+    err = mul(err, 0.5f);
+    hi = sub(p, xx);
+    lo = sub(p, add(hi, xx));
+    lo = sub(lo, err);
+    e = i_exp_impl(hi);
+    e = i_mul_add(e, lo, e);
+    return mul(t, e);
+}
+
+/*  gelu(x) = x/2 * erfc(-x/sqrt(2)). erfc is evaluated for nonpositive
+    argument only, erfc(-y) = 2 - erfc(y) is used for positive x.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_gelu_impl(const float32<N>& a)
+{
+    float32<N> x, e, rn, rp, r;
+    x = min(max(a, -15.0f), 15.0f);
+    e = mul(i_gelu_erfc(x), 0.5f);
+    rn = mul(x, e);
+    rp = sub(1.0f, e);
+    rp = mul(a, rp);
+    r = blend(rn, rp, cmp_lt(a, 0.0f));
+    return blend(a, r, isnan(a));
+}
+
+// gelu(x) = x/2 * (1 + erf(x/sqrt(2)))
+template<unsigned N> SIMDPP_INL
+float32<N> i_gelu_e_impl(const float32<N>& a)
+{
+    float32<N> x, r;
+    x = mul(a, 0.70710678118654752f);
+    r = i_erf_e_impl(x);
+    r = add(r, 1.0f);
+    r = mul(r, a);
+    return mul(r, 0.5f);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_gelu(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        float x = a.el(i);
+        double t = std::max(double(x), -40.0); // gelu(-inf) == -0
+        r.el(i) = float(0.5 * t * std::erfc(-t * 0.70710678118654752));
+    }
+    return r;
+#else
+    return i_gelu_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_gelu(const float32x8& a)
+{
+    return i_gelu_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_gelu(const float32<16>& a)
+{
+    return i_gelu_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_gelu(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_gelu, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_gelu_e(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        float x = a.el(i);
+        double t = std::max(double(x), -40.0); // gelu(-inf) == -0
+        r.el(i) = float(0.5 * t * std::erfc(-t * 0.70710678118654752));
+    }
+    return r;
+#else
+    return i_gelu_e_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_gelu_e(const float32x8& a)
+{
+    return i_gelu_e_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_gelu_e(const float32<16>& a)
+{
+    return i_gelu_e_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_gelu_e(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_gelu_e, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
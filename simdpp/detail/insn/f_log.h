@@ -0,0 +1,445 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_LOG_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_LOG_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/to_float32.h>
+#include <simdpp/detail/insn/f_mul_add.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The implementation follows the Cephes library. The argument is decomposed
+    into x = 2^e * (1 + m) with sqrt(1/2) <= 1 + m < sqrt(2). Then
+    log(x) = e*ln(2) + m + y, where y is approximated by a polynomial (float32)
+    or a rational function (float64) of m. The pieces are returned separately
+    so that the caller can combine them with the needed precision.
+
+    The decomposition is valid only for positive finite arguments, the other
+    cases are fixed up by i_log_special.
+*/
+template<unsigned N> SIMDPP_INL
+void i_log_reduce(float32<N>& m, float32<N>& y, float32<N>& e,
+                  const float32<N>& a)
+{
+    float32<N> x, z, p, t;
+    mask_float32<N> mask;
+    uint32<N> bits;
+
+    // scale subnormal numbers so that the exponent can be extracted directly
+    mask = cmp_lt(a, 1.17549435e-38f);
+    x = blend(mul(a, 8388608.0f), a, mask);
+    bits = bit_cast<uint32<N>>(x);
+    e = to_float32(int32<N>(shift_r<23>(bits)));
+    e = sub(e, 126.0f);
+    t = make_float(23.0f);
+    e = sub(e, bit_and(t, mask));
+
+    // m is within [0.5, 1)
+    bits = bit_and(bits, 0x007fffff);
+    bits = bit_or(bits, 0x3f000000);
+    m = bit_cast<float32<N>>(bits);
+
+    mask = cmp_lt(m, 0.707106781186547524f);
+    t = make_float(1.0f);
+    e = sub(e, bit_and(t, mask));
+    m = add(m, bit_and(m, mask));
+    m = sub(m, 1.0f);
+
+    z = mul(m, m);
+    p = i_mul_add(m, 7.0376836292e-2f, -1.1514610310e-1f);
+    p = i_mul_add(p, m, 1.1676998740e-1f);
+    p = i_mul_add(p, m, -1.2420140846e-1f);
+    p = i_mul_add(p, m, 1.4249322787e-1f);
+    p = i_mul_add(p, m, -1.6668057665e-1f);
+    p = i_mul_add(p, m, 2.0000714765e-1f);
+    p = i_mul_add(p, m, -2.4999993993e-1f);
+    p = i_mul_add(p, m, 3.3333331174e-1f);
+    y = mul(mul(p, m), z);
+    y = i_mul_add(z, -0.5f, y);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_log_reduce(float64<N>& m, float64<N>& y, float64<N>& e,
+                  const float64<N>& a)
+{
+    float64<N> x, z, p, q, t;
+    mask_float64<N> mask;
+    uint64<N> bits, ebits;
+
+    mask = cmp_lt(a, 2.2250738585072014e-308);
+    x = blend(mul(a, 18014398509481984.0), a, mask);
+    bits = bit_cast<uint64<N>>(x);
+
+    // the exponent is converted by placing it into the mantissa of 2^52
+    ebits = shift_r<52>(bits);
+    ebits = bit_or(ebits, 0x4330000000000000ULL);
+    e = bit_cast<float64<N>>(ebits);
+    e = sub(e, 4503599627370496.0 + 1022.0);
+    t = make_float(54.0);
+    e = sub(e, bit_and(t, mask));
+
+    bits = bit_and(bits, 0x000fffffffffffffULL);
+    bits = bit_or(bits, 0x3fe0000000000000ULL);
+    m = bit_cast<float64<N>>(bits);
+
+    mask = cmp_lt(m, 0.70710678118654752440);
+    t = make_float(1.0);
+    e = sub(e, bit_and(t, mask));
+    m = add(m, bit_and(m, mask));
+    m = sub(m, 1.0);
+
+    z = mul(m, m);
+    p = i_mul_add(m, 1.01875663804580931796e-4, 4.97494994976747001425e-1);
+    p = i_mul_add(p, m, 4.70579119878881725854e0);
+    p = i_mul_add(p, m, 1.44989225341610930846e1);
+    p = i_mul_add(p, m, 1.79368678507819816313e1);
+    p = i_mul_add(p, m, 7.70838733755885391666e0);
+    q = add(m, 1.12873587189167450590e1);
+    q = i_mul_add(q, m, 4.52279145837532221105e1);
+    q = i_mul_add(q, m, 8.29875266912776603211e1);
+    q = i_mul_add(q, m, 7.11544750618563894466e1);
+    q = i_mul_add(q, m, 2.31251620126765340583e1);
+    y = mul(m, div(mul(z, p), q));
+    y = i_mul_add(z, -0.5, y);
+}
+
+// Sets the results for zero, negative, infinite and NaN arguments
+template<class V> SIMDPP_INL
+V i_log_special(const V& a, const V& r)
+{
+    using T = typename V::element_type;
+    V inf, ninf, nan, res;
+    inf = make_float(std::numeric_limits<T>::infinity());
+    ninf = make_float(-std::numeric_limits<T>::infinity());
+    nan = make_float(std::numeric_limits<T>::quiet_NaN());
+    res = blend(inf, r, cmp_eq(a, inf));
+    res = blend(ninf, res, cmp_eq(a, 0.0));
+    res = blend(nan, res, cmp_lt(a, 0.0));
+    return blend(a, res, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_log_impl(const float32<N>& a)
+{
+    float32<N> m, y, e, r;
+    i_log_reduce(m, y, e, a);
+    y = i_mul_add(e, -2.12194440e-4f, y);
+    r = add(m, y);
+    r = i_mul_add(e, 0.693359375f, r);
+    return i_log_special(a, r);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_log_impl(const float64<N>& a)
+{
+    float64<N> m, y, e, r;
+    i_log_reduce(m, y, e, a);
+    y = i_mul_add(e, -2.121944400546905827679e-4, y);
+    r = add(m, y);
+    r = i_mul_add(e, 0.693359375, r);
+    return i_log_special(a, r);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_log2_impl(const float32<N>& a)
+{
+    // log2(x) = e + (m + y) * log2(e); multiplication by log2(e) is split as
+    // 1 + 0.44269504... to avoid the loss of precision
+    float32<N> m, y, e, r;
+    i_log_reduce(m, y, e, a);
+    r = mul(y, 0.44269504088896340736f);
+    r = i_mul_add(m, 0.44269504088896340736f, r);
+    r = add(r, y);
+    r = add(r, m);
+    r = add(r, e);
+    return i_log_special(a, r);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_log2_impl(const float64<N>& a)
+{
+    float64<N> m, y, e, r;
+    i_log_reduce(m, y, e, a);
+    r = mul(y, 0.44269504088896340736);
+    r = i_mul_add(m, 0.44269504088896340736, r);
+    r = add(r, y);
+    r = add(r, m);
+    r = add(r, e);
+    return i_log_special(a, r);
+}
+
+template<class V> SIMDPP_INL
+V i_log1p_impl(const V& a)
+{
+    // log1p(x) = log(u) * x / (u - 1) where u = 1 + x. The division
+    // compensates for the rounding error of the addition.
+    using T = typename V::element_type;
+    V u, r;
+    u = add(a, 1.0);
+    r = mul(i_log_impl(u), div(a, sub(u, 1.0)));
+    r = blend(a, r, cmp_eq(u, 1.0));
+    return blend(a, r, cmp_eq(a, std::numeric_limits<T>::infinity()));
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_log(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::log(a.el(i));
+    }
+    return r;
+#else
+    return i_log_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_log(const float32x8& a)
+{
+    return i_log_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_log(const float32<16>& a)
+{
+    return i_log_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_log(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_log, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_log(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::log(a.el(i));
+    }
+    return r;
+#else
+    return i_log_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_log(const float64x4& a)
+{
+    return i_log_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_log(const float64<8>& a)
+{
+    return i_log_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_log(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_log, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_log2(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::log2(a.el(i));
+    }
+    return r;
+#else
+    return i_log2_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_log2(const float32x8& a)
+{
+    return i_log2_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_log2(const float32<16>& a)
+{
+    return i_log2_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_log2(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_log2, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_log2(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::log2(a.el(i));
+    }
+    return r;
+#else
+    return i_log2_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_log2(const float64x4& a)
+{
+    return i_log2_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_log2(const float64<8>& a)
+{
+    return i_log2_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_log2(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_log2, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_log1p(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::log1p(a.el(i));
+    }
+    return r;
+#else
+    return i_log1p_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_log1p(const float32x8& a)
+{
+    return i_log1p_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_log1p(const float32<16>& a)
+{
+    return i_log1p_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_log1p(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_log1p, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_log1p(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::log1p(a.el(i));
+    }
+    return r;
+#else
+    return i_log1p_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_log1p(const float64x4& a)
+{
+    return i_log1p_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_log1p(const float64<8>& a)
+{
+    return i_log1p_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_log1p(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_log1p, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
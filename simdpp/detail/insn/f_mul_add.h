@@ -0,0 +1,154 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_MUL_ADD_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_MUL_ADD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_fmadd.h>
+#include <simdpp/core/f_fmsub.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/make_float.h>
+
+/*  The helpers in this file are used by the implementations of the
+    transcendental functions to evaluate polynomials. Fused multiply-add is
+    used whenever the target supports it, otherwise the computation is split
+    into separate multiplication and addition.
+*/
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+#define SIMDPP_DETAIL_HAS_FUSED_MUL_ADD 1
+#else
+#define SIMDPP_DETAIL_HAS_FUSED_MUL_ADD 0
+#endif
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Computes a*b+c
+template<unsigned N> SIMDPP_INL
+float32<N> i_mul_add(const float32<N>& a, const float32<N>& b,
+                     const float32<N>& c)
+{
+#if SIMDPP_DETAIL_HAS_FUSED_MUL_ADD
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_mul_add(const float32<N>& a, const float32<N>& b, float c)
+{
+    float32<N> vc = make_float(c);
+    return i_mul_add(a, b, vc);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_mul_add(const float32<N>& a, float b, const float32<N>& c)
+{
+    float32<N> vb = make_float(b);
+    return i_mul_add(a, vb, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_mul_add(const float32<N>& a, float b, float c)
+{
+    float32<N> vb = make_float(b);
+    float32<N> vc = make_float(c);
+    return i_mul_add(a, vb, vc);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_mul_add(const float64<N>& a, const float64<N>& b,
+                     const float64<N>& c)
+{
+#if SIMDPP_DETAIL_HAS_FUSED_MUL_ADD
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_mul_add(const float64<N>& a, const float64<N>& b, double c)
+{
+    float64<N> vc = make_float(c);
+    return i_mul_add(a, b, vc);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_mul_add(const float64<N>& a, double b, const float64<N>& c)
+{
+    float64<N> vb = make_float(b);
+    return i_mul_add(a, vb, c);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_mul_add(const float64<N>& a, double b, double c)
+{
+    float64<N> vb = make_float(b);
+    float64<N> vc = make_float(c);
+    return i_mul_add(a, vb, vc);
+}
+
+/*  Computes the rounding error of the product a*b, given p == a*b rounded to
+    the nearest representable value. The result is exact as long as the
+    product neither overflows nor underflows. Without fused multiply-add the
+    error is computed using Dekker's algorithm.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_mul_err(const float32<N>& a, const float32<N>& b,
+                     const float32<N>& p)
+{
+#if SIMDPP_DETAIL_HAS_FUSED_MUL_ADD
+    return fmsub(a, b, p);
+#else
+    float32<N> ta, tb, ah, al, bh, bl, r;
+    ta = mul(a, 4097.0f); // 2^12 + 1
+    tb = mul(b, 4097.0f);
+    ah = sub(ta, sub(ta, a)); al = sub(a, ah);
+    bh = sub(tb, sub(tb, b)); bl = sub(b, bh);
+    r = sub(mul(ah, bh), p);
+    r = add(r, mul(ah, bl));
+    r = add(r, mul(al, bh));
+    return add(r, mul(al, bl));
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_mul_err(const float64<N>& a, const float64<N>& b,
+                     const float64<N>& p)
+{
+#if SIMDPP_DETAIL_HAS_FUSED_MUL_ADD
+    return fmsub(a, b, p);
+#else
+    float64<N> ta, tb, ah, al, bh, bl, r;
+    ta = mul(a, 134217729.0); // 2^27 + 1
+    tb = mul(b, 134217729.0);
+    ah = sub(ta, sub(ta, a)); al = sub(a, ah);
+    bh = sub(tb, sub(tb, b)); bl = sub(b, bh);
+    r = sub(mul(ah, bh), p);
+    r = add(r, mul(ah, bl));
+    r = add(r, mul(al, bh));
+    return add(r, mul(al, bl));
+#endif
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
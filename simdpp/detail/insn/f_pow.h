@@ -0,0 +1,203 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_POW_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_POW_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_floor.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/to_float32.h>
+#include <simdpp/core/to_float64.h>
+#include <simdpp/detail/insn/f_exp.h>
+#include <simdpp/detail/insn/f_log.h>
+#include <simdpp/detail/insn/f_mul_add.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  pow(x, y) is computed as exp(y * log(|x|)). The logarithm is evaluated as
+    a sum of two values hi + lo in order to retain enough precision for the
+    product with y. The sign and the special cases are fixed up afterwards
+    following the rules of C99 pow.
+
+    The float32 version is computed in float64 precision.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> i_pow_impl(const float64<N>& a, const float64<N>& b)
+{
+    using T = double;
+    float64<N> x, m, y, e, hi, lo, t, s, p_hi, p_lo, r, one, inf, ninf, nzero;
+    mask_float64<N> mask, odd, is_int;
+    int64<N> n;
+
+    x = abs(a);
+    one = make_float(1.0);
+    inf = make_float(std::numeric_limits<T>::infinity());
+    ninf = make_float(-std::numeric_limits<T>::infinity());
+    nzero = make_float(-0.0);
+
+    // log(|x|) = hi + lo
+    i_log_reduce(m, y, e, x);
+    t = mul(e, 0.693359375); // exact
+    hi = add(t, m);
+    s = sub(hi, t);
+    lo = add(sub(t, sub(hi, s)), sub(m, s));
+    lo = add(lo, y);
+    lo = i_mul_add(e, -2.121944400546905827679e-4, lo);
+    t = add(hi, lo);
+    lo = sub(lo, sub(t, hi));
+    hi = t;
+
+    hi = blend(ninf, hi, cmp_eq(x, 0.0));
+    hi = blend(inf, hi, cmp_eq(x, inf));
+
+    // y * log(|x|) = p_hi + p_lo
+    p_hi = mul(b, hi);
+    p_lo = i_mul_add(b, lo, i_mul_err(b, hi, p_hi));
+    mask = cmp_lt(abs(p_hi), 746.0);
+    p_lo = bit_and(p_lo, mask);
+
+    t = min(max(p_hi, -746.0), 710.0);
+    i_exp_reduce(r, n, t);
+    r = add(r, p_lo);
+    r = i_exp_scale(i_exp_approx(r), n);
+
+    // negative x and odd integer y give negative result
+    is_int = cmp_eq(floor(b), b);
+    t = mul(b, 0.5);
+    odd = bit_and(is_int, cmp_neq(floor(t), t));
+    r = bit_xor(r, bit_and(bit_and(a, nzero), odd));
+
+    // negative finite x and non-integer finite y give NaN
+    mask = bit_andnot(bit_and(cmp_lt(a, 0.0), cmp_lt(x, inf)), is_int);
+    r = bit_or(r, mask);
+    r = blend(a, r, isnan(a));
+    r = blend(b, r, isnan(b));
+
+    // 1 for y == 0, x == 1 and for x == -1 with infinite y
+    mask = bit_and(cmp_eq(a, -1.0), cmp_eq(abs(b), inf));
+    mask = bit_or(mask, cmp_eq(a, 1.0));
+    mask = bit_or(mask, cmp_eq(b, 0.0));
+    return blend(one, r, mask);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_pow(const float64x2& a, const float64x2& b)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::pow(a.el(i), b.el(i));
+    }
+    return r;
+#else
+    return i_pow_impl(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_pow(const float64x4& a, const float64x4& b)
+{
+    return i_pow_impl(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_pow(const float64<8>& a, const float64<8>& b)
+{
+    return i_pow_impl(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_pow(const float64<N>& a, const float64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(float64<N>, i_pow, a, b);
+}
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_pow_impl(const float32<N>& a, const float32<N>& b)
+{
+    float64<N> a64, b64, r;
+    a64 = to_float64(a);
+    b64 = to_float64(b);
+    r = i_pow(a64, b64);
+    return to_float32(r);
+}
+
+static SIMDPP_INL
+float32x4 i_pow(const float32x4& a, const float32x4& b)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::pow(a.el(i), b.el(i));
+    }
+    return r;
+#else
+    return i_pow_impl(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_pow(const float32x8& a, const float32x8& b)
+{
+    return i_pow_impl(a, b);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_pow(const float32<16>& a, const float32<16>& b)
+{
+    return i_pow_impl(a, b);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_pow(const float32<N>& a, const float32<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(float32<N>, i_pow, a, b);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,146 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_SIGMOID_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_SIGMOID_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/make_float.h>
+#include <simdpp/detail/insn/f_div_approx.h>
+#include <simdpp/detail/insn/f_exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  sigmoid(x) = 1 / (1 + exp(-x)) for nonnegative x and
+    sigmoid(x) = exp(x) / (1 + exp(x)) for negative x. The divisor is always
+    within [1, 2].
+*/
+template<unsigned N> SIMDPP_INL
+void i_sigmoid_parts(float32<N>& num, float32<N>& den, const float32<N>& a)
+{
+    float32<N> e, one;
+    e = abs(a);
+    e = neg(e);
+    e = i_exp_impl(e);
+    one = make_float(1.0f);
+    num = blend(e, one, cmp_lt(a, 0.0f));
+    den = add(e, 1.0f);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_sigmoid_impl(const float32<N>& a)
+{
+    float32<N> num, den;
+    i_sigmoid_parts(num, den, a);
+    return i_div_rh(num, den);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_sigmoid_e_impl(const float32<N>& a)
+{
+    float32<N> num, den;
+    i_sigmoid_parts(num, den, a);
+    return i_div_e(num, den);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_sigmoid(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        float x = a.el(i);
+        r.el(i) = float(1.0 / (1.0 + std::exp(-double(x))));
+    }
+    return r;
+#else
+    return i_sigmoid_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_sigmoid(const float32x8& a)
+{
+    return i_sigmoid_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_sigmoid(const float32<16>& a)
+{
+    return i_sigmoid_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_sigmoid(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_sigmoid, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_sigmoid_e(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        float x = a.el(i);
+        r.el(i) = float(1.0 / (1.0 + std::exp(-double(x))));
+    }
+    return r;
+#else
+    return i_sigmoid_e_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_sigmoid_e(const float32x8& a)
+{
+    return i_sigmoid_e_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_sigmoid_e(const float32<16>& a)
+{
+    return i_sigmoid_e_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_sigmoid_e(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_sigmoid_e, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
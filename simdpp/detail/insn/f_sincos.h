@@ -0,0 +1,562 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_SINCOS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_SINCOS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/to_float32.h>
+#include <simdpp/core/to_float64.h>
+#include <simdpp/core/to_int32.h>
+#include <simdpp/detail/insn/f_mul_add.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The implementation follows the Cephes library. The argument is reduced to
+    x = k*pi/2 + r, |r| <= pi/4, then sin(r) and cos(r) are approximated by
+    polynomials. The two lowest bits of k select the polynomial and the sign
+    of the result.
+
+    The reduction is performed on |x|, the sign is restored afterwards using
+    the symmetry of the functions. pi/2 is split into four parts, the first
+    three of which have 26 significant bits, so that k times each of them is
+    exact for k < 2^27. The subtractions are exact when the partial result is
+    close to the subtrahend, thus r keeps its relative precision even close to
+    the multiples of pi/2. The float32 reduction is performed in float64
+    precision with the same constants.
+*/
+
+/*  Computes r and the low bits of the integer representation of k for |a|.
+*/
+template<unsigned N> SIMDPP_INL
+void i_sincos_reduce_arg(float64<N>& r, uint64<N>& qbits, const float64<N>& x)
+{
+    float64<N> fk;
+    fk = i_mul_add(x, 0.63661977236758134308, 6755399441055744.0);
+    qbits = bit_cast<uint64<N>>(fk);
+    fk = sub(fk, 6755399441055744.0);
+
+    r = i_mul_add(fk, -1.5707963109016418457e0, x);
+    r = i_mul_add(fk, -1.5893254712295857066e-8, r);
+    r = i_mul_add(fk, -6.1232339320535941834e-17, r);
+    r = i_mul_add(fk, -6.3683171635109499793e-25, r);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sincos_reduce(float32<N>& s, float32<N>& c, uint32<N>& qbits,
+                     const float32<N>& a)
+{
+    float32<N> r, z, p;
+    float64<N> x, rd;
+    uint64<N> qbits64;
+    x = to_float64(abs(a));
+    i_sincos_reduce_arg(rd, qbits64, x);
+    qbits = to_uint32(qbits64);
+    r = to_float32(rd);
+    z = mul(r, r);
+
+    p = i_mul_add(z, -1.9515295891e-4f, 8.3321608736e-3f);
+    p = i_mul_add(p, z, -1.6666654611e-1f);
+    p = mul(p, z);
+    s = i_mul_add(p, r, r);
+
+    p = i_mul_add(z, 2.443315711809948e-5f, -1.388731625493765e-3f);
+    p = i_mul_add(p, z, 4.166664568298827e-2f);
+    p = mul(p, z);
+    p = mul(p, z);
+    p = i_mul_add(z, -0.5f, p);
+    c = add(p, 1.0f);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sincos_reduce(float64<N>& s, float64<N>& c, uint64<N>& qbits,
+                     const float64<N>& a)
+{
+    float64<N> x, r, z, p;
+    x = abs(a);
+    i_sincos_reduce_arg(r, qbits, x);
+    z = mul(r, r);
+
+    p = i_mul_add(z, 1.58962301576546568060e-10, -2.50507477628578072866e-8);
+    p = i_mul_add(p, z, 2.75573136213857245213e-6);
+    p = i_mul_add(p, z, -1.98412698295895385996e-4);
+    p = i_mul_add(p, z, 8.33333333332211858878e-3);
+    p = i_mul_add(p, z, -1.66666666666666307295e-1);
+    p = mul(p, z);
+    s = i_mul_add(p, r, r);
+
+    p = i_mul_add(z, -1.13585365213876817300e-11, 2.08757008419747316778e-9);
+    p = i_mul_add(p, z, -2.75573141792967388112e-7);
+    p = i_mul_add(p, z, 2.48015872888517045348e-5);
+    p = i_mul_add(p, z, -1.38888888888730564116e-3);
+    p = i_mul_add(p, z, 4.16666666666665929218e-2);
+    p = mul(p, z);
+    p = mul(p, z);
+    p = i_mul_add(z, -0.5, p);
+    c = add(p, 1.0);
+}
+
+/*  Given the polynomial results and the quadrant, computes sin(a) and
+    cos(a). For nonnegative a:
+        k mod 4 == 0:  sin(a) =  s, cos(a) =  c
+        k mod 4 == 1:  sin(a) =  c, cos(a) = -s
+        k mod 4 == 2:  sin(a) = -s, cos(a) = -c
+        k mod 4 == 3:  sin(a) = -c, cos(a) =  s
+    sin(a) is additionally negated for negative a.
+*/
+template<unsigned N> SIMDPP_INL
+void i_sincos_finish(float32<N>& rs, float32<N>& rc, const float32<N>& s,
+                     const float32<N>& c, const uint32<N>& qbits,
+                     const float32<N>& a)
+{
+    mask_float32<N> swap;
+    uint32<N> sign_s, sign_c;
+    swap = bit_cast<mask_float32<N>>(cmp_eq(bit_and(qbits, 1), 1));
+    sign_s = shift_l<30>(bit_and(qbits, 2));
+    sign_s = bit_xor(sign_s, bit_and(bit_cast<uint32<N>>(a), 0x80000000));
+    sign_c = shift_l<30>(bit_and(add(qbits, 1), 2));
+    rs = bit_xor(blend(c, s, swap), sign_s);
+    rc = bit_xor(blend(s, c, swap), sign_c);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sincos_finish(float64<N>& rs, float64<N>& rc, const float64<N>& s,
+                     const float64<N>& c, const uint64<N>& qbits,
+                     const float64<N>& a)
+{
+    mask_float64<N> swap;
+    uint64<N> sign_s, sign_c;
+    swap = bit_cast<mask_float64<N>>(cmp_eq(bit_and(qbits, 1), 1));
+    sign_s = shift_l<62>(bit_and(qbits, 2));
+    sign_s = bit_xor(sign_s, bit_and(bit_cast<uint64<N>>(a),
+                                     0x8000000000000000ULL));
+    sign_c = shift_l<62>(bit_and(add(qbits, 1), 2));
+    rs = bit_xor(blend(c, s, swap), sign_s);
+    rc = bit_xor(blend(s, c, swap), sign_c);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_sin_impl(const float32<N>& a)
+{
+    float32<N> s, c, rs, rc;
+    uint32<N> qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+    return rs;
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_cos_impl(const float32<N>& a)
+{
+    float32<N> s, c, rs, rc;
+    uint32<N> qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+    return rc;
+}
+
+// tan(a) = s/c for even k and -c/s for odd k
+template<unsigned N> SIMDPP_INL
+float32<N> i_tan_impl(const float32<N>& a)
+{
+    float32<N> s, c, num, den;
+    uint32<N> qbits;
+    mask_float32<N> swap;
+    i_sincos_reduce(s, c, qbits, a);
+    swap = bit_cast<mask_float32<N>>(cmp_eq(bit_and(qbits, 1), 1));
+    num = blend(neg(c), s, swap);
+    num = bit_xor(num, bit_and(bit_cast<uint32<N>>(a), 0x80000000));
+    den = blend(s, c, swap);
+    return div(num, den);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_sin_impl(const float64<N>& a)
+{
+    float64<N> s, c, rs, rc;
+    uint64<N> qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+    return rs;
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_cos_impl(const float64<N>& a)
+{
+    float64<N> s, c, rs, rc;
+    uint64<N> qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+    return rc;
+}
+
+// tan(a) = s/c for even k and -c/s for odd k
+template<unsigned N> SIMDPP_INL
+float64<N> i_tan_impl(const float64<N>& a)
+{
+    float64<N> s, c, num, den;
+    uint64<N> qbits;
+    mask_float64<N> swap;
+    i_sincos_reduce(s, c, qbits, a);
+    swap = bit_cast<mask_float64<N>>(cmp_eq(bit_and(qbits, 1), 1));
+    num = blend(neg(c), s, swap);
+    num = bit_xor(num, bit_and(bit_cast<uint64<N>>(a), 0x8000000000000000ULL));
+    den = blend(s, c, swap);
+    return div(num, den);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_sincos(float32x4& rs, float32x4& rc, const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    for (unsigned i = 0; i < a.length; i++) {
+        rs.el(i) = std::sin(a.el(i));
+        rc.el(i) = std::cos(a.el(i));
+    }
+#else
+    float32x4 s, c;
+    uint32x4 qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_sincos(float32x8& rs, float32x8& rc, const float32x8& a)
+{
+    float32x8 s, c;
+    uint32x8 qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_sincos(float32<16>& rs, float32<16>& rc, const float32<16>& a)
+{
+    float32<16> s, c;
+    uint32<16> qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_sincos(float32<N>& rs, float32<N>& rc, const float32<N>& a)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_sincos(rs.vec(i), rc.vec(i), a.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_sincos(float64x2& rs, float64x2& rc, const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    for (unsigned i = 0; i < a.length; i++) {
+        rs.el(i) = std::sin(a.el(i));
+        rc.el(i) = std::cos(a.el(i));
+    }
+#else
+    float64x2 s, c;
+    uint64x2 qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_sincos(float64x4& rs, float64x4& rc, const float64x4& a)
+{
+    float64x4 s, c;
+    uint64x4 qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_sincos(float64<8>& rs, float64<8>& rc, const float64<8>& a)
+{
+    float64<8> s, c;
+    uint64<8> qbits;
+    i_sincos_reduce(s, c, qbits, a);
+    i_sincos_finish(rs, rc, s, c, qbits, a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_sincos(float64<N>& rs, float64<N>& rc, const float64<N>& a)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_sincos(rs.vec(i), rc.vec(i), a.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_sin(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::sin(a.el(i));
+    }
+    return r;
+#else
+    return i_sin_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_sin(const float32x8& a)
+{
+    return i_sin_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_sin(const float32<16>& a)
+{
+    return i_sin_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_sin(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_sin, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_sin(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::sin(a.el(i));
+    }
+    return r;
+#else
+    return i_sin_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_sin(const float64x4& a)
+{
+    return i_sin_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_sin(const float64<8>& a)
+{
+    return i_sin_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_sin(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_sin, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_cos(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::cos(a.el(i));
+    }
+    return r;
+#else
+    return i_cos_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_cos(const float32x8& a)
+{
+    return i_cos_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_cos(const float32<16>& a)
+{
+    return i_cos_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_cos(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_cos, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_cos(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::cos(a.el(i));
+    }
+    return r;
+#else
+    return i_cos_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_cos(const float64x4& a)
+{
+    return i_cos_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_cos(const float64<8>& a)
+{
+    return i_cos_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_cos(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_cos, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_tan(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::tan(a.el(i));
+    }
+    return r;
+#else
+    return i_tan_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_tan(const float32x8& a)
+{
+    return i_tan_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_tan(const float32<16>& a)
+{
+    return i_tan_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_tan(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_tan, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_tan(const float64x2& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    float64x2 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::tan(a.el(i));
+    }
+    return r;
+#else
+    return i_tan_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_tan(const float64x4& a)
+{
+    return i_tan_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_tan(const float64<8>& a)
+{
+    return i_tan_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_tan(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float64<N>, i_tan, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,165 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_SOFTPLUS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_SOFTPLUS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/detail/insn/f_div_approx.h>
+#include <simdpp/detail/insn/f_exp.h>
+#include <simdpp/detail/insn/f_log.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  softplus(x) = max(x, 0) + log1p(exp(-|x|)). log1p(t) is computed as
+    log(u) * t / (u - 1) where u = 1 + t, which compensates the rounding error
+    of the addition.
+*/
+template<unsigned N> SIMDPP_INL
+void i_softplus_parts(float32<N>& l, float32<N>& f, float32<N>& t,
+                      float32<N>& d, const float32<N>& a)
+{
+    float32<N> u;
+    t = abs(a);
+    t = neg(t);
+    t = i_exp_impl(t);
+    u = add(t, 1.0f);
+    l = i_log_impl(u);
+    d = sub(u, 1.0f);
+    f = max(a, 0.0f);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_softplus_impl(const float32<N>& a)
+{
+    float32<N> l, f, t, d, r;
+    mask_float32<N> tiny;
+    i_softplus_parts(l, f, t, d, a);
+    // d is zero only when t is tiny, in which case log1p(t) == t
+    tiny = cmp_eq(d, 0.0f);
+    d = blend(t, d, tiny);
+    r = mul(l, i_div_rh(t, d));
+    r = blend(t, r, tiny);
+    r = add(f, r);
+    return blend(a, r, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_softplus_e_impl(const float32<N>& a)
+{
+    float32<N> l, f, t, d, r;
+    mask_float32<N> tiny;
+    i_softplus_parts(l, f, t, d, a);
+    tiny = cmp_eq(d, 0.0f);
+    d = blend(t, d, tiny);
+    r = mul(l, i_div_e(t, d));
+    r = blend(t, r, tiny);
+    r = add(f, r);
+    return blend(a, r, isnan(a));
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_softplus(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        float x = a.el(i);
+        r.el(i) = float(std::log1p(std::exp(-std::abs(double(x)))) + (x > 0 ? double(x) : 0.0));
+    }
+    return r;
+#else
+    return i_softplus_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_softplus(const float32x8& a)
+{
+    return i_softplus_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_softplus(const float32<16>& a)
+{
+    return i_softplus_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_softplus(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_softplus, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_softplus_e(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        float x = a.el(i);
+        r.el(i) = float(std::log1p(std::exp(-std::abs(double(x)))) + (x > 0 ? double(x) : 0.0));
+    }
+    return r;
+#else
+    return i_softplus_e_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_softplus_e(const float32x8& a)
+{
+    return i_softplus_e_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_softplus_e(const float32<16>& a)
+{
+    return i_softplus_e_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_softplus_e(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_softplus_e, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,172 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_TANH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_TANH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_ge.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/detail/insn/f_div_approx.h>
+#include <simdpp/detail/insn/f_exp.h>
+#include <simdpp/detail/insn/f_mul_add.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  For |x| < 0.625 the Cephes polynomial is used, otherwise
+    tanh(|x|) = 1 - 2 / (exp(2|x|) + 1). The argument of exp is limited to 18
+    where the result already rounds to 1.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_tanh_impl(const float32<N>& a)
+{
+    float32<N> x, z, p, small, large, e, two, r;
+    x = abs(a);
+
+    z = mul(x, x);
+    p = i_mul_add(z, -5.70498872745e-3f, 2.06390887954e-2f);
+    p = i_mul_add(p, z, -5.37397155531e-2f);
+    p = i_mul_add(p, z, 1.33314422036e-1f);
+    p = i_mul_add(p, z, -3.33332819422e-1f);
+    p = mul(p, z);
+    small = i_mul_add(p, x, x);
+
+    e = add(x, x);
+    e = min(e, 18.0f);
+    e = add(i_exp_impl(e), 1.0f);
+    two = make_float(2.0f);
+    large = sub(1.0f, i_div_rh(two, e));
+
+    // NaN is passed through the first branch
+    r = blend(large, small, cmp_ge(x, 0.625f));
+    return bit_xor(r, bit_and(a, 0x80000000));
+}
+
+/*  Rational approximation of degree 13/6 on [-7.9, 7.9]. Outside this range
+    the result is rounded to +/-1 anyway.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_tanh_e_impl(const float32<N>& a)
+{
+    float32<N> x, z, p, q, r;
+    x = min(max(a, -7.90531110763549805f), 7.90531110763549805f);
+    z = mul(x, x);
+    p = i_mul_add(z, -2.76076847742355e-16f, 2.00018790482477e-13f);
+    p = i_mul_add(p, z, -8.60467152213735e-11f);
+    p = i_mul_add(p, z, 5.12229709037114e-08f);
+    p = i_mul_add(p, z, 1.48572235717979e-05f);
+    p = i_mul_add(p, z, 6.37261928875436e-04f);
+    p = i_mul_add(p, z, 4.89352455891786e-03f);
+    p = mul(p, x);
+    q = i_mul_add(z, 1.19825839466702e-06f, 1.18534705686654e-04f);
+    q = i_mul_add(q, z, 2.26843463243900e-03f);
+    q = i_mul_add(q, z, 4.89352518554385e-03f);
+    r = i_div_e(p, q);
+
+    // tanh(x) == x for small x. This also passes NaN through
+    x = abs(a);
+    return blend(r, a, cmp_ge(x, 0.0004f));
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_tanh(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::tanh(a.el(i));
+    }
+    return r;
+#else
+    return i_tanh_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_tanh(const float32x8& a)
+{
+    return i_tanh_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_tanh(const float32<16>& a)
+{
+    return i_tanh_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_tanh(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_tanh, a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32x4 i_tanh_e(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::tanh(a.el(i));
+    }
+    return r;
+#else
+    return i_tanh_e_impl(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_tanh_e(const float32x8& a)
+{
+    return i_tanh_e_impl(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_tanh_e(const float32<16>& a)
+{
+    return i_tanh_e_impl(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_tanh_e(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(float32<N>, i_tanh_e, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
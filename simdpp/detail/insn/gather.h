@@ -0,0 +1,209 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstddef>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Emulates gather by loading each element separately. Elements are loaded
+    only for the lanes in which the mask is set, other lanes are set to zero.
+    The emulation is shared by all architectures that don't have native gather
+    instructions.
+*/
+template<class V, class I> SIMDPP_INL
+V i_emul_gather(const char* p, const I& idx)
+{
+    using T = typename V::element_type;
+    static_assert(V::length == I::length, "Vector lengths must match");
+    mem_block<I> mi(idx);
+    mem_block<V> r;
+    for (unsigned i = 0; i < V::length; i++) {
+        std::memcpy(&r[i], p + std::size_t(mi[i]) * sizeof(T), sizeof(T));
+    }
+    return r;
+}
+
+template<class V, class I, class M> SIMDPP_INL
+V i_emul_gather_masked(const char* p, const I& idx, const M& mask)
+{
+    using T = typename V::element_type;
+    static_assert(V::length == I::length, "Vector lengths must match");
+    mem_block<I> mi(idx);
+    mem_block<V> mm(mask.unmask());
+    mem_block<V> r;
+    for (unsigned i = 0; i < V::length; i++) {
+        r[i] = 0;
+        if (mm[i] != 0) {
+            std::memcpy(&r[i], p + std::size_t(mi[i]) * sizeof(T), sizeof(T));
+        }
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_gather(const char* p, const uint32<4>& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_i32gather_epi32(reinterpret_cast<const int*>(p), idx.native(), 4);
+#else
+    return i_emul_gather<uint32<4>>(p, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_gather(const char* p, const uint32<8>& idx)
+{
+    return _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), idx.native(), 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_gather(const char* p, const uint32<16>& idx)
+{
+    return _mm512_i32gather_epi32(idx.native(), p, 4);
+}
+#endif
+
+static SIMDPP_INL
+uint64<2> i_gather(const char* p, const uint64<2>& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_i64gather_epi64(reinterpret_cast<const long long*>(p), idx.native(), 8);
+#else
+    return i_emul_gather<uint64<2>>(p, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_gather(const char* p, const uint64<4>& idx)
+{
+    return _mm256_i64gather_epi64(reinterpret_cast<const long long*>(p), idx.native(), 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_gather(const char* p, const uint64<8>& idx)
+{
+    return _mm512_i64gather_epi64(idx.native(), p, 8);
+}
+#endif
+
+template<class V> SIMDPP_INL
+V i_gather(const char* p, const V& idx)
+{
+    V r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_gather(p, idx.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_gather_masked(const char* p, const uint32<4>& idx,
+                          const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_mask_i32gather_epi32(_mm_setzero_si128(),
+                                    reinterpret_cast<const int*>(p),
+                                    idx.native(), mask.native(), 4);
+#else
+    return i_emul_gather_masked<uint32<4>>(p, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_gather_masked(const char* p, const uint32<8>& idx,
+                          const mask_int32<8>& mask)
+{
+    return _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                       reinterpret_cast<const int*>(p),
+                                       idx.native(), mask.native(), 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_gather_masked(const char* p, const uint32<16>& idx,
+                           const mask_int32<16>& mask)
+{
+    return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask.native(),
+                                       idx.native(), p, 4);
+}
+#endif
+
+static SIMDPP_INL
+uint64<2> i_gather_masked(const char* p, const uint64<2>& idx,
+                          const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_mask_i64gather_epi64(_mm_setzero_si128(),
+                                    reinterpret_cast<const long long*>(p),
+                                    idx.native(), mask.native(), 8);
+#else
+    return i_emul_gather_masked<uint64<2>>(p, idx, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_gather_masked(const char* p, const uint64<4>& idx,
+                          const mask_int64<4>& mask)
+{
+    return _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
+                                       reinterpret_cast<const long long*>(p),
+                                       idx.native(), mask.native(), 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_gather_masked(const char* p, const uint64<8>& idx,
+                          const mask_int64<8>& mask)
+{
+    return _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask.native(),
+                                       idx.native(), p, 8);
+}
+#endif
+
+template<class V, class M> SIMDPP_INL
+V i_gather_masked(const char* p, const V& idx, const M& mask)
+{
+    V r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_gather_masked(p, idx.vec(i), mask.vec(i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
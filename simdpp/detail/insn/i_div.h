@@ -0,0 +1,221 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/to_int8.h>
+#include <simdpp/core/to_int16.h>
+#include <simdpp/detail/traits.h>
+#include <cstdint>
+#include <type_traits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// -----------------------------------------------------------------------------
+// Multiplies each element by a scalar and returns the high half of the result
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_div_mul_hi(const uint8<N>& a, uint8_t m)
+{
+    // high(a * m) == high16(a * (m << 8))
+    uint16<N> a16 = to_uint16(a);
+    uint16<N> m16 = make_uint(uint16_t(m) << 8);
+    return to_uint8(mul_hi(a16, m16));
+}
+
+template<unsigned N> SIMDPP_INL
+int8<N> i_div_mul_hi(const int8<N>& a, int8_t m)
+{
+    int16<N> a16 = to_int16(a);
+    int16<N> m16 = make_int(int16_t(m) * 256);
+    return to_int8(mul_hi(a16, m16));
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_div_mul_hi(const uint16<N>& a, uint16_t m)
+{
+    uint16<N> vm = make_uint(m);
+    return mul_hi(a, vm);
+}
+
+template<unsigned N> SIMDPP_INL
+int16<N> i_div_mul_hi(const int16<N>& a, int16_t m)
+{
+    int16<N> vm = make_int(m);
+    return mul_hi(a, vm);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_div_mul_hi(const uint32<N>& a, uint32_t m)
+{
+    uint32<N> vm = make_uint(m);
+    return mul_hi(a, vm);
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_div_mul_hi(const int32<N>& a, int32_t m)
+{
+    int32<N> vm = make_int(m);
+    return mul_hi(a, vm);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_div_mul_hi(const uint64<N>& a, uint64_t m)
+{
+    uint64<N> vm = make_uint(m);
+    return mul_hi(a, vm);
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_div_mul_hi(const int64<N>& a, int64_t m)
+{
+    int64<N> vm = make_int(m);
+    return mul_hi(a, vm);
+}
+
+// -----------------------------------------------------------------------------
+// Multiplies each element by a scalar and returns the low half of the result
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_div_mul_lo(const uint8<N>& a, uint8_t m)
+{
+    uint16<N> a16 = to_uint16(a);
+    uint16<N> m16 = make_uint(m);
+    return to_uint8(mul_lo(a16, m16));
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_div_mul_lo(const uint16<N>& a, uint16_t m)
+{
+    uint16<N> vm = make_uint(m);
+    return mul_lo(a, vm);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_div_mul_lo(const uint32<N>& a, uint32_t m)
+{
+    uint32<N> vm = make_uint(m);
+    return mul_lo(a, vm);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_div_mul_lo(const uint64<N>& a, uint64_t m)
+{
+    uint64<N> vm = make_uint(m);
+    return mul_lo(a, vm);
+}
+
+// -----------------------------------------------------------------------------
+
+template<class V, class T> SIMDPP_INL
+V i_div_unsigned(const V& a, const divider<T>& d)
+{
+    V t = i_div_mul_hi(a, d.magic());
+    V q = sub(a, t);
+    q = shift_r(q, d.pre_shift());
+    q = add(q, t);
+    return shift_r(q, d.shift());
+}
+
+template<class V, class T> SIMDPP_INL
+V i_div_signed(const V& a, const divider<T>& d)
+{
+    const unsigned B = sizeof(T) * 8;
+    V q = add(a, i_div_mul_hi(a, d.magic()));
+    q = shift_r(q, d.shift());
+    q = sub(q, shift_r<B-1>(a));
+    V sign = make_int(d.sign());
+    return sub(bit_xor(q, sign), sign);
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_div(const uint8<N>& a, const divider<uint8_t>& d)
+{
+    return i_div_unsigned(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int8<N> i_div(const int8<N>& a, const divider<int8_t>& d)
+{
+    return i_div_signed(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_div(const uint16<N>& a, const divider<uint16_t>& d)
+{
+    return i_div_unsigned(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int16<N> i_div(const int16<N>& a, const divider<int16_t>& d)
+{
+    return i_div_signed(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_div(const uint32<N>& a, const divider<uint32_t>& d)
+{
+    return i_div_unsigned(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_div(const int32<N>& a, const divider<int32_t>& d)
+{
+    return i_div_signed(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_div(const uint64<N>& a, const divider<uint64_t>& d)
+{
+    return i_div_unsigned(a, d);
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_div(const int64<N>& a, const divider<int64_t>& d)
+{
+    return i_div_signed(a, d);
+}
+
+// -----------------------------------------------------------------------------
+
+/*  The remainder is computed as a - q * d. The multiplication wraps around,
+    thus it is done on unsigned elements for all types.
+*/
+template<class V, class T> SIMDPP_INL
+V i_mod(const V& a, const divider<T>& d)
+{
+    using U = typename detail::remove_sign<V>::type;
+    using UT = typename std::make_unsigned<T>::type;
+    U q = i_div(a, d);
+    U ua = a;
+    return V(sub(ua, i_div_mul_lo(q, UT(d.divisor()))));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -16,8 +16,14 @@
 #include <simdpp/detail/not_implemented.h>
 #include <simdpp/core/bit_and.h>
 #include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/make_uint.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/detail/insn/i_shift.h>
+#include <simdpp/detail/width.h>
 #include <simdpp/detail/null/math.h>
 
 namespace simdpp {
@@ -230,6 +236,180 @@ V i_shift_l(const V& a, unsigned count)
     SIMDPP_VEC_ARRAY_IMPL2S(V, i_shift_l, a, count);
 }
 
+// -----------------------------------------------------------------------------
+// Shifts each element by the count in the corresponding element of count
+
+static SIMDPP_INL
+uint32<4> i_shift_l(const uint32<4>& a, const uint32<4>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_l_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return _mm_sllv_epi32(a.native(), count.native());
+#elif SIMDPP_USE_SSE2
+    // a << count == a * 2^count. The power of two is computed by constructing
+    // a floating-point number with count as the exponent. 2^31 is out of range
+    // of int32, but the conversion returns 0x80000000 in that case anyway.
+    uint32<4> p = shift_l<23>(count);
+    p = add(p, 0x3f800000);
+    p = _mm_cvttps_epi32(_mm_castsi128_ps(p.native()));
+#if SIMDPP_USE_SSE4_1
+    return _mm_mullo_epi32(a.native(), p.native());
+#else
+    __m128i ev = _mm_mul_epu32(a.native(), p.native());
+    __m128i od = _mm_mul_epu32(_mm_srli_epi64(a.native(), 32),
+                               _mm_srli_epi64(p.native(), 32));
+    ev = _mm_shuffle_epi32(ev, _MM_SHUFFLE(2,0,2,0));
+    od = _mm_shuffle_epi32(od, _MM_SHUFFLE(2,0,2,0));
+    return _mm_unpacklo_epi32(ev, od);
+#endif
+#elif SIMDPP_USE_NEON
+    return vshlq_u32(a.native(), vreinterpretq_s32_u32(count.native()));
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sl(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return (v4u32) __msa_sll_w((v4i32) a.native(), (v4i32) count.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_shift_l(const uint32<8>& a, const uint32<8>& count)
+{
+    return _mm256_sllv_epi32(a.native(), count.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_shift_l(const uint32<16>& a, const uint32<16>& count)
+{
+    return _mm512_sllv_epi32(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_shift_l(const uint64<2>& a, const uint64<2>& count)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_sllv_epi64(a.native(), count.native());
+#elif SIMDPP_USE_SSE2
+    // _mm_sll_epi64 takes the count from the lower element
+    __m128i r0 = _mm_sll_epi64(a.native(), count.native());
+    __m128i r1 = _mm_sll_epi64(a.native(),
+                               _mm_unpackhi_epi64(count.native(), count.native()));
+#if SIMDPP_USE_SSE4_1
+    return _mm_blend_epi16(r0, r1, 0xf0);
+#else
+    return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(r1),
+                                        _mm_castsi128_pd(r0)));
+#endif
+#elif SIMDPP_USE_NEON
+    return vshlq_u64(a.native(), vreinterpretq_s64_u64(count.native()));
+#elif SIMDPP_USE_VSX_207
+    return vec_sl(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_sll_d((v2i64) a.native(), (v2i64) count.native());
+#elif SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    return detail::null::shift_l_v(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_shift_l(const uint64<4>& a, const uint64<4>& count)
+{
+    return _mm256_sllv_epi64(a.native(), count.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_shift_l(const uint64<8>& a, const uint64<8>& count)
+{
+    return _mm512_sllv_epi64(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+/*  Tests the bits of the counts from the highest to the lowest and shifts the
+    elements whose count has the bit set by the respective power of two.
+*/
+template<class V> SIMDPP_INL
+V v_emul_shift_l_v16(const V& a, const V& count)
+{
+    using S = typename same_width<V>::i16;
+    S c = shift_l<12>(count);
+    V r = a;
+    r = blend(shift_l<8>(r), r, shift_r<15>(c));
+    c = shift_l<1>(c);
+    r = blend(shift_l<4>(r), r, shift_r<15>(c));
+    c = shift_l<1>(c);
+    r = blend(shift_l<2>(r), r, shift_r<15>(c));
+    c = shift_l<1>(c);
+    r = blend(shift_l<1>(r), r, shift_r<15>(c));
+    return r;
+}
+
+/*  The even and odd 16-bit elements are shifted separately as 32-bit
+    elements. Only the variable 32-bit shifts are needed.
+*/
+template<class V> SIMDPP_INL
+V v_shift_l_v16_as32(const V& a, const V& count)
+{
+    using U = typename same_width<V>::u32;
+    U a32 = bit_cast<U>(a), c32 = bit_cast<U>(count);
+    U mask = make_uint(0xffff);
+    U lo = i_shift_l(a32, bit_and(c32, mask));
+    U hi = i_shift_l(bit_andnot(a32, mask), shift_r<16>(c32));
+    U r = bit_or(bit_and(lo, mask), hi);
+    return bit_cast<V>(r);
+}
+
+static SIMDPP_INL
+uint16<8> i_shift_l(const uint16<8>& a, const uint16<8>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_l_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return v_shift_l_v16_as32(a, count);
+#elif SIMDPP_USE_SSE2
+    return v_emul_shift_l_v16(a, count);
+#elif SIMDPP_USE_NEON
+    return vshlq_u16(a.native(), vreinterpretq_s16_u16(count.native()));
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sl(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return (v8u16) __msa_sll_h((v8i16) a.native(), (v8i16) count.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_shift_l(const uint16<16>& a, const uint16<16>& count)
+{
+    return v_shift_l_v16_as32(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_shift_l(const uint16<32>& a, const uint16<32>& count)
+{
+    return _mm512_sllv_epi16(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_shift_l(const V& a, const V& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(V, i_shift_l, a, count);
+}
+
 // -----------------------------------------------------------------------------
 
 template<unsigned count, unsigned N> SIMDPP_INL
@@ -17,12 +17,20 @@
 #include <simdpp/core/bit_and.h>
 #include <simdpp/core/bit_andnot.h>
 #include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/make_uint.h>
 #include <simdpp/core/splat.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/shuffle2.h>
 #include <simdpp/detail/insn/i_shift.h>
+#include <simdpp/detail/traits.h>
+#include <simdpp/detail/width.h>
 #include <simdpp/detail/null/math.h>
+#include <type_traits>
 
 namespace simdpp {
 namespace SIMDPP_ARCH_NAMESPACE {
@@ -454,6 +462,318 @@ V i_shift_r(const V& a, unsigned count)
     SIMDPP_VEC_ARRAY_IMPL2S(V, i_shift_r, a, count);
 }
 
+// -----------------------------------------------------------------------------
+// Shifts each element by the count in the corresponding element of count
+
+/*  Shifts each 32-bit element separately. _mm_srl_epi32 and _mm_sra_epi32
+    take the count from the lower 64 bits of the count operand.
+*/
+#if SIMDPP_USE_SSE2
+template<class F> SIMDPP_INL
+__m128i sse_shift_r_v32(__m128i a, __m128i count, F shift)
+{
+    __m128i z = _mm_setzero_si128();
+    __m128i c01 = _mm_unpacklo_epi32(count, z);
+    __m128i c23 = _mm_unpackhi_epi32(count, z);
+    __m128 r0 = _mm_castsi128_ps(shift(a, c01));
+    __m128 r1 = _mm_castsi128_ps(shift(a, _mm_srli_si128(c01, 8)));
+    __m128 r2 = _mm_castsi128_ps(shift(a, c23));
+    __m128 r3 = _mm_castsi128_ps(shift(a, _mm_srli_si128(c23, 8)));
+    __m128 r01 = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(1,1,0,0));
+    __m128 r23 = _mm_shuffle_ps(r2, r3, _MM_SHUFFLE(3,3,2,2));
+    return _mm_castps_si128(_mm_shuffle_ps(r01, r23, _MM_SHUFFLE(2,0,2,0)));
+}
+#endif
+
+static SIMDPP_INL
+int32<4> i_shift_r(const int32<4>& a, const uint32<4>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return _mm_srav_epi32(a.native(), count.native());
+#elif SIMDPP_USE_SSE2
+    return sse_shift_r_v32(a.native(), count.native(),
+                           [](__m128i x, __m128i c) { return _mm_sra_epi32(x, c); });
+#elif SIMDPP_USE_NEON
+    int32<4> shift = vnegq_s32(vreinterpretq_s32_u32(count.native()));
+    return vshlq_s32(a.native(), shift.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sra(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return __msa_sra_w(a.native(), (v4i32) count.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int32<8> i_shift_r(const int32<8>& a, const uint32<8>& count)
+{
+    return _mm256_srav_epi32(a.native(), count.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_shift_r(const int32<16>& a, const uint32<16>& count)
+{
+    return _mm512_srav_epi32(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_shift_r(const uint32<4>& a, const uint32<4>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return _mm_srlv_epi32(a.native(), count.native());
+#elif SIMDPP_USE_SSE2
+    return sse_shift_r_v32(a.native(), count.native(),
+                           [](__m128i x, __m128i c) { return _mm_srl_epi32(x, c); });
+#elif SIMDPP_USE_NEON
+    int32<4> shift = vnegq_s32(vreinterpretq_s32_u32(count.native()));
+    return vshlq_u32(a.native(), shift.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sr(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return (v4u32) __msa_srl_w((v4i32) a.native(), (v4i32) count.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_shift_r(const uint32<8>& a, const uint32<8>& count)
+{
+    return _mm256_srlv_epi32(a.native(), count.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_shift_r(const uint32<16>& a, const uint32<16>& count)
+{
+    return _mm512_srlv_epi32(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_shift_r(const uint64<2>& a, const uint64<2>& count)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_srlv_epi64(a.native(), count.native());
+#elif SIMDPP_USE_SSE2
+    // _mm_srl_epi64 takes the count from the lower element
+    __m128i r0 = _mm_srl_epi64(a.native(), count.native());
+    __m128i r1 = _mm_srl_epi64(a.native(),
+                               _mm_unpackhi_epi64(count.native(), count.native()));
+#if SIMDPP_USE_SSE4_1
+    return _mm_blend_epi16(r0, r1, 0xf0);
+#else
+    return _mm_castpd_si128(_mm_move_sd(_mm_castsi128_pd(r1),
+                                        _mm_castsi128_pd(r0)));
+#endif
+#elif SIMDPP_USE_NEON
+    int64<2> shift = vsubq_s64(vdupq_n_s64(0),
+                               vreinterpretq_s64_u64(count.native()));
+    return vshlq_u64(a.native(), shift.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_sr(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_srl_d((v2i64) a.native(), (v2i64) count.native());
+#elif SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    return detail::null::shift_r_v(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_shift_r(const uint64<4>& a, const uint64<4>& count)
+{
+    return _mm256_srlv_epi64(a.native(), count.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_shift_r(const uint64<8>& a, const uint64<8>& count)
+{
+    return _mm512_srlv_epi64(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+// Shifts signed elements right by means of the logical shift
+template<class V, class C> SIMDPP_INL
+V v_emul_shift_r_v_signed(const V& a, const C& count)
+{
+    using U = typename detail::remove_sign<V>::type;
+    const unsigned B = sizeof(typename V::element_type) * 8;
+    U s = shift_r<B-1>(a);
+    U r = i_shift_r(U(bit_xor(a, s)), count);
+    return V(bit_xor(r, s));
+}
+
+static SIMDPP_INL
+int64<2> i_shift_r(const int64<2>& a, const uint64<2>& count)
+{
+#if SIMDPP_USE_NEON
+    int64<2> shift = vsubq_s64(vdupq_n_s64(0),
+                               vreinterpretq_s64_u64(count.native()));
+    return vshlq_s64(a.native(), shift.native());
+#elif SIMDPP_USE_VSX_207
+    return vec_sra(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return __msa_sra_d(a.native(), (v2i64) count.native());
+#elif SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    return detail::null::shift_r_v(a, count);
+#else
+    return v_emul_shift_r_v_signed(a, count);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int64<4> i_shift_r(const int64<4>& a, const uint64<4>& count)
+{
+    return v_emul_shift_r_v_signed(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int64<8> i_shift_r(const int64<8>& a, const uint64<8>& count)
+{
+    return _mm512_srav_epi64(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+/*  Tests the bits of the counts from the highest to the lowest and shifts the
+    elements whose count has the bit set by the respective power of two. The
+    shift is arithmetic for signed and logical for unsigned elements.
+*/
+template<class V, class C> SIMDPP_INL
+V v_emul_shift_r_v16(const V& a, const C& count)
+{
+    using S = typename same_width<V>::i16;
+    S c = shift_l<12>(count);
+    V r = a;
+    r = blend(shift_r<8>(r), r, shift_r<15>(c));
+    c = shift_l<1>(c);
+    r = blend(shift_r<4>(r), r, shift_r<15>(c));
+    c = shift_l<1>(c);
+    r = blend(shift_r<2>(r), r, shift_r<15>(c));
+    c = shift_l<1>(c);
+    r = blend(shift_r<1>(r), r, shift_r<15>(c));
+    return r;
+}
+
+/*  The even and odd 16-bit elements are shifted separately as 32-bit
+    elements. The elements at the lower half are moved to the upper half first
+    so that the sign bit is in place.
+*/
+template<class V, class C> SIMDPP_INL
+V v_shift_r_v16_as32(const V& a, const C& count)
+{
+    using U = typename same_width<V>::u32;
+    using W = typename std::conditional<std::is_signed<typename V::element_type>::value,
+                                        typename same_width<V>::i32, U>::type;
+    W a32 = bit_cast<W>(a);
+    U c32 = bit_cast<U>(count);
+    U mask = make_uint(0xffff);
+    U clo = add(bit_and(c32, mask), 16);
+    U chi = shift_r<16>(c32);
+    W lo = i_shift_r(W(shift_l<16>(a32)), clo);
+    W hi = i_shift_r(a32, chi);
+    W r = bit_or(bit_and(lo, mask), bit_andnot(hi, mask));
+    return bit_cast<V>(r);
+}
+
+static SIMDPP_INL
+int16<8> i_shift_r(const int16<8>& a, const uint16<8>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return v_shift_r_v16_as32(a, count);
+#elif SIMDPP_USE_SSE2
+    return v_emul_shift_r_v16(a, count);
+#elif SIMDPP_USE_NEON
+    int16<8> shift = vnegq_s16(vreinterpretq_s16_u16(count.native()));
+    return vshlq_s16(a.native(), shift.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sra(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return __msa_sra_h(a.native(), (v8i16) count.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int16<16> i_shift_r(const int16<16>& a, const uint16<16>& count)
+{
+    return v_shift_r_v16_as32(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int16<32> i_shift_r(const int16<32>& a, const uint16<32>& count)
+{
+    return _mm512_srav_epi16(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_shift_r(const uint16<8>& a, const uint16<8>& count)
+{
+#if SIMDPP_USE_NULL
+    return detail::null::shift_r_v(a, count);
+#elif SIMDPP_USE_AVX2
+    return v_shift_r_v16_as32(a, count);
+#elif SIMDPP_USE_SSE2
+    return v_emul_shift_r_v16(a, count);
+#elif SIMDPP_USE_NEON
+    int16<8> shift = vnegq_s16(vreinterpretq_s16_u16(count.native()));
+    return vshlq_u16(a.native(), shift.native());
+#elif SIMDPP_USE_ALTIVEC
+    return vec_sr(a.native(), count.native());
+#elif SIMDPP_USE_MSA
+    return (v8u16) __msa_srl_h((v8i16) a.native(), (v8i16) count.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_shift_r(const uint16<16>& a, const uint16<16>& count)
+{
+    return v_shift_r_v16_as32(a, count);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_shift_r(const uint16<32>& a, const uint16<32>& count)
+{
+    return _mm512_srlv_epi16(a.native(), count.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_shift_r(const V& a, const typename remove_sign<V>::type& count)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(V, i_shift_r, a, count);
+}
+
 
 // -----------------------------------------------------------------------------
 
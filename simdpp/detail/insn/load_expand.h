@@ -0,0 +1,226 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_EXPAND_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_EXPAND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/detail/insn/compress_lut.h>
+#include <simdpp/detail/insn/load_partial.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Loads a vector whose first n elements are used by the expansion. The
+    inactive lanes are cleared by the permutation, thus unlike in
+    i_load_partial_emul the elements past the first n are not masked out.
+    If there are no elements to load, a zero buffer is read instead, so that
+    the check of the page boundary is the only branch in the common case.
+*/
+template<class V> SIMDPP_INL
+void i_load_expand_first(V& a, const char* p, unsigned n)
+{
+    static const char zero[sizeof(V)] = {};
+    const char* src = i_compress_select_ptr(n != 0, p, zero);
+    if ((reinterpret_cast<uintptr_t>(src) & 4095) <= 4096 - sizeof(V))
+        a = load_u(src);
+    else
+        i_load_partial_emul(a, p, n);
+}
+
+/*  Loads consecutive elements into the active lanes of a 128-bit vector of
+    S-byte elements. Returns the number of loaded elements. If Full is true,
+    the whole vector is loaded, thus up to 16 bytes past the loaded elements
+    may be read. Otherwise the memory past the loaded elements is read only
+    if it's within the same page as in i_load_partial_emul.
+*/
+template<unsigned S, bool Full> SIMDPP_INL
+unsigned i_load_expand_bytes(uint8<16>& r, const char* p, uint64_t bits)
+{
+    const unsigned lanes = 16 / S;
+    bits &= (1u << lanes) - 1;
+#if SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    // Each element is read unconditionally, the inactive ones from a zero
+    // buffer
+    static const char zero[S] = {};
+    mem_block<uint8<16>> mr;
+    unsigned n = 0;
+    for (unsigned i = 0; i < lanes; ++i) {
+        unsigned active = (bits >> i) & 1;
+        std::memcpy(&mr[i*S], i_compress_select_ptr(active, p + n*S, zero), S);
+        n += active;
+    }
+    r = mr;
+    return n;
+#else
+    unsigned n = i_compress_popcnt_lanes<lanes>(bits);
+    uint8<16> a;
+    if (Full) {
+        a = load_u(p);
+    } else {
+        i_load_expand_first(a, p, n*S);
+    }
+    uint8<16> idx = i_compress_lut_idx<S>(true, bits);
+    r = permute_zbytes16(a, idx);
+    return n;
+#endif
+}
+
+template<unsigned S, bool Full, unsigned N> SIMDPP_INL
+unsigned i_load_expand_bytes(uint8<N>& r, const char* p, uint64_t bits)
+{
+    uint8<N/2> lo, hi;
+    unsigned n = i_load_expand_bytes<S, Full>(lo, p, bits);
+    n += i_load_expand_bytes<S, Full>(hi, p + n*S, bits >> (N/2/S));
+    r = combine(lo, hi);
+    return n;
+}
+
+// -----------------------------------------------------------------------------
+
+template<bool Full, class V> SIMDPP_INL
+unsigned i_load_expand_native(V& r, const char* p, uint64_t bits)
+{
+    const unsigned S = sizeof(typename V::element_type);
+    using B = uint8<V::length * S>;
+    B b;
+    unsigned n = i_load_expand_bytes<S, Full>(b, p, bits);
+    r = bit_cast<V>(b);
+    return n;
+}
+
+/*  AVX512F provides expand instructions only for 512-bit vectors of 32-bit
+    and 64-bit elements. The upper lanes of the smaller vectors are disabled
+    by the mask, thus the memory corresponding to them is not accessed. The
+    expanding loads don't access the memory past the loaded elements and are
+    not slower than a load followed by an expansion within a register, thus
+    they are used for both variants.
+*/
+#if SIMDPP_USE_AVX512F
+template<bool Full> SIMDPP_INL
+unsigned i_load_expand_native(uint32<4>& r, const char* p, uint64_t bits)
+{
+    __mmask16 k = bits & 0xf;
+    r = _mm512_castsi512_si128(_mm512_maskz_expandloadu_epi32(k, p));
+    return i_compress_popcnt_lanes<4>(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_load_expand_native(uint32<8>& r, const char* p, uint64_t bits)
+{
+    __mmask16 k = bits & 0xff;
+    r = _mm512_castsi512_si256(_mm512_maskz_expandloadu_epi32(k, p));
+    return i_compress_popcnt_lanes<8>(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_load_expand_native(uint32<16>& r, const char* p, uint64_t bits)
+{
+    __mmask16 k = bits;
+    r = _mm512_maskz_expandloadu_epi32(k, p);
+    return i_compress_popcnt(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_load_expand_native(uint64<2>& r, const char* p, uint64_t bits)
+{
+    __mmask8 k = bits & 0x3;
+    r = _mm512_castsi512_si128(_mm512_maskz_expandloadu_epi64(k, p));
+    return i_compress_popcnt_lanes<4>(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_load_expand_native(uint64<4>& r, const char* p, uint64_t bits)
+{
+    __mmask8 k = bits & 0xf;
+    r = _mm512_castsi512_si256(_mm512_maskz_expandloadu_epi64(k, p));
+    return i_compress_popcnt_lanes<4>(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_load_expand_native(uint64<8>& r, const char* p, uint64_t bits)
+{
+    __mmask8 k = bits;
+    r = _mm512_maskz_expandloadu_epi64(k, p);
+    return i_compress_popcnt_lanes<8>(k);
+}
+#elif SIMDPP_USE_AVX2
+/*  On AVX2 256-bit vectors of 32-bit and 64-bit elements are expanded across
+    the whole vector by a single 32-bit element permutation. The unused
+    positions of the lookup table rows are 0x80, thus they become negative
+    when sign-extended and are used to clear the inactive lanes.
+*/
+template<bool Full> SIMDPP_INL
+unsigned i_load_expand_native(uint32<8>& r, const char* p, uint64_t bits)
+{
+    bits &= 0xff;
+    unsigned n = i_compress_popcnt_lanes<8>(bits);
+    uint32<8> a;
+    if (Full)
+        a = load_u(p);
+    else
+        i_load_expand_first(a, p, n);
+    const uint8_t* row = i_get_compress_lut().expand32x8[bits];
+    __m256i idx = _mm256_cvtepi8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row)));
+    __m256i v = _mm256_permutevar8x32_epi32(a.native(), idx);
+    r = _mm256_andnot_si256(_mm256_srai_epi32(idx, 31), v);
+    return n;
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_load_expand_native(uint64<4>& r, const char* p, uint64_t bits)
+{
+    bits &= 0xf;
+    unsigned n = i_compress_popcnt_lanes<4>(bits);
+    uint64<4> a;
+    if (Full)
+        a = load_u(p);
+    else
+        i_load_expand_first(a, p, n);
+    const uint8_t* row = i_get_compress_lut().expand64x4[bits];
+    __m256i idx = _mm256_cvtepi8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row)));
+    __m256i v = _mm256_permutevar8x32_epi32(a.native(), idx);
+    r = _mm256_andnot_si256(_mm256_srai_epi32(idx, 31), v);
+    return n;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, bool Full, class M> SIMDPP_INL
+V i_load_expand(const char* p, const M& mask)
+{
+    const unsigned S = sizeof(typename V::element_type);
+    V r;
+    unsigned n = 0;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        uint64_t bits = i_compress_lane_bits(mask.vec(i));
+        n += i_load_expand_native<Full>(r.vec(i), p + n*S, bits);
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,213 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_MASKED_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/test_bits.h>
+#include <simdpp/detail/null/memory.h>
+#include <simdpp/detail/align.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  On architectures without masked loads the whole vector is loaded if at
+    least one lane is active. Since the pointer is aligned to the vector size,
+    the vector does not cross a page boundary, thus the load does not fault
+    if the active element is readable.
+*/
+template<class V, class M> SIMDPP_INL
+V i_load_masked_aligned(const char* p, const M& mask)
+{
+    V r;
+    if (!test_bits_any(mask.unmask())) {
+        r = make_zero();
+        return r;
+    }
+    r = load(p);
+    return bit_and(r, mask);
+}
+
+static SIMDPP_INL
+uint32<4> i_load_masked(const char* p, const mask_int32<4>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    null::load_masked(r, p, mask);
+    return r;
+#elif SIMDPP_USE_AVX2
+    return _mm_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#elif SIMDPP_USE_AVX
+    return _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(p),
+                                            mask.native()));
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return i_load_masked_aligned<uint32<4>>(p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_load_masked(const char* p, const mask_int32<8>& mask)
+{
+    return _mm256_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_load_masked(const char* p, const mask_int32<16>& mask)
+{
+    return _mm512_maskz_load_epi32(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_load_masked(const char* p, const mask_int64<2>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    return _mm_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    return _mm_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+#elif SIMDPP_USE_AVX
+    return _mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double*>(p),
+                                            mask.native()));
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+    return i_load_masked_aligned<uint64<2>>(p, mask);
+#elif SIMDPP_USE_NULL || SIMDPP_USE_ALTIVEC
+    uint64<2> r;
+    null::load_masked(r, p, mask);
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_load_masked(const char* p, const mask_int64<4>& mask)
+{
+#if __INTEL_COMPILER
+    return _mm256_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    return _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_load_masked(const char* p, const mask_int64<8>& mask)
+{
+    return _mm512_maskz_load_epi64(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32<4> i_load_masked(const char* p, const mask_float32<4>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_NULL
+    float32<4> r;
+    null::load_masked(r, p, mask);
+    return r;
+#elif SIMDPP_USE_AVX
+    return _mm_maskload_ps(reinterpret_cast<const float*>(p),
+                           _mm_castps_si128(mask.native()));
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return i_load_masked_aligned<float32<4>>(p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32<8> i_load_masked(const char* p, const mask_float32<8>& mask)
+{
+    return _mm256_maskload_ps(reinterpret_cast<const float*>(p),
+                              _mm256_castps_si256(mask.native()));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_load_masked(const char* p, const mask_float32<16>& mask)
+{
+    return _mm512_maskz_load_ps(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64<2> i_load_masked(const char* p, const mask_float64<2>& mask)
+{
+    p = detail::assume_aligned(p, 16);
+#if SIMDPP_USE_AVX
+    return _mm_maskload_pd(reinterpret_cast<const double*>(p),
+                           _mm_castpd_si128(mask.native()));
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON64 || SIMDPP_USE_VSX_206 || SIMDPP_USE_MSA
+    return i_load_masked_aligned<float64<2>>(p, mask);
+#elif SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    float64<2> r;
+    null::load_masked(r, p, mask);
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64<4> i_load_masked(const char* p, const mask_float64<4>& mask)
+{
+    return _mm256_maskload_pd(reinterpret_cast<const double*>(p),
+                              _mm256_castpd_si256(mask.native()));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_load_masked(const char* p, const mask_float64<8>& mask)
+{
+    return _mm512_maskz_load_pd(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class M> SIMDPP_INL
+V i_load_masked(const char* p, const M& mask)
+{
+    unsigned veclen = sizeof(typename V::base_vector_type);
+
+    V r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_masked(p, mask.vec(i));
+        p += veclen;
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
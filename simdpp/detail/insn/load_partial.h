@@ -0,0 +1,227 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_PARTIAL_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_PARTIAL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/mem_block.h>
+#include <simdpp/detail/null/memory.h>
+#include <simdpp/detail/traits.h>
+#include <cstdint>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Returns a pointer to 64 0xff bytes followed by 64 zero bytes. Loading from
+    the returned pointer plus 64 - n gives a mask that selects the first n
+    bytes of a vector.
+*/
+SIMDPP_INL const uint8_t* i_partial_mask_data()
+{
+    static const uint8_t mask_d[128] = {
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+    };
+    return mask_d;
+}
+
+/*  A vector load does not fault if it does not cross a page boundary and at
+    least one of the loaded bytes is readable. Thus if the first element is
+    valid and the vector fits into the remainder of the page, the whole vector
+    is loaded and the unneeded elements are cleared. Otherwise the elements
+    are copied one by one. 4 KiB is the smallest page size on all supported
+    architectures.
+*/
+template<class V> SIMDPP_INL
+void i_load_partial_emul(V& a, const char* p, unsigned n)
+{
+#if SIMDPP_USE_NULL
+    null::load_first(a, p, n);
+#else
+    const unsigned S = sizeof(typename V::element_type);
+    if (n >= V::length) {
+        a = load_u(p);
+        return;
+    }
+    if (n == 0) {
+        a = make_zero();
+        return;
+    }
+    if ((reinterpret_cast<uintptr_t>(p) & 4095) <= 4096 - sizeof(V)) {
+        V r = load_u(p);
+        V m = load_u(i_partial_mask_data() + 64 - n*S);
+        a = bit_and(r, m);
+    } else {
+        mem_block<V> r;
+        r = (V) make_zero();
+        std::memcpy(&r[0], p, n*S);
+        a = r;
+    }
+#endif
+}
+
+template<class V> SIMDPP_INL
+void i_load_partial_native(V& a, const char* p, unsigned n)
+{
+    i_load_partial_emul(a, p, n);
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_partial_native(uint32<4>& a, const char* p, unsigned n)
+{
+    if (n >= 4) {
+        a = load_u(p);
+        return;
+    }
+    uint32<4> m = load_u(i_partial_mask_data() + 64 - n*4);
+#if SIMDPP_USE_AVX2
+    a = _mm_maskload_epi32(reinterpret_cast<const int*>(p), m.native());
+#else
+    a = _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(p),
+                                         m.native()));
+#endif
+}
+
+static SIMDPP_INL
+void i_load_partial_native(uint64<2>& a, const char* p, unsigned n)
+{
+    if (n >= 2) {
+        a = load_u(p);
+        return;
+    }
+    uint64<2> m = load_u(i_partial_mask_data() + 64 - n*8);
+    a = _mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double*>(p),
+                                         m.native()));
+}
+#endif
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_partial_native(uint32<8>& a, const char* p, unsigned n)
+{
+    if (n >= 8) {
+        a = load_u(p);
+        return;
+    }
+    uint32<8> m = load_u(i_partial_mask_data() + 64 - n*4);
+    a = _mm256_maskload_epi32(reinterpret_cast<const int*>(p), m.native());
+}
+
+static SIMDPP_INL
+void i_load_partial_native(uint64<4>& a, const char* p, unsigned n)
+{
+    if (n >= 4) {
+        a = load_u(p);
+        return;
+    }
+    uint64<4> m = load_u(i_partial_mask_data() + 64 - n*8);
+#if __INTEL_COMPILER
+    a = _mm256_maskload_epi64(reinterpret_cast<const __int64*>(p), m.native());
+#else
+    a = _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), m.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_partial_native(uint32<16>& a, const char* p, unsigned n)
+{
+    __mmask16 k = n >= 16 ? 0xffff : (1u << n) - 1;
+    a = _mm512_maskz_loadu_epi32(k, p);
+}
+
+static SIMDPP_INL
+void i_load_partial_native(uint64<8>& a, const char* p, unsigned n)
+{
+    __mmask8 k = n >= 8 ? 0xff : (1u << n) - 1;
+    a = _mm512_maskz_loadu_epi64(k, p);
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_load_partial_native(uint8<64>& a, const char* p, unsigned n)
+{
+    __mmask64 k = n >= 64 ? ~__mmask64(0) : (__mmask64(1) << n) - 1;
+    a = _mm512_maskz_loadu_epi8(k, p);
+}
+
+SIMDPP_INL void i_load_partial_native(uint16<32>& a, const char* p, unsigned n)
+{
+    __mmask32 k = n >= 32 ? 0xffffffff : (1u << n) - 1;
+    a = _mm512_maskz_loadu_epi16(k, p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+void i_load_partial(V& a, const char* p, unsigned n)
+{
+    const unsigned veclen = V::base_vector_type::length;
+    const unsigned S = sizeof(typename V::element_type);
+
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        unsigned vn = n > i*veclen ? n - i*veclen : 0;
+        i_load_partial_native(a.vec(i), p + i*veclen*S, vn);
+    }
+}
+
+template<unsigned N> SIMDPP_INL
+void i_load_partial(float32<N>& a, const char* p, unsigned n)
+{
+    uint32<N> r;
+    i_load_partial(r, p, n);
+    a = bit_cast<float32<N>>(r);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_load_partial(float64<N>& a, const char* p, unsigned n)
+{
+    uint64<N> r;
+    i_load_partial(r, p, n);
+    a = bit_cast<float64<N>>(r);
+}
+
+template<class V> SIMDPP_INL
+V i_load_partial_any(const char* p, unsigned n)
+{
+    typename detail::remove_sign<V>::type r;
+    i_load_partial(r, p, n);
+    return V(r);
+}
+
+} // namespace insn
+
+template<class V> SIMDPP_INL
+void construct_eval(V& v, const expr_vec_load_partial& e)
+{
+    v = insn::i_load_partial_any<V>(e.a, e.n);
+}
+
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
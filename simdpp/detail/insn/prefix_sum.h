@@ -0,0 +1,119 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_PREFIX_SUM_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_PREFIX_SUM_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/move_r.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/core/split.h>
+#include <type_traits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Moves the elements within each 128-bit lane by K positions towards the end
+template<unsigned K, unsigned N> SIMDPP_INL
+uint8<N> i_prefix_sum_move(const uint8<N>& a) { return move16_r<K>(a); }
+template<unsigned K, unsigned N> SIMDPP_INL
+uint16<N> i_prefix_sum_move(const uint16<N>& a) { return move8_r<K>(a); }
+template<unsigned K, unsigned N> SIMDPP_INL
+uint32<N> i_prefix_sum_move(const uint32<N>& a) { return move4_r<K>(a); }
+template<unsigned K, unsigned N> SIMDPP_INL
+uint64<N> i_prefix_sum_move(const uint64<N>& a) { return move2_r<K>(a); }
+template<unsigned K, unsigned N> SIMDPP_INL
+float32<N> i_prefix_sum_move(const float32<N>& a) { return move4_r<K>(a); }
+template<unsigned K, unsigned N> SIMDPP_INL
+float64<N> i_prefix_sum_move(const float64<N>& a) { return move2_r<K>(a); }
+
+/*  Computes the prefix sum within each 128-bit lane in log2(L) steps, where L
+    is the number of elements in a lane. After the step that moves the
+    elements by K positions each element contains the sum of the 2*K
+    preceding elements including itself.
+*/
+template<unsigned K, unsigned L>
+struct i_prefix_sum_lanes {
+    template<class V> static SIMDPP_INL
+    V run(const V& a)
+    {
+        V r = add(a, i_prefix_sum_move<K>(a));
+        return i_prefix_sum_lanes<K*2, L>::run(r);
+    }
+};
+
+template<unsigned L>
+struct i_prefix_sum_lanes<L, L> {
+    template<class V> static SIMDPP_INL
+    V run(const V& a) { return a; }
+};
+
+/*  Propagates the sums of the lower 128-bit lanes into the higher lanes of a
+    native vector.
+*/
+template<class V> SIMDPP_INL
+V i_prefix_sum_carry_lanes(const V& a, std::integral_constant<unsigned, 16>)
+{
+    return a;
+}
+
+template<template<unsigned, class> class T, unsigned N> SIMDPP_INL
+T<N,void> i_prefix_sum_carry_lanes(const T<N,void>& a,
+                                   std::integral_constant<unsigned, 32>)
+{
+    T<N/2,void> lo, hi;
+    split(a, lo, hi);
+    hi = add(hi, splat<N/2-1>(lo));
+    return combine(lo, hi);
+}
+
+template<template<unsigned, class> class T, unsigned N> SIMDPP_INL
+T<N,void> i_prefix_sum_carry_lanes(const T<N,void>& a,
+                                   std::integral_constant<unsigned, 64>)
+{
+    T<N/2,void> lo, hi;
+    split(a, lo, hi);
+    lo = i_prefix_sum_carry_lanes(lo, std::integral_constant<unsigned, 32>());
+    hi = i_prefix_sum_carry_lanes(hi, std::integral_constant<unsigned, 32>());
+    hi = add(hi, splat<N/2-1>(lo));
+    return combine(lo, hi);
+}
+
+template<class V> SIMDPP_INL
+V i_prefix_sum(const V& a)
+{
+    using B = typename V::base_vector_type;
+    const unsigned lane_length = 16 / sizeof(typename V::element_type);
+    const unsigned native_size = sizeof(B);
+
+    V r;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        B v = i_prefix_sum_lanes<1, lane_length>::run(a.vec(i));
+        v = i_prefix_sum_carry_lanes(v, std::integral_constant<unsigned, native_size>());
+        if (i > 0) {
+            v = add(v, splat<B::length-1>(r.vec(i-1)));
+        }
+        r.vec(i) = v;
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,224 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstddef>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Emulates scatter by storing each element separately. The elements are
+    stored in the order of increasing lane index, thus if several lanes refer
+    to the same location, the value from the last of them is stored. This
+    matches the behavior of the native AVX-512 instructions.
+*/
+template<class V, class I> SIMDPP_INL
+void i_emul_scatter(char* p, const I& idx, const V& a)
+{
+    using T = typename V::element_type;
+    static_assert(V::length == I::length, "Vector lengths must match");
+    mem_block<I> mi(idx);
+    mem_block<V> ma(a);
+    for (unsigned i = 0; i < V::length; i++) {
+        std::memcpy(p + std::size_t(mi[i]) * sizeof(T), &ma[i], sizeof(T));
+    }
+}
+
+template<class V, class I, class M> SIMDPP_INL
+void i_emul_scatter_masked(char* p, const I& idx, const V& a, const M& mask)
+{
+    using T = typename V::element_type;
+    static_assert(V::length == I::length, "Vector lengths must match");
+    mem_block<I> mi(idx);
+    mem_block<V> ma(a);
+    mem_block<V> mm(mask.unmask());
+    for (unsigned i = 0; i < V::length; i++) {
+        if (mm[i] != 0) {
+            std::memcpy(p + std::size_t(mi[i]) * sizeof(T), &ma[i], sizeof(T));
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+/*  AVX512F has no scatter instructions for 128-bit and 256-bit vectors (they
+    come only with AVX512VL). We extend the vectors to 512 bits and disable the
+    upper lanes via the mask.
+*/
+static SIMDPP_INL
+void i_scatter(char* p, const uint32<4>& idx, const uint32<4>& a)
+{
+#if SIMDPP_USE_AVX512F
+    _mm512_mask_i32scatter_epi32(p, 0x000f, _mm512_castsi128_si512(idx.native()),
+                                 _mm512_castsi128_si512(a.native()), 4);
+#else
+    i_emul_scatter(p, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter(char* p, const uint32<8>& idx, const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512F
+    _mm512_mask_i32scatter_epi32(p, 0x00ff, _mm512_castsi256_si512(idx.native()),
+                                 _mm512_castsi256_si512(a.native()), 4);
+#else
+    i_emul_scatter(p, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* p, const uint32<16>& idx, const uint32<16>& a)
+{
+    _mm512_i32scatter_epi32(p, idx.native(), a.native(), 4);
+}
+#endif
+
+static SIMDPP_INL
+void i_scatter(char* p, const uint64<2>& idx, const uint64<2>& a)
+{
+#if SIMDPP_USE_AVX512F
+    _mm512_mask_i64scatter_epi64(p, 0x03, _mm512_castsi128_si512(idx.native()),
+                                 _mm512_castsi128_si512(a.native()), 8);
+#else
+    i_emul_scatter(p, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter(char* p, const uint64<4>& idx, const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512F
+    _mm512_mask_i64scatter_epi64(p, 0x0f, _mm512_castsi256_si512(idx.native()),
+                                 _mm512_castsi256_si512(a.native()), 8);
+#else
+    i_emul_scatter(p, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter(char* p, const uint64<8>& idx, const uint64<8>& a)
+{
+    _mm512_i64scatter_epi64(p, idx.native(), a.native(), 8);
+}
+#endif
+
+template<class V> SIMDPP_INL
+void i_scatter(char* p, const V& idx, const V& a)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter(p, idx.vec(i), a.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_scatter_masked(char* p, const uint32<4>& idx, const uint32<4>& a,
+                      const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_AVX512F
+    __mmask16 k = _mm_movemask_ps(_mm_castsi128_ps(mask.native()));
+    _mm512_mask_i32scatter_epi32(p, k, _mm512_castsi128_si512(idx.native()),
+                                 _mm512_castsi128_si512(a.native()), 4);
+#else
+    i_emul_scatter_masked(p, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter_masked(char* p, const uint32<8>& idx, const uint32<8>& a,
+                      const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512F
+    __mmask16 k = _mm256_movemask_ps(_mm256_castsi256_ps(mask.native()));
+    _mm512_mask_i32scatter_epi32(p, k, _mm512_castsi256_si512(idx.native()),
+                                 _mm512_castsi256_si512(a.native()), 4);
+#else
+    i_emul_scatter_masked(p, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* p, const uint32<16>& idx, const uint32<16>& a,
+                      const mask_int32<16>& mask)
+{
+    _mm512_mask_i32scatter_epi32(p, mask.native(), idx.native(), a.native(), 4);
+}
+#endif
+
+static SIMDPP_INL
+void i_scatter_masked(char* p, const uint64<2>& idx, const uint64<2>& a,
+                      const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_AVX512F
+    __mmask8 k = _mm_movemask_pd(_mm_castsi128_pd(mask.native()));
+    _mm512_mask_i64scatter_epi64(p, k, _mm512_castsi128_si512(idx.native()),
+                                 _mm512_castsi128_si512(a.native()), 8);
+#else
+    i_emul_scatter_masked(p, idx, a, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_scatter_masked(char* p, const uint64<4>& idx, const uint64<4>& a,
+                      const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512F
+    __mmask8 k = _mm256_movemask_pd(_mm256_castsi256_pd(mask.native()));
+    _mm512_mask_i64scatter_epi64(p, k, _mm512_castsi256_si512(idx.native()),
+                                 _mm512_castsi256_si512(a.native()), 8);
+#else
+    i_emul_scatter_masked(p, idx, a, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_scatter_masked(char* p, const uint64<8>& idx, const uint64<8>& a,
+                      const mask_int64<8>& mask)
+{
+    _mm512_mask_i64scatter_epi64(p, mask.native(), idx.native(), a.native(), 8);
+}
+#endif
+
+template<class V, class M> SIMDPP_INL
+void i_scatter_masked(char* p, const V& idx, const V& a, const M& mask)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_scatter_masked(p, idx.vec(i), a.vec(i), mask.vec(i));
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,322 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_SORT_NETWORK_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_SORT_NETWORK_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/permute2.h>
+#include <simdpp/core/permute4.h>
+#include <simdpp/core/shuffle2x2.h>
+#include <simdpp/core/shuffle4x2.h>
+#include <simdpp/core/transpose.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The networks operate on each 128-bit lane independently. The elements
+    within a lane are sorted by bitonic sorting networks, the elements in the
+    same lane of different vectors are sorted by comparing whole vectors.
+*/
+
+// Puts the elementwise minimum into a and the maximum into b
+template<class V> SIMDPP_INL
+void i_sort_net_minmax(V& a, V& b)
+{
+    V lo = min(a, b);
+    b = max(a, b);
+    a = lo;
+}
+
+// Reverses the order of the elements within each 128-bit lane
+template<unsigned N, class V> SIMDPP_INL
+V i_sort_net_reverse(const any_vec32<N,V>& a)
+{
+    return permute4<3,2,1,0>(a.wrapped());
+}
+
+template<unsigned N, class V> SIMDPP_INL
+V i_sort_net_reverse(const any_vec64<N,V>& a)
+{
+    return permute2<1,0>(a.wrapped());
+}
+
+// Sorts the elements within each 128-bit lane, given that they form a bitonic
+// sequence
+template<unsigned N, class V> SIMDPP_INL
+V i_sort_net_clean(const any_vec32<N,V>& a)
+{
+    V x = a.wrapped();
+    V p = permute4<2,3,0,1>(x);
+    x = shuffle4x2<0,1,6,7>(V(min(x, p)), V(max(x, p)));
+    p = permute4<1,0,3,2>(x);
+    return shuffle4x2<0,5,2,7>(V(min(x, p)), V(max(x, p)));
+}
+
+template<unsigned N, class V> SIMDPP_INL
+V i_sort_net_clean(const any_vec64<N,V>& a)
+{
+    V x = a.wrapped();
+    V p = permute2<1,0>(x);
+    return shuffle2x2<0,3>(V(min(x, p)), V(max(x, p)));
+}
+
+// Sorts the elements within each 128-bit lane
+template<unsigned N, class V> SIMDPP_INL
+V i_sort_net_sort(const any_vec32<N,V>& a)
+{
+    // sort the pairs in alternating order to form a bitonic sequence
+    V x = a.wrapped();
+    V p = permute4<1,0,3,2>(x);
+    x = shuffle4x2<0,5,6,3>(V(min(x, p)), V(max(x, p)));
+    return i_sort_net_clean(x);
+}
+
+template<unsigned N, class V> SIMDPP_INL
+V i_sort_net_sort(const any_vec64<N,V>& a)
+{
+    return i_sort_net_clean(a.wrapped());
+}
+
+// Merges the sorted lanes of a and b. The lower half of the elements is
+// stored to a and the higher half to b.
+template<class V> SIMDPP_INL
+void i_sort_net_merge2(V& a, V& b)
+{
+    b = i_sort_net_reverse(b);
+    i_sort_net_minmax(a, b);
+    a = i_sort_net_clean(a);
+    b = i_sort_net_clean(b);
+}
+
+// Merges the sorted sequences formed by the lanes of a0, a1 and a2, a3.
+template<class V> SIMDPP_INL
+void i_sort_net_merge4(V& a0, V& a1, V& a2, V& a3)
+{
+    V r2 = i_sort_net_reverse(a3);
+    V r3 = i_sort_net_reverse(a2);
+    i_sort_net_minmax(a0, r2);
+    i_sort_net_minmax(a1, r3);
+    i_sort_net_minmax(a0, a1);
+    i_sort_net_minmax(r2, r3);
+    a0 = i_sort_net_clean(a0);
+    a1 = i_sort_net_clean(a1);
+    a2 = i_sort_net_clean(r2);
+    a3 = i_sort_net_clean(r3);
+}
+
+// Merges the sorted sequence formed by the lanes of a0, a1 with the sorted
+// lanes of a2. This is i_sort_net_merge4 with a3 consisting of elements larger
+// than all other elements, with the comparisons that involve a3 omitted.
+template<class V> SIMDPP_INL
+void i_sort_net_merge3(V& a0, V& a1, V& a2)
+{
+    V r = i_sort_net_reverse(a2);
+    i_sort_net_minmax(a1, r);
+    i_sort_net_minmax(a0, a1);
+    a0 = i_sort_net_clean(a0);
+    a1 = i_sort_net_clean(a1);
+    a2 = i_sort_net_clean(r);
+}
+
+template<class V> SIMDPP_INL
+void i_sort_network(V& a)
+{
+    a = i_sort_net_sort(a);
+}
+
+template<class V> SIMDPP_INL
+void i_sort_network(V& a0, V& a1)
+{
+    a0 = i_sort_net_sort(a0);
+    a1 = i_sort_net_sort(a1);
+    i_sort_net_merge2(a0, a1);
+}
+
+// Sorts the columns formed by the elements of the vectors and then the rows
+// of the transposed lanes. Only 32-bit elements fill whole 4x4 matrices.
+template<unsigned N, class V> SIMDPP_INL
+void i_sort_net_sort4(any_vec32<N,V>& ca0, any_vec32<N,V>& ca1,
+                      any_vec32<N,V>& ca2, any_vec32<N,V>& ca3)
+{
+    V& a0 = ca0.wrapped(); V& a1 = ca1.wrapped();
+    V& a2 = ca2.wrapped(); V& a3 = ca3.wrapped();
+    i_sort_net_minmax(a0, a1);
+    i_sort_net_minmax(a2, a3);
+    i_sort_net_minmax(a0, a2);
+    i_sort_net_minmax(a1, a3);
+    i_sort_net_minmax(a1, a2);
+    transpose4(a0, a1, a2, a3);
+}
+
+template<unsigned N, class V> SIMDPP_INL
+void i_sort_net_sort4(any_vec64<N,V>& ca0, any_vec64<N,V>& ca1,
+                      any_vec64<N,V>& ca2, any_vec64<N,V>& ca3)
+{
+    V& a0 = ca0.wrapped(); V& a1 = ca1.wrapped();
+    V& a2 = ca2.wrapped(); V& a3 = ca3.wrapped();
+    i_sort_net_minmax(a0, a1);
+    i_sort_net_minmax(a2, a3);
+    transpose2(a0, a1);
+    transpose2(a2, a3);
+}
+
+template<class V> SIMDPP_INL
+void i_sort_network(V& a0, V& a1, V& a2)
+{
+    i_sort_network(a0, a1);
+    a2 = i_sort_net_sort(a2);
+    i_sort_net_merge3(a0, a1, a2);
+}
+
+template<class V> SIMDPP_INL
+void i_sort_network(V& a0, V& a1, V& a2, V& a3)
+{
+    i_sort_net_sort4(a0, a1, a2, a3);
+    i_sort_net_merge2(a0, a1);
+    i_sort_net_merge2(a2, a3);
+    i_sort_net_merge4(a0, a1, a2, a3);
+}
+
+/*  The key/value networks perform the same operations on 32-bit keys as the
+    networks above and move the 32-bit values in the same way. The values are
+    selected by comparing the keys, such that an element never changes places
+    with another element with an equal key. Thus no value is duplicated or
+    lost.
+*/
+
+// Puts the elementwise minimum of the keys into ka and the maximum into kb
+template<unsigned N> SIMDPP_INL
+void i_sort_net_kv_minmax(int32<N>& ka, uint32<N>& va,
+                          int32<N>& kb, uint32<N>& vb)
+{
+    mask_int32<N> swap = cmp_gt(ka, kb);
+    int32<N> klo = min(ka, kb);
+    kb = max(ka, kb);
+    ka = klo;
+    uint32<N> vlo = blend(vb, va, swap);
+    vb = blend(va, vb, swap);
+    va = vlo;
+}
+
+// Computes the minimum and maximum of the keys in k and kp, where kp is a
+// permutation of k that pairs the elements compared with each other
+template<unsigned N> SIMDPP_INL
+void i_sort_net_kv_pair(const int32<N>& k, const uint32<N>& v,
+                        const int32<N>& kp, const uint32<N>& vp,
+                        int32<N>& kmin, uint32<N>& vmin,
+                        int32<N>& kmax, uint32<N>& vmax)
+{
+    kmin = min(k, kp);
+    kmax = max(k, kp);
+    vmin = blend(vp, v, cmp_gt(k, kp));
+    vmax = blend(vp, v, cmp_lt(k, kp));
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sort_net_kv_reverse(int32<N>& k, uint32<N>& v)
+{
+    k = permute4<3,2,1,0>(k);
+    v = permute4<3,2,1,0>(v);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sort_net_kv_clean(int32<N>& k, uint32<N>& v)
+{
+    int32<N> kmin, kmax;
+    uint32<N> vmin, vmax;
+    i_sort_net_kv_pair(k, v, int32<N>(permute4<2,3,0,1>(k)),
+                       uint32<N>(permute4<2,3,0,1>(v)), kmin, vmin, kmax, vmax);
+    k = shuffle4x2<0,1,6,7>(kmin, kmax);
+    v = shuffle4x2<0,1,6,7>(vmin, vmax);
+    i_sort_net_kv_pair(k, v, int32<N>(permute4<1,0,3,2>(k)),
+                       uint32<N>(permute4<1,0,3,2>(v)), kmin, vmin, kmax, vmax);
+    k = shuffle4x2<0,5,2,7>(kmin, kmax);
+    v = shuffle4x2<0,5,2,7>(vmin, vmax);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sort_net_kv_sort(int32<N>& k, uint32<N>& v)
+{
+    int32<N> kmin, kmax;
+    uint32<N> vmin, vmax;
+    i_sort_net_kv_pair(k, v, int32<N>(permute4<1,0,3,2>(k)),
+                       uint32<N>(permute4<1,0,3,2>(v)), kmin, vmin, kmax, vmax);
+    k = shuffle4x2<0,5,6,3>(kmin, kmax);
+    v = shuffle4x2<0,5,6,3>(vmin, vmax);
+    i_sort_net_kv_clean(k, v);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sort_net_kv_merge2(int32<N>& k0, uint32<N>& v0,
+                          int32<N>& k1, uint32<N>& v1)
+{
+    i_sort_net_kv_reverse(k1, v1);
+    i_sort_net_kv_minmax(k0, v0, k1, v1);
+    i_sort_net_kv_clean(k0, v0);
+    i_sort_net_kv_clean(k1, v1);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sort_net_kv_merge4(int32<N>& k0, uint32<N>& v0,
+                          int32<N>& k1, uint32<N>& v1,
+                          int32<N>& k2, uint32<N>& v2,
+                          int32<N>& k3, uint32<N>& v3)
+{
+    int32<N> r2 = k3, r3 = k2;
+    uint32<N> s2 = v3, s3 = v2;
+    i_sort_net_kv_reverse(r2, s2);
+    i_sort_net_kv_reverse(r3, s3);
+    i_sort_net_kv_minmax(k0, v0, r2, s2);
+    i_sort_net_kv_minmax(k1, v1, r3, s3);
+    i_sort_net_kv_minmax(k0, v0, k1, v1);
+    i_sort_net_kv_minmax(r2, s2, r3, s3);
+    i_sort_net_kv_clean(k0, v0);
+    i_sort_net_kv_clean(k1, v1);
+    i_sort_net_kv_clean(r2, s2);
+    i_sort_net_kv_clean(r3, s3);
+    k2 = r2; v2 = s2;
+    k3 = r3; v3 = s3;
+}
+
+template<unsigned N> SIMDPP_INL
+void i_sort_net_kv_network(int32<N>& k0, uint32<N>& v0,
+                           int32<N>& k1, uint32<N>& v1,
+                           int32<N>& k2, uint32<N>& v2,
+                           int32<N>& k3, uint32<N>& v3)
+{
+    i_sort_net_kv_minmax(k0, v0, k1, v1);
+    i_sort_net_kv_minmax(k2, v2, k3, v3);
+    i_sort_net_kv_minmax(k0, v0, k2, v2);
+    i_sort_net_kv_minmax(k1, v1, k3, v3);
+    i_sort_net_kv_minmax(k1, v1, k2, v2);
+    transpose4(k0, k1, k2, k3);
+    transpose4(v0, v1, v2, v3);
+    i_sort_net_kv_merge2(k0, v0, k1, v1);
+    i_sort_net_kv_merge2(k2, v2, k3, v3);
+    i_sort_net_kv_merge4(k0, v0, k1, v1, k2, v2, k3, v3);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,248 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/insn/compress_lut.h>
+#include <simdpp/detail/insn/store_partial.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Stores the first nb bytes of a vector without writing past them. The
+    bytes are stored in power-of-two sized pieces. The pieces that are not
+    needed are written to a scratch buffer instead, so that there are no
+    branches that depend on nb.
+*/
+template<unsigned S> SIMDPP_INL
+void i_store_compress_first(char* p, const uint8<16>& a, unsigned nb)
+{
+    mem_block<uint8<16>> ma(a);
+    char scratch[16];
+    unsigned off = 0;
+    std::memcpy(i_compress_select_ptr(nb & 16, p, scratch), &ma[0], 16);
+    for (unsigned size = 8; size >= S; size /= 2) {
+        unsigned piece = nb & size;
+        std::memcpy(i_compress_select_ptr(piece, p + off, scratch), &ma[off],
+                    size);
+        off += piece;
+    }
+}
+
+/*  Stores the active lanes of a 128-bit vector of S-byte elements. If Full is
+    true, the whole permuted vector is stored, thus up to 16 bytes past the
+    stored elements may be overwritten. Otherwise only the stored elements
+    are written to memory.
+*/
+template<unsigned S, bool Full> SIMDPP_INL
+unsigned i_store_compress_bytes(char* p, const uint8<16>& a, uint64_t bits)
+{
+    const unsigned lanes = 16 / S;
+    bits &= (1u << lanes) - 1;
+#if SIMDPP_USE_NULL || (SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3)
+    // there's no byte shuffle instruction, thus compress element by element.
+    // Each element is written unconditionally, the inactive ones either to
+    // the position of the next element or to a scratch buffer
+    mem_block<uint8<16>> ma(a);
+    char scratch[S];
+    unsigned n = 0;
+    for (unsigned i = 0; i < lanes; ++i) {
+        unsigned active = (bits >> i) & 1;
+        char* dst = i_compress_select_ptr(Full || active, p + n*S, scratch);
+        std::memcpy(dst, &ma[i*S], S);
+        n += active;
+    }
+    return n;
+#else
+    unsigned n = i_compress_popcnt_lanes<lanes>(bits);
+    uint8<16> idx = i_compress_lut_idx<S>(false, bits);
+    uint8<16> c = permute_zbytes16(a, idx);
+    if (Full)
+        store_u(p, c);
+#if SIMDPP_USE_AVX
+    else if (S == 4)
+        i_store_partial_native(p, bit_cast<uint32<4>>(c), n);
+#endif
+    else
+        i_store_compress_first<S>(p, c, n*S);
+    return n;
+#endif
+}
+
+template<unsigned S, bool Full, unsigned N> SIMDPP_INL
+unsigned i_store_compress_bytes(char* p, const uint8<N>& a, uint64_t bits)
+{
+    uint8<N/2> lo, hi;
+    split(a, lo, hi);
+    unsigned n = i_store_compress_bytes<S, Full>(p, lo, bits);
+    n += i_store_compress_bytes<S, Full>(p + n*S, hi, bits >> (N/2/S));
+    return n;
+}
+
+// -----------------------------------------------------------------------------
+
+template<bool Full, class V> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const V& a, uint64_t bits)
+{
+    const unsigned S = sizeof(typename V::element_type);
+    using B = uint8<V::length * S>;
+    B b = bit_cast<B>(a);
+    return i_store_compress_bytes<S, Full>(p, b, bits);
+}
+
+/*  AVX512F provides compress instructions only for 512-bit vectors of 32-bit
+    and 64-bit elements. Smaller vectors are extended to 512 bits, the upper
+    lanes are disabled by the mask. The compressing store to memory is slow
+    on some implementations, thus if the whole vector may be stored, the
+    elements are compressed within a register instead.
+*/
+#if SIMDPP_USE_AVX512F
+template<bool Full> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const uint32<4>& a, uint64_t bits)
+{
+    __mmask16 k = bits & 0xf;
+    __m512i v = _mm512_castsi128_si512(a.native());
+    if (Full)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p),
+                         _mm512_castsi512_si128(_mm512_maskz_compress_epi32(k, v)));
+    else
+        _mm512_mask_compressstoreu_epi32(p, k, v);
+    return i_compress_popcnt_lanes<4>(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const uint32<8>& a, uint64_t bits)
+{
+    __mmask16 k = bits & 0xff;
+    __m512i v = _mm512_castsi256_si512(a.native());
+    if (Full)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p),
+                            _mm512_castsi512_si256(_mm512_maskz_compress_epi32(k, v)));
+    else
+        _mm512_mask_compressstoreu_epi32(p, k, v);
+    return i_compress_popcnt_lanes<8>(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const uint32<16>& a, uint64_t bits)
+{
+    __mmask16 k = bits;
+    if (Full)
+        _mm512_storeu_si512(p, _mm512_maskz_compress_epi32(k, a.native()));
+    else
+        _mm512_mask_compressstoreu_epi32(p, k, a.native());
+    return i_compress_popcnt(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const uint64<2>& a, uint64_t bits)
+{
+    __mmask8 k = bits & 0x3;
+    __m512i v = _mm512_castsi128_si512(a.native());
+    if (Full)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p),
+                         _mm512_castsi512_si128(_mm512_maskz_compress_epi64(k, v)));
+    else
+        _mm512_mask_compressstoreu_epi64(p, k, v);
+    return i_compress_popcnt_lanes<4>(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const uint64<4>& a, uint64_t bits)
+{
+    __mmask8 k = bits & 0xf;
+    __m512i v = _mm512_castsi256_si512(a.native());
+    if (Full)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p),
+                            _mm512_castsi512_si256(_mm512_maskz_compress_epi64(k, v)));
+    else
+        _mm512_mask_compressstoreu_epi64(p, k, v);
+    return i_compress_popcnt_lanes<4>(k);
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const uint64<8>& a, uint64_t bits)
+{
+    __mmask8 k = bits;
+    if (Full)
+        _mm512_storeu_si512(p, _mm512_maskz_compress_epi64(k, a.native()));
+    else
+        _mm512_mask_compressstoreu_epi64(p, k, a.native());
+    return i_compress_popcnt_lanes<8>(k);
+}
+#elif SIMDPP_USE_AVX2
+/*  On AVX2 256-bit vectors of 32-bit and 64-bit elements are compressed
+    across the whole vector by a single 32-bit element permutation. Unless
+    the whole vector is stored, the elements are stored by a masked store.
+*/
+template<bool Full> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const uint32<8>& a, uint64_t bits)
+{
+    bits &= 0xff;
+    const uint8_t* row = i_get_compress_lut().compress32x8[bits];
+    __m256i idx = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row)));
+    uint32<8> c = _mm256_permutevar8x32_epi32(a.native(), idx);
+    unsigned n = i_compress_popcnt_lanes<8>(bits);
+    if (Full)
+        store_u(p, c);
+    else
+        i_store_partial_native(p, c, n);
+    return n;
+}
+
+template<bool Full> SIMDPP_INL
+unsigned i_store_compress_native(char* p, const uint64<4>& a, uint64_t bits)
+{
+    bits &= 0xf;
+    const uint8_t* row = i_get_compress_lut().compress64x4[bits];
+    __m256i idx = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row)));
+    uint64<4> c = _mm256_permutevar8x32_epi32(a.native(), idx);
+    unsigned n = i_compress_popcnt_lanes<4>(bits);
+    if (Full)
+        store_u(p, c);
+    else
+        i_store_partial_native(p, c, n);
+    return n;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<bool Full, class V, class M> SIMDPP_INL
+unsigned i_store_compress(char* p, const V& a, const M& mask)
+{
+    const unsigned S = sizeof(typename V::element_type);
+    unsigned n = 0;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        uint64_t bits = i_compress_lane_bits(mask.vec(i));
+        n += i_store_compress_native<Full>(p + n*S, a.vec(i), bits);
+    }
+    return n;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
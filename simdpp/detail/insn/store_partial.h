@@ -0,0 +1,165 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_PARTIAL_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_PARTIAL_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/detail/insn/load_partial.h>
+#include <simdpp/detail/mem_block.h>
+#include <simdpp/detail/null/memory.h>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Unlike loads, stores past the end of the destination are never safe
+template<class V> SIMDPP_INL
+void i_store_partial_native(char* p, const V& a, unsigned n)
+{
+#if SIMDPP_USE_NULL
+    null::store_first(p, a, n);
+#else
+    const unsigned S = sizeof(typename V::element_type);
+    if (n >= V::length) {
+        store_u(p, a);
+    } else if (n > 0) {
+        mem_block<V> r(a);
+        std::memcpy(p, &r[0], n*S);
+    }
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_store_partial_native(char* p, const uint32<4>& a, unsigned n)
+{
+    if (n >= 4) {
+        store_u(p, a);
+        return;
+    }
+    uint32<4> m = load_u(i_partial_mask_data() + 64 - n*4);
+#if SIMDPP_USE_AVX2
+    _mm_maskstore_epi32(reinterpret_cast<int*>(p), m.native(), a.native());
+#else
+    _mm_maskstore_ps(reinterpret_cast<float*>(p), m.native(),
+                     _mm_castsi128_ps(a.native()));
+#endif
+}
+
+static SIMDPP_INL
+void i_store_partial_native(char* p, const uint64<2>& a, unsigned n)
+{
+    if (n >= 2) {
+        store_u(p, a);
+        return;
+    }
+    uint64<2> m = load_u(i_partial_mask_data() + 64 - n*8);
+    _mm_maskstore_pd(reinterpret_cast<double*>(p), m.native(),
+                     _mm_castsi128_pd(a.native()));
+}
+#endif
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_partial_native(char* p, const uint32<8>& a, unsigned n)
+{
+    if (n >= 8) {
+        store_u(p, a);
+        return;
+    }
+    uint32<8> m = load_u(i_partial_mask_data() + 64 - n*4);
+    _mm256_maskstore_epi32(reinterpret_cast<int*>(p), m.native(), a.native());
+}
+
+static SIMDPP_INL
+void i_store_partial_native(char* p, const uint64<4>& a, unsigned n)
+{
+    if (n >= 4) {
+        store_u(p, a);
+        return;
+    }
+    uint64<4> m = load_u(i_partial_mask_data() + 64 - n*8);
+#if __INTEL_COMPILER
+    _mm256_maskstore_epi64(reinterpret_cast<__int64*>(p), m.native(), a.native());
+#else
+    _mm256_maskstore_epi64(reinterpret_cast<long long*>(p), m.native(), a.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_partial_native(char* p, const uint32<16>& a, unsigned n)
+{
+    __mmask16 k = n >= 16 ? 0xffff : (1u << n) - 1;
+    _mm512_mask_storeu_epi32(p, k, a.native());
+}
+
+static SIMDPP_INL
+void i_store_partial_native(char* p, const uint64<8>& a, unsigned n)
+{
+    __mmask8 k = n >= 8 ? 0xff : (1u << n) - 1;
+    _mm512_mask_storeu_epi64(p, k, a.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL void i_store_partial_native(char* p, const uint8<64>& a, unsigned n)
+{
+    __mmask64 k = n >= 64 ? ~__mmask64(0) : (__mmask64(1) << n) - 1;
+    _mm512_mask_storeu_epi8(p, k, a.native());
+}
+
+SIMDPP_INL void i_store_partial_native(char* p, const uint16<32>& a, unsigned n)
+{
+    __mmask32 k = n >= 32 ? 0xffffffff : (1u << n) - 1;
+    _mm512_mask_storeu_epi16(p, k, a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+void i_store_partial(char* p, const V& a, unsigned n)
+{
+    const unsigned veclen = V::base_vector_type::length;
+    const unsigned S = sizeof(typename V::element_type);
+
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        unsigned vn = n > i*veclen ? n - i*veclen : 0;
+        i_store_partial_native(p + i*veclen*S, a.vec(i), vn);
+    }
+}
+
+template<unsigned N> SIMDPP_INL
+void i_store_partial(char* p, const float32<N>& a, unsigned n)
+{
+    i_store_partial(p, bit_cast<uint32<N>>(a), n);
+}
+
+template<unsigned N> SIMDPP_INL
+void i_store_partial(char* p, const float64<N>& a, unsigned n)
+{
+    i_store_partial(p, bit_cast<uint64<N>>(a), n);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -194,6 +194,26 @@ V shift_l(const V& a, unsigned shift)
     return r;
 }
 
+template<class V, class C> SIMDPP_INL
+V shift_r_v(const V& a, const C& shift)
+{
+    V r;
+    for (unsigned i = 0; i < V::length; i++) {
+        r.el(i) = a.el(i) >> shift.el(i);
+    }
+    return r;
+}
+
+template<class V, class C> SIMDPP_INL
+V shift_l_v(const V& a, const C& shift)
+{
+    V r;
+    for (unsigned i = 0; i < V::length; i++) {
+        r.el(i) = a.el(i) << shift.el(i);
+    }
+    return r;
+}
+
 template<class V> SIMDPP_INL
 V min(const V& a, const V& b)
 {
@@ -31,6 +31,26 @@ V load(V& a, const void* p)
     return a;
 }
 
+template<class V, class M> SIMDPP_INL
+void load_masked(V& a, const void* p, const M& mask)
+{
+    using T = typename V::element_type;
+    const T* pt = reinterpret_cast<const T*>(p);
+    for (unsigned i = 0; i < V::length; i++) {
+        a.el(i) = mask.el(i) ? pt[i] : T(0);
+    }
+}
+
+template<class V> SIMDPP_INL
+void load_first(V& a, const void* p, unsigned n)
+{
+    using T = typename V::element_type;
+    const T* pt = reinterpret_cast<const T*>(p);
+    for (unsigned i = 0; i < V::length; i++) {
+        a.el(i) = i < n ? pt[i] : T(0);
+    }
+}
+
 template<class V> SIMDPP_INL
 void load_packed2(V& a, V& b, const void* p)
 {
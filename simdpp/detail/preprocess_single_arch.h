@@ -70,6 +70,9 @@
 #ifdef SIMDPP_ARCH_PP_USE_SSE4_1
 #undef SIMDPP_ARCH_PP_USE_SSE4_1
 #endif
+#ifdef SIMDPP_ARCH_PP_USE_SSE4_2
+#undef SIMDPP_ARCH_PP_USE_SSE4_2
+#endif
 #ifdef SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN
 #undef SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN
 #endif
@@ -88,6 +91,36 @@
 #ifdef SIMDPP_ARCH_PP_USE_AVX512DQ
 #undef SIMDPP_ARCH_PP_USE_AVX512DQ
 #endif
+#ifdef SIMDPP_ARCH_PP_USE_F16C
+#undef SIMDPP_ARCH_PP_USE_F16C
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VL
+#undef SIMDPP_ARCH_PP_USE_AVX512VL
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512CD
+#undef SIMDPP_ARCH_PP_USE_AVX512CD
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VBMI
+#undef SIMDPP_ARCH_PP_USE_AVX512VBMI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#undef SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VNNI
+#undef SIMDPP_ARCH_PP_USE_AVX512VNNI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_GFNI
+#undef SIMDPP_ARCH_PP_USE_GFNI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_BMI2
+#undef SIMDPP_ARCH_PP_USE_BMI2
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_NEON_DOTPROD
+#undef SIMDPP_ARCH_PP_USE_NEON_DOTPROD
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_SVE
+#undef SIMDPP_ARCH_PP_USE_SVE
+#endif
 #ifdef SIMDPP_ARCH_PP_USE_FMA3
 #undef SIMDPP_ARCH_PP_USE_FMA3
 #endif
@@ -131,6 +164,9 @@
 #ifdef SIMDPP_ARCH_PP_NS_USE_SSE4_1
 #undef SIMDPP_ARCH_PP_NS_USE_SSE4_1
 #endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_SSE4_2
+#undef SIMDPP_ARCH_PP_NS_USE_SSE4_2
+#endif
 #ifdef SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
 #undef SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
 #endif
@@ -149,6 +185,36 @@
 #ifdef SIMDPP_ARCH_PP_NS_USE_AVX512DQ
 #undef SIMDPP_ARCH_PP_NS_USE_AVX512DQ
 #endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_F16C
+#undef SIMDPP_ARCH_PP_NS_USE_F16C
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VL
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VL
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_GFNI
+#undef SIMDPP_ARCH_PP_NS_USE_GFNI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_BMI2
+#undef SIMDPP_ARCH_PP_NS_USE_BMI2
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+#undef SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_SVE
+#undef SIMDPP_ARCH_PP_NS_USE_SVE
+#endif
 #ifdef SIMDPP_ARCH_PP_NS_USE_FMA3
 #undef SIMDPP_ARCH_PP_NS_USE_FMA3
 #endif
@@ -179,7 +245,7 @@
 
 #ifdef SIMDPP_ARCH_PP_LIST
 
-    #define SIMDPP_ARCH_CREATE_MASK2(x0,x1,x2,x3,x4,x5,x6,x7,x8,x9,x10,x11,x12,...)    \
+    #define SIMDPP_ARCH_CREATE_MASK2(x0,x1,x2,x3,x4,x5,x6,x7,x8,x9,x10,x11,x12,x13,x14,x15,...)    \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x0) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x1) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x2) | \
@@ -192,9 +258,12 @@
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x9) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x10) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x11) | \
-        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x12)
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x12) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x13) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x14) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x15)
 
-    #define SIMDPP_ARCH_PP_CREATE_MASK(...) SIMDPP_PP_EXPAND( SIMDPP_ARCH_CREATE_MASK2(__VA_ARGS__,0,0,0,0,0,0,0,0,0,0,0,0,0) )
+    #define SIMDPP_ARCH_PP_CREATE_MASK(...) SIMDPP_PP_EXPAND( SIMDPP_ARCH_CREATE_MASK2(__VA_ARGS__,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0) )
     #define SIMDPP_ARCH_PP_MASK SIMDPP_ARCH_PP_CREATE_MASK(SIMDPP_ARCH_PP_LIST)
 
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_SSE2) == SIMDPP_INSN_MASK_SSE2
@@ -209,6 +278,9 @@
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_SSE4_1) == SIMDPP_INSN_MASK_SSE4_1
         #define SIMDPP_ARCH_PP_USE_SSE4_1 1
     #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_SSE4_2) == SIMDPP_INSN_MASK_SSE4_2
+        #define SIMDPP_ARCH_PP_USE_SSE4_2 1
+    #endif
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_POPCNT_INSN) == SIMDPP_INSN_MASK_POPCNT_INSN
         #define SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN 1
     #endif
@@ -236,6 +308,36 @@
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512DQ) == SIMDPP_INSN_MASK_AVX512DQ
         #define SIMDPP_ARCH_PP_USE_AVX512DQ 1
     #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_F16C) == SIMDPP_INSN_MASK_F16C
+        #define SIMDPP_ARCH_PP_USE_F16C 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VL) == SIMDPP_INSN_MASK_AVX512VL
+        #define SIMDPP_ARCH_PP_USE_AVX512VL 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512CD) == SIMDPP_INSN_MASK_AVX512CD
+        #define SIMDPP_ARCH_PP_USE_AVX512CD 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VBMI) == SIMDPP_INSN_MASK_AVX512VBMI
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VPOPCNTDQ) == SIMDPP_INSN_MASK_AVX512VPOPCNTDQ
+        #define SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VNNI) == SIMDPP_INSN_MASK_AVX512VNNI
+        #define SIMDPP_ARCH_PP_USE_AVX512VNNI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_GFNI) == SIMDPP_INSN_MASK_GFNI
+        #define SIMDPP_ARCH_PP_USE_GFNI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_BMI2) == SIMDPP_INSN_MASK_BMI2
+        #define SIMDPP_ARCH_PP_USE_BMI2 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_NEON_DOTPROD) == SIMDPP_INSN_MASK_NEON_DOTPROD
+        #define SIMDPP_ARCH_PP_USE_NEON_DOTPROD 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_SVE) == SIMDPP_INSN_MASK_SVE
+        #define SIMDPP_ARCH_PP_USE_SVE 1
+    #endif
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_NEON) == SIMDPP_INSN_MASK_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
     #endif
@@ -275,6 +377,10 @@
         #define SIMDPP_ARCH_PP_USE_SSE4_1 1
         #undef SIMDPP_ARCH_X86_SSE4_1
     #endif
+    #ifdef SIMDPP_ARCH_X86_SSE4_2
+        #define SIMDPP_ARCH_PP_USE_SSE4_2 1
+        #undef SIMDPP_ARCH_X86_SSE4_2
+    #endif
     #ifdef SIMDPP_ARCH_X86_POPCNT_INSN
         #define SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN 1
         #undef SIMDPP_ARCH_X86_POPCNT_INSN
@@ -311,6 +417,46 @@
         #define SIMDPP_ARCH_PP_USE_AVX512DQ 1
         #undef SIMDPP_ARCH_X86_AVX512DQ
     #endif
+    #ifdef SIMDPP_ARCH_X86_F16C
+        #define SIMDPP_ARCH_PP_USE_F16C 1
+        #undef SIMDPP_ARCH_X86_F16C
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VL
+        #define SIMDPP_ARCH_PP_USE_AVX512VL 1
+        #undef SIMDPP_ARCH_X86_AVX512VL
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512CD
+        #define SIMDPP_ARCH_PP_USE_AVX512CD 1
+        #undef SIMDPP_ARCH_X86_AVX512CD
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VBMI
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI 1
+        #undef SIMDPP_ARCH_X86_AVX512VBMI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VPOPCNTDQ
+        #define SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ 1
+        #undef SIMDPP_ARCH_X86_AVX512VPOPCNTDQ
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VNNI
+        #define SIMDPP_ARCH_PP_USE_AVX512VNNI 1
+        #undef SIMDPP_ARCH_X86_AVX512VNNI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_GFNI
+        #define SIMDPP_ARCH_PP_USE_GFNI 1
+        #undef SIMDPP_ARCH_X86_GFNI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_BMI2
+        #define SIMDPP_ARCH_PP_USE_BMI2 1
+        #undef SIMDPP_ARCH_X86_BMI2
+    #endif
+    #ifdef SIMDPP_ARCH_ARM_NEON_DOTPROD
+        #define SIMDPP_ARCH_PP_USE_NEON_DOTPROD 1
+        #undef SIMDPP_ARCH_ARM_NEON_DOTPROD
+    #endif
+    #ifdef SIMDPP_ARCH_ARM_SVE
+        #define SIMDPP_ARCH_PP_USE_SVE 1
+        #undef SIMDPP_ARCH_ARM_SVE
+    #endif
     #ifdef SIMDPP_ARCH_ARM_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
         #undef SIMDPP_ARCH_ARM_NEON
@@ -339,6 +485,36 @@
 
 // Define support of instruction sets that are implicitly available when another
 // instruction set is available
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512BW
+        #define SIMDPP_ARCH_PP_USE_AVX512BW 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VL
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_AVX512DQ
     #ifndef SIMDPP_ARCH_PP_USE_AVX512F
         #define SIMDPP_ARCH_PP_USE_AVX512F 1
@@ -363,6 +539,12 @@
     #endif
 #endif
 
+#if SIMDPP_ARCH_PP_USE_F16C
+    #ifndef SIMDPP_ARCH_PP_USE_AVX
+        #define SIMDPP_ARCH_PP_USE_AVX 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_AVX
     #ifndef SIMDPP_ARCH_PP_USE_SSE4_1
         #define SIMDPP_ARCH_PP_USE_SSE4_1 1
@@ -387,6 +569,12 @@
     #endif
 #endif
 
+#if SIMDPP_ARCH_PP_USE_SSE4_2
+    #ifndef SIMDPP_ARCH_PP_USE_SSE4_1
+        #define SIMDPP_ARCH_PP_USE_SSE4_1 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_SSE4_1
     #ifndef SIMDPP_ARCH_PP_USE_SSSE3
         #define SIMDPP_ARCH_PP_USE_SSSE3 1
@@ -405,12 +593,24 @@
     #endif
 #endif
 
+#if SIMDPP_ARCH_PP_USE_GFNI
+    #ifndef SIMDPP_ARCH_PP_USE_SSE2
+        #define SIMDPP_ARCH_PP_USE_SSE2 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_SSE3
     #ifndef SIMDPP_ARCH_PP_USE_SSE2
         #define SIMDPP_ARCH_PP_USE_SSE2 1
     #endif
 #endif
 
+#if SIMDPP_ARCH_PP_USE_NEON_DOTPROD || SIMDPP_ARCH_PP_USE_SVE
+    #ifndef SIMDPP_ARCH_PP_USE_NEON_FLT_SP
+        #define SIMDPP_ARCH_PP_USE_NEON_FLT_SP 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_NEON_FLT_SP
     #ifndef SIMDPP_ARCH_PP_USE_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
@@ -457,6 +657,9 @@
 #if SIMDPP_ARCH_PP_USE_SSE4_1 && !SIMDPP_ARCH_PP_USE_AVX
 #define SIMDPP_ARCH_PP_NS_USE_SSE4_1 1
 #endif
+#if SIMDPP_ARCH_PP_USE_SSE4_2
+#define SIMDPP_ARCH_PP_NS_USE_SSE4_2 1
+#endif
 #if SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN
 #define SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN 1
 #endif
@@ -466,15 +669,47 @@
 #if SIMDPP_ARCH_PP_USE_AVX2 && !SIMDPP_ARCH_PP_USE_AVX512F
 #define SIMDPP_ARCH_PP_NS_USE_AVX2 1
 #endif
-#if SIMDPP_ARCH_PP_USE_AVX512F && !SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512DQ
+#if SIMDPP_ARCH_PP_USE_AVX512F && !SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512DQ && \
+    !SIMDPP_ARCH_PP_USE_AVX512VL && !SIMDPP_ARCH_PP_USE_AVX512CD && \
+    !SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ && !SIMDPP_ARCH_PP_USE_AVX512VNNI
 #define SIMDPP_ARCH_PP_NS_USE_AVX512F 1
 #endif
-#if SIMDPP_ARCH_PP_USE_AVX512BW
+#if SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512VBMI
 #define SIMDPP_ARCH_PP_NS_USE_AVX512BW 1
 #endif
 #if SIMDPP_ARCH_PP_USE_AVX512DQ
 #define SIMDPP_ARCH_PP_NS_USE_AVX512DQ 1
 #endif
+#if SIMDPP_ARCH_PP_USE_F16C
+#define SIMDPP_ARCH_PP_NS_USE_F16C 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VL
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VL 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+#define SIMDPP_ARCH_PP_NS_USE_AVX512CD 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VBMI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VNNI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_GFNI
+#define SIMDPP_ARCH_PP_NS_USE_GFNI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI2
+#define SIMDPP_ARCH_PP_NS_USE_BMI2 1
+#endif
+#if SIMDPP_ARCH_PP_USE_NEON_DOTPROD
+#define SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD 1
+#endif
+#if SIMDPP_ARCH_PP_USE_SVE
+#define SIMDPP_ARCH_PP_NS_USE_SVE 1
+#endif
 #if SIMDPP_ARCH_PP_USE_FMA3
 #define SIMDPP_ARCH_PP_NS_USE_FMA3 1
 #endif
@@ -487,7 +722,7 @@
 #if SIMDPP_ARCH_PP_USE_NEON && !SIMDPP_ARCH_PP_USE_NEON_FLT_SP
 #define SIMDPP_ARCH_PP_NS_USE_NEON 1
 #endif
-#if SIMDPP_ARCH_PP_USE_NEON_FLT_SP
+#if SIMDPP_ARCH_PP_USE_NEON_FLT_SP && !SIMDPP_ARCH_PP_USE_NEON_DOTPROD && !SIMDPP_ARCH_PP_USE_SVE
 #define SIMDPP_ARCH_PP_NS_USE_NEON_FLT_SP 1
 #endif
 #if SIMDPP_ARCH_PP_USE_ALTIVEC && !SIMDPP_ARCH_PP_USE_VSX_206
@@ -49,6 +49,22 @@ struct remove_mask<mask_float32<N,E>> { using type = float32<N>; using expr = fl
 template<unsigned N, class E>
 struct remove_mask<mask_float64<N,E>> { using type = float64<N>; using expr = float64<N,E>; };
 
+/*  Returns the fastest vector type with elements of type T. The vector has the
+    size of a single native register.
+ */
+template<class T> struct native_vector_for;
+
+template<> struct native_vector_for<int8_t> { using type = int8<SIMDPP_FAST_INT8_SIZE>; };
+template<> struct native_vector_for<uint8_t> { using type = uint8<SIMDPP_FAST_INT8_SIZE>; };
+template<> struct native_vector_for<int16_t> { using type = int16<SIMDPP_FAST_INT16_SIZE>; };
+template<> struct native_vector_for<uint16_t> { using type = uint16<SIMDPP_FAST_INT16_SIZE>; };
+template<> struct native_vector_for<int32_t> { using type = int32<SIMDPP_FAST_INT32_SIZE>; };
+template<> struct native_vector_for<uint32_t> { using type = uint32<SIMDPP_FAST_INT32_SIZE>; };
+template<> struct native_vector_for<int64_t> { using type = int64<SIMDPP_FAST_INT64_SIZE>; };
+template<> struct native_vector_for<uint64_t> { using type = uint64<SIMDPP_FAST_INT64_SIZE>; };
+template<> struct native_vector_for<float> { using type = float32<SIMDPP_FAST_FLOAT32_SIZE>; };
+template<> struct native_vector_for<double> { using type = float64<SIMDPP_FAST_FLOAT64_SIZE>; };
+
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
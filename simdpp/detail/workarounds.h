@@ -53,6 +53,17 @@
 #endif
 #endif
 
+#if SIMDPP_USE_AVX512BW
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER) && !defined(__clang__)
+/*  GCC 12 may implement the conversion of a 32-bit mask register to a 64-bit
+    integer by spilling the mask register with a 32-bit kmovd and later
+    reloading the spill slot as a 64-bit value, which leaves garbage in the
+    upper half.
+*/
+#define SIMDPP_WORKAROUND_AVX512_MASK32_ZERO_EXTEND 1
+#endif
+#endif
+
 #if SIMDPP_USE_AVX || SIMDPP_USE_AVX2
 #if (__clang_major__ == 3) && (__clang_minor__ == 6)
 /*  See https://llvm.org/bugs/show_bug.cgi?id=23441. Clang does not generate
@@ -25,6 +25,8 @@ namespace simdpp {
 enum class Arch : std::uint32_t {
     /// Indicates that no SIMD instructions are supported
     NONE_NULL = 0,
+    /// Indicates x86 BMI2 (bit manipulation) instruction support
+    X86_BMI2 = 1 << 0,
     /// Indicates x86 SSE2 support
     X86_SSE2 = 1 << 1,
     /// Indicates x86 SSE3 support
@@ -33,25 +35,41 @@ enum class Arch : std::uint32_t {
     X86_SSSE3 = 1 << 3,
     /// Indicates x86 SSE4.1 support
     X86_SSE4_1 = 1 << 4,
+    /// Indicates x86 SSE4.2 support
+    X86_SSE4_2 = 1 << 5,
     /// Indicates x86 popcnt instruction support (Note: this is not equivalent
     /// to the ABM CPUID flag, Intel includes the instruction into SSE 4.2)
-    X86_POPCNT_INSN = 1 << 5,
+    X86_POPCNT_INSN = 1 << 6,
     /// Indicates x86 AVX support
-    X86_AVX = 1 << 6,
+    X86_AVX = 1 << 7,
+    /// Indicates x86 F16C (half-precision conversion) instruction support
+    X86_F16C = 1 << 8,
     /// Indicates x86 AVX2 support
-    X86_AVX2 = 1 << 7,
+    X86_AVX2 = 1 << 9,
     /// Indicates x86 FMA3 (Intel) support
-    X86_FMA3 = 1 << 8,
+    X86_FMA3 = 1 << 10,
     /// Indicates x86 FMA4 (AMD) support
-    X86_FMA4 = 1 << 9,
+    X86_FMA4 = 1 << 11,
     /// Indicates x86 XOP (AMD) support
-    X86_XOP = 1 << 10,
+    X86_XOP = 1 << 12,
+    /// Indicates x86 GFNI (Galois field) instruction support
+    X86_GFNI = 1 << 13,
     /// Indicates x86 AVX-512F suppotr
-    X86_AVX512F = 1 << 11,
+    X86_AVX512F = 1 << 14,
     /// Indicates x86 AVX-512BW suppotr
-    X86_AVX512BW = 1 << 12,
+    X86_AVX512BW = 1 << 15,
     /// Indicates x86 AVX-512DQ suppotr
-    X86_AVX512DQ = 1 << 13,
+    X86_AVX512DQ = 1 << 16,
+    /// Indicates x86 AVX-512VL support
+    X86_AVX512VL = 1 << 17,
+    /// Indicates x86 AVX-512CD support
+    X86_AVX512CD = 1 << 18,
+    /// Indicates x86 AVX-512VBMI support
+    X86_AVX512VBMI = 1 << 19,
+    /// Indicates x86 AVX-512VPOPCNTDQ support
+    X86_AVX512VPOPCNTDQ = 1 << 20,
+    /// Indicates x86 AVX-512VNNI support
+    X86_AVX512VNNI = 1 << 21,
 
     /// Indicates ARM NEON support (SP and DP floating-point math is executed
     /// on VFP)
@@ -59,6 +77,10 @@ enum class Arch : std::uint32_t {
     /// Indicates ARM NEON support (SP floating-point math is executed on NEON,
     /// DP floating-point math is executed on VFP)
     ARM_NEON_FLT_SP = 1 << 1,
+    /// Indicates ARMv8.2 NEON dot product instruction support
+    ARM_NEON_DOTPROD = 1 << 2,
+    /// Indicates ARM SVE (Scalable Vector Extension) support
+    ARM_SVE = 1 << 3,
 
     /// Indicates POWER ALTIVEC support.
     POWER_ALTIVEC = 1 << 0,
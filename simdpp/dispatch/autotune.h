@@ -0,0 +1,230 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_AUTOTUNE_H
+#define LIBSIMDPP_DISPATCH_AUTOTUNE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <simdpp/dispatch/arch.h>
+#include <simdpp/dispatch/dispatcher.h>
+#include <simdpp/dispatch/registry.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+
+namespace simdpp {
+namespace detail {
+
+/*  Returns a string identifying the model of the processor, which is used as
+    the key of the autotuning cache. On x86 the processor brand string is
+    used. On Linux the "model name" field of /proc/cpuinfo is used otherwise.
+    Returns "unknown" if the model can't be determined.
+*/
+inline std::string get_autotune_cpu_model()
+{
+    std::string res;
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+    unsigned eax, ebx, ecx, edx;
+    get_cpuid(0x80000000, 0, &eax, &ebx, &ecx, &edx);
+    if (eax >= 0x80000004) {
+        char brand[49] = {};
+        for (unsigned i = 0; i < 3; ++i) {
+            unsigned regs[4];
+            get_cpuid(0x80000002 + i, 0, regs, regs + 1, regs + 2, regs + 3);
+            std::memcpy(brand + i * 16, regs, 16);
+        }
+        res = brand;
+    }
+#elif __linux__
+    std::ifstream in("/proc/cpuinfo");
+    std::string line;
+    while (res.empty() && std::getline(in, line)) {
+        if (line.compare(0, 10, "model name") != 0)
+            continue;
+        std::size_t pos = line.find(':');
+        if (pos != std::string::npos)
+            res = line.substr(pos + 1);
+    }
+#endif
+    // Trim the whitespace, the brand string is often padded with spaces
+    std::size_t first = res.find_first_not_of(" \t");
+    std::size_t last = res.find_last_not_of(" \t");
+    if (first == std::string::npos)
+        return "unknown";
+    return res.substr(first, last - first + 1);
+}
+
+/*  Returns the path of the autotuning cache file as given by the
+    SIMDPP_AUTOTUNE_CACHE environment variable or nullptr if the decisions
+    should not be persisted.
+*/
+inline const char* get_autotune_cache_path()
+{
+    const char* path = std::getenv("SIMDPP_AUTOTUNE_CACHE");
+    if (path == nullptr || *path == '\0')
+        return nullptr;
+    return path;
+}
+
+/*  The cache file contains one decision per line. Each line consists of the
+    processor model, the name of the dispatched function and the name of the
+    selected architecture namespace separated by tab characters. If the same
+    function is listed several times for the same processor model, the last
+    entry is used.
+*/
+inline std::string autotune_cache_lookup(const char* path,
+                                         const std::string& cpu_model,
+                                         const char* name)
+{
+    std::ifstream in(path);
+    std::string line, res;
+    std::string prefix = cpu_model + '\t' + name + '\t';
+    while (std::getline(in, line)) {
+        if (line.compare(0, prefix.size(), prefix) == 0)
+            res = line.substr(prefix.size());
+    }
+    return res;
+}
+
+inline void autotune_cache_store(const char* path,
+                                 const std::string& cpu_model,
+                                 const char* name, const char* arch_name)
+{
+    std::ofstream out(path, std::ios::app);
+    out << cpu_model << '\t' << name << '\t' << arch_name << '\n';
+}
+
+/*  A function that returns the cost of running the given version of the
+    dispatched function in arbitrary units. If set, it is used instead of
+    timing the tuner, so that the selection is deterministic. Intended for
+    testing.
+*/
+using AutotuneCostHook = std::uint64_t (*)(const FnVersion& version);
+
+inline std::atomic<AutotuneCostHook>& autotune_cost_hook_storage()
+{
+    static std::atomic<AutotuneCostHook> hook(nullptr);
+    return hook;
+}
+
+inline void set_autotune_cost_hook(AutotuneCostHook hook)
+{
+    autotune_cost_hook_storage().store(hook);
+}
+
+/*  A dispatch cache that selects the version by timing each candidate instead
+    of picking the one with the highest instruction set requirements. The
+    candidates are the versions supported by the processor that are allowed
+    by the dispatch arch mask.
+*/
+template<class FunPtr>
+class AutotuneDispatchCache : public DispatchCache<FunPtr> {
+public:
+    using Tuner = void (*)(FunPtr);
+
+    constexpr AutotuneDispatchCache(const char* name) :
+        DispatchCache<FunPtr>(name) {}
+
+    FunPtr resolve(FnVersion* versions, unsigned size, Arch arch, Tuner tuner)
+    {
+        arch &= static_cast<Arch>(dispatch_arch_mask_storage().load());
+
+        const char* path = get_autotune_cache_path();
+        std::string cpu_model;
+        if (path != nullptr) {
+            cpu_model = get_autotune_cpu_model();
+            std::string arch_name = autotune_cache_lookup(path, cpu_model,
+                                                          this->name());
+            FnVersion* cached = find_version(versions, size, arch,
+                                             arch_name.c_str());
+            if (cached != nullptr)
+                return publish(*cached);
+        }
+
+        FnVersion* best = nullptr;
+        std::chrono::steady_clock::duration best_time{};
+        for (unsigned i = 0; i < size; ++i) {
+            if (versions[i].fun_ptr == nullptr ||
+                !test_arch_subset(arch, versions[i].needed_arch))
+                continue;
+            std::chrono::steady_clock::duration time = measure(versions[i], tuner);
+            if (best == nullptr || time < best_time) {
+                best = versions + i;
+                best_time = time;
+            }
+        }
+        if (best == nullptr) {
+            // Same as in select_version_any
+            std::abort();
+        }
+
+        if (path != nullptr && best->arch_name != nullptr) {
+            autotune_cache_store(path, cpu_model, this->name(), best->arch_name);
+        }
+        return publish(*best);
+    }
+
+private:
+    static FnVersion* find_version(FnVersion* versions, unsigned size,
+                                   Arch arch, const char* arch_name)
+    {
+        for (unsigned i = 0; i < size; ++i) {
+            if (versions[i].fun_ptr == nullptr || versions[i].arch_name == nullptr)
+                continue;
+            if (!test_arch_subset(arch, versions[i].needed_arch))
+                continue;
+            if (std::strcmp(versions[i].arch_name, arch_name) == 0)
+                return versions + i;
+        }
+        return nullptr;
+    }
+
+    /*  Returns the shortest of several runs of the tuner. The first run is
+        not measured, so that the caches are warmed up and the code and data
+        are paged in. If a cost hook is set, the tuner is run once and the
+        cost returned by the hook is used instead.
+    */
+    static std::chrono::steady_clock::duration
+        measure(const FnVersion& version, Tuner tuner)
+    {
+        const unsigned repeat = 5;
+        FunPtr fun = reinterpret_cast<FunPtr>(version.fun_ptr);
+        tuner(fun);
+
+        AutotuneCostHook hook = autotune_cost_hook_storage().load();
+        if (hook != nullptr)
+            return std::chrono::steady_clock::duration(hook(version));
+
+        std::chrono::steady_clock::duration best{};
+        for (unsigned i = 0; i < repeat; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            tuner(fun);
+            auto time = std::chrono::steady_clock::now() - start;
+            if (i == 0 || time < best)
+                best = time;
+        }
+        return best;
+    }
+
+    FunPtr publish(const FnVersion& version)
+    {
+        return reinterpret_cast<FunPtr>(this->publish_version(version));
+    }
+};
+
+} // namespace detail
+} // namespace simdpp
+
+#endif
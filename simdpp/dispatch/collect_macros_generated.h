@@ -57,6 +57,11 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_1_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_1_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -102,6 +107,56 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_1_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_1_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_1_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_1_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_1_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -133,23 +188,34 @@
     #define SIMDPP_DISPATCH_1_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_1_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_1_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_1_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_1_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_1_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_1_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_1_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_1_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_1_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_1_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_1_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_1_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_1_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_1_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_1_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_1_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_1_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_1_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_1_NS_ID_VSX_206,                                      \
@@ -209,6 +275,11 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_2_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_2_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -254,6 +325,56 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_2_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_2_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_2_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_2_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_2_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -285,23 +406,34 @@
     #define SIMDPP_DISPATCH_2_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_2_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_2_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_2_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_2_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_2_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_2_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_2_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_2_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_2_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_2_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_2_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_2_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_2_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_2_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_2_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_2_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_2_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_2_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_2_NS_ID_VSX_206,                                      \
@@ -361,6 +493,11 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_3_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_3_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -406,6 +543,56 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_3_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_3_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_3_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_3_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_3_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -437,23 +624,34 @@
     #define SIMDPP_DISPATCH_3_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_3_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_3_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_3_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_3_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_3_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_3_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_3_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_3_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_3_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_3_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_3_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_3_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_3_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_3_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_3_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_3_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_3_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_3_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_3_NS_ID_VSX_206,                                      \
@@ -513,6 +711,11 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_4_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_4_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -558,6 +761,56 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_4_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_4_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_4_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_4_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_4_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -589,23 +842,34 @@
     #define SIMDPP_DISPATCH_4_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_4_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_4_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_4_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_4_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_4_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_4_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_4_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_4_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_4_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_4_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_4_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_4_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_4_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_4_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_4_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_4_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_4_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_4_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_4_NS_ID_VSX_206,                                      \
@@ -665,6 +929,11 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_5_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_5_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -710,6 +979,56 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_5_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_5_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_5_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_5_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_5_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -741,23 +1060,34 @@
     #define SIMDPP_DISPATCH_5_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_5_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_5_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_5_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_5_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_5_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_5_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_5_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_5_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_5_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_5_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_5_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_5_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_5_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_5_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_5_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_5_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_5_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_5_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_5_NS_ID_VSX_206,                                      \
@@ -817,6 +1147,11 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_6_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_6_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -862,6 +1197,56 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_6_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_6_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_6_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_6_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_6_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -893,23 +1278,34 @@
     #define SIMDPP_DISPATCH_6_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_6_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_6_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_6_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_6_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_6_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_6_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_6_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_6_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_6_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_6_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_6_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_6_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_6_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_6_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_6_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_6_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_6_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_6_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_6_NS_ID_VSX_206,                                      \
@@ -969,6 +1365,11 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_7_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_7_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -1014,6 +1415,56 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_7_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_7_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_7_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_7_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_7_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1045,23 +1496,34 @@
     #define SIMDPP_DISPATCH_7_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_7_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_7_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_7_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_7_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_7_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_7_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_7_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_7_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_7_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_7_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_7_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_7_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_7_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_7_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_7_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_7_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_7_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_7_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_7_NS_ID_VSX_206,                                      \
@@ -1121,6 +1583,11 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_8_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_8_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -1166,6 +1633,56 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_8_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_8_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_8_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_8_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_8_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1197,23 +1714,34 @@
     #define SIMDPP_DISPATCH_8_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_8_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_8_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_8_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_8_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_8_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_8_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_8_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_8_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_8_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_8_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_8_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_8_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_8_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_8_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_8_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_8_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_8_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_8_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_8_NS_ID_VSX_206,                                      \
@@ -1273,6 +1801,11 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_9_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_9_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -1318,6 +1851,56 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_9_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_9_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_9_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_9_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_9_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1349,23 +1932,34 @@
     #define SIMDPP_DISPATCH_9_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE21(arch,               \
+    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE32(arch,               \
         SIMDPP_DISPATCH_9_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE3,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSSE3,                                        \
         SIMDPP_DISPATCH_9_NS_ID_SSE4_1,                                       \
+        SIMDPP_DISPATCH_9_NS_ID_SSE4_2,                                       \
         SIMDPP_DISPATCH_9_NS_ID_POPCNT_INSN,                                  \
         SIMDPP_DISPATCH_9_NS_ID_AVX,                                          \
         SIMDPP_DISPATCH_9_NS_ID_AVX2,                                         \
         SIMDPP_DISPATCH_9_NS_ID_AVX512F,                                      \
         SIMDPP_DISPATCH_9_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512DQ,                                     \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512CD,                                     \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_F16C,                                         \
         SIMDPP_DISPATCH_9_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_9_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_9_NS_ID_XOP,                                          \
+        SIMDPP_DISPATCH_9_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_BMI2,                                         \
         SIMDPP_DISPATCH_9_NS_ID_NEON,                                         \
         SIMDPP_DISPATCH_9_NS_ID_NEON_FLT_SP,                                  \
+        SIMDPP_DISPATCH_9_NS_ID_NEON_DOTPROD,                                 \
+        SIMDPP_DISPATCH_9_NS_ID_SVE,                                          \
         SIMDPP_DISPATCH_9_NS_ID_MSA,                                          \
         SIMDPP_DISPATCH_9_NS_ID_ALTIVEC,                                      \
         SIMDPP_DISPATCH_9_NS_ID_VSX_206,                                      \
@@ -1425,6 +2019,11 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_10_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_10_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -1470,6 +2069,56 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_10_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_10_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_10_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_10_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_10_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1501,23 +2150,34 @@
     #define SIMDPP_DISPATCH_10_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE21(arch,              \
+    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE32(arch,              \
         SIMDPP_DISPATCH_10_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_10_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_10_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_10_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_10_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_10_NS_ID_AVX2,                                        \
         SIMDPP_DISPATCH_10_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_10_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512DQ,                                    \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512CD,                                    \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_10_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_10_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_10_NS_ID_XOP,                                         \
+        SIMDPP_DISPATCH_10_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_BMI2,                                        \
         SIMDPP_DISPATCH_10_NS_ID_NEON,                                        \
         SIMDPP_DISPATCH_10_NS_ID_NEON_FLT_SP,                                 \
+        SIMDPP_DISPATCH_10_NS_ID_NEON_DOTPROD,                                \
+        SIMDPP_DISPATCH_10_NS_ID_SVE,                                         \
         SIMDPP_DISPATCH_10_NS_ID_MSA,                                         \
         SIMDPP_DISPATCH_10_NS_ID_ALTIVEC,                                     \
         SIMDPP_DISPATCH_10_NS_ID_VSX_206,                                     \
@@ -1577,6 +2237,11 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_11_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_11_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -1622,6 +2287,56 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_11_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_11_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_11_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_11_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_11_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1653,23 +2368,34 @@
     #define SIMDPP_DISPATCH_11_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE21(arch,              \
+    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE32(arch,              \
         SIMDPP_DISPATCH_11_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_11_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_11_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_11_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_11_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_11_NS_ID_AVX2,                                        \
         SIMDPP_DISPATCH_11_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_11_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512DQ,                                    \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512CD,                                    \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_11_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_11_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_11_NS_ID_XOP,                                         \
+        SIMDPP_DISPATCH_11_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_BMI2,                                        \
         SIMDPP_DISPATCH_11_NS_ID_NEON,                                        \
         SIMDPP_DISPATCH_11_NS_ID_NEON_FLT_SP,                                 \
+        SIMDPP_DISPATCH_11_NS_ID_NEON_DOTPROD,                                \
+        SIMDPP_DISPATCH_11_NS_ID_SVE,                                         \
         SIMDPP_DISPATCH_11_NS_ID_MSA,                                         \
         SIMDPP_DISPATCH_11_NS_ID_ALTIVEC,                                     \
         SIMDPP_DISPATCH_11_NS_ID_VSX_206,                                     \
@@ -1729,6 +2455,11 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_12_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_12_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -1774,6 +2505,56 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_12_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_12_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_12_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_12_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_12_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1805,23 +2586,34 @@
     #define SIMDPP_DISPATCH_12_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE21(arch,              \
+    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE32(arch,              \
         SIMDPP_DISPATCH_12_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_12_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_12_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_12_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_12_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_12_NS_ID_AVX2,                                        \
         SIMDPP_DISPATCH_12_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_12_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512DQ,                                    \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512CD,                                    \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_12_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_12_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_12_NS_ID_XOP,                                         \
+        SIMDPP_DISPATCH_12_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_BMI2,                                        \
         SIMDPP_DISPATCH_12_NS_ID_NEON,                                        \
         SIMDPP_DISPATCH_12_NS_ID_NEON_FLT_SP,                                 \
+        SIMDPP_DISPATCH_12_NS_ID_NEON_DOTPROD,                                \
+        SIMDPP_DISPATCH_12_NS_ID_SVE,                                         \
         SIMDPP_DISPATCH_12_NS_ID_MSA,                                         \
         SIMDPP_DISPATCH_12_NS_ID_ALTIVEC,                                     \
         SIMDPP_DISPATCH_12_NS_ID_VSX_206,                                     \
@@ -1881,6 +2673,11 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_13_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_13_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -1926,6 +2723,56 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_13_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_13_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_13_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_13_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_13_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1957,23 +2804,34 @@
     #define SIMDPP_DISPATCH_13_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE21(arch,              \
+    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE32(arch,              \
         SIMDPP_DISPATCH_13_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_13_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_13_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_13_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_13_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_13_NS_ID_AVX2,                                        \
         SIMDPP_DISPATCH_13_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_13_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512DQ,                                    \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512CD,                                    \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_13_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_13_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_13_NS_ID_XOP,                                         \
+        SIMDPP_DISPATCH_13_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_BMI2,                                        \
         SIMDPP_DISPATCH_13_NS_ID_NEON,                                        \
         SIMDPP_DISPATCH_13_NS_ID_NEON_FLT_SP,                                 \
+        SIMDPP_DISPATCH_13_NS_ID_NEON_DOTPROD,                                \
+        SIMDPP_DISPATCH_13_NS_ID_SVE,                                         \
         SIMDPP_DISPATCH_13_NS_ID_MSA,                                         \
         SIMDPP_DISPATCH_13_NS_ID_ALTIVEC,                                     \
         SIMDPP_DISPATCH_13_NS_ID_VSX_206,                                     \
@@ -2033,6 +2891,11 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_14_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_14_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -2078,6 +2941,56 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_14_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_14_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_14_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_14_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_14_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2109,23 +3022,34 @@
     #define SIMDPP_DISPATCH_14_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE21(arch,              \
+    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE32(arch,              \
         SIMDPP_DISPATCH_14_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_14_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_14_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_14_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_14_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_14_NS_ID_AVX2,                                        \
         SIMDPP_DISPATCH_14_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_14_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512DQ,                                    \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512CD,                                    \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_14_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_14_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_14_NS_ID_XOP,                                         \
+        SIMDPP_DISPATCH_14_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_BMI2,                                        \
         SIMDPP_DISPATCH_14_NS_ID_NEON,                                        \
         SIMDPP_DISPATCH_14_NS_ID_NEON_FLT_SP,                                 \
+        SIMDPP_DISPATCH_14_NS_ID_NEON_DOTPROD,                                \
+        SIMDPP_DISPATCH_14_NS_ID_SVE,                                         \
         SIMDPP_DISPATCH_14_NS_ID_MSA,                                         \
         SIMDPP_DISPATCH_14_NS_ID_ALTIVEC,                                     \
         SIMDPP_DISPATCH_14_NS_ID_VSX_206,                                     \
@@ -2185,6 +3109,11 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_15_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_15_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -2230,6 +3159,56 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_15_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_15_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_15_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_15_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_15_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2261,23 +3240,34 @@
     #define SIMDPP_DISPATCH_15_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE21(arch,              \
+    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE32(arch,              \
         SIMDPP_DISPATCH_15_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE3,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSSE3,                                       \
         SIMDPP_DISPATCH_15_NS_ID_SSE4_1,                                      \
+        SIMDPP_DISPATCH_15_NS_ID_SSE4_2,                                      \
         SIMDPP_DISPATCH_15_NS_ID_POPCNT_INSN,                                 \
         SIMDPP_DISPATCH_15_NS_ID_AVX,                                         \
         SIMDPP_DISPATCH_15_NS_ID_AVX2,                                        \
         SIMDPP_DISPATCH_15_NS_ID_AVX512F,                                     \
         SIMDPP_DISPATCH_15_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512DQ,                                    \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512CD,                                    \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_F16C,                                        \
         SIMDPP_DISPATCH_15_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_15_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_15_NS_ID_XOP,                                         \
+        SIMDPP_DISPATCH_15_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_BMI2,                                        \
         SIMDPP_DISPATCH_15_NS_ID_NEON,                                        \
         SIMDPP_DISPATCH_15_NS_ID_NEON_FLT_SP,                                 \
+        SIMDPP_DISPATCH_15_NS_ID_NEON_DOTPROD,                                \
+        SIMDPP_DISPATCH_15_NS_ID_SVE,                                         \
         SIMDPP_DISPATCH_15_NS_ID_MSA,                                         \
         SIMDPP_DISPATCH_15_NS_ID_ALTIVEC,                                     \
         SIMDPP_DISPATCH_15_NS_ID_VSX_206,                                     \
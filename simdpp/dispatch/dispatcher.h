@@ -12,7 +12,7 @@
     #error "This file must be included through simd.h"
 #endif
 
-#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <simdpp/dispatch/arch.h>
 
@@ -31,8 +31,11 @@ namespace simdpp {
     @c SIMDPP_MAKE_DISPATCHER_* expansion.
 
     The function identified by the @c SIMDPP_USER_ARCH_INFO is called at the
-    first time the specific dispatcher is invoked. The user must ensure that
-    proper synchronization is used if the dispatcher is called concurrently.
+    first time the specific dispatcher is invoked. If the dispatcher is first
+    invoked concurrently from several threads, the function may be called
+    more than once, thus it must be thread-safe and must return the same
+    value on each call. The subsequent invocations of the dispatcher do not
+    call the function.
 
     The user must ensure that the returned information is sensible: e.g. SSE2
     must be supported if SSE3 support is indicated.
@@ -41,6 +44,22 @@ namespace simdpp {
     implementations of CPU features detection.
 */
 
+/** @def SIMDPP_USER_PREFER_VECTOR_WIDTH
+    Specifies the maximum vector width in bits that the versions selected by
+    the dispatchers defined by @c SIMDPP_MAKE_DISPATCHER_* should preferably
+    use. Possible values are 128, 256 and 512. The versions that use wider
+    vectors are selected only if no version fitting the preference is
+    supported by the processor. The macro may be redefined before each site of
+    @c SIMDPP_MAKE_DISPATCHER_* expansion, similarly to
+    @c SIMDPP_USER_ARCH_INFO.
+
+    If the macro is not defined or is defined to 0, the global preference
+    as returned by get_dispatch_prefer_vector_width() is used.
+*/
+#ifndef SIMDPP_USER_PREFER_VECTOR_WIDTH
+#define SIMDPP_USER_PREFER_VECTOR_WIDTH 0
+#endif
+
 namespace detail {
 
 using VoidFunPtr = void (*)();
@@ -67,29 +86,70 @@ struct FnVersion {
     const char* arch_name;
 };
 
-inline FnVersion select_version_any(FnVersion* versions, unsigned size,
+/*  Returns the supported version with the highest instruction set
+    requirements or nullptr if none of the versions is supported.
+*/
+inline FnVersion* find_best_version(FnVersion* versions, unsigned size,
                                     Arch arch)
 {
-    // No need to try to be very efficient here.
-    std::sort(versions, versions + size,
-              [](const FnVersion& lhs, const FnVersion& rhs) {
-                  return lhs.needed_arch > rhs.needed_arch;
-              });
-
-    unsigned i;
-    for (i = 0; i < size; ++i) {
+    FnVersion* best = nullptr;
+    for (unsigned i = 0; i < size; ++i) {
         if (versions[i].fun_ptr == nullptr)
             continue;
-        if (test_arch_subset(arch, versions[i].needed_arch)) {
-            break;
-        }
+        if (!test_arch_subset(arch, versions[i].needed_arch))
+            continue;
+        if (best == nullptr || versions[i].needed_arch > best->needed_arch)
+            best = versions + i;
     }
-    if (i == size) {
+    return best;
+}
+
+inline FnVersion select_version_any(FnVersion* versions, unsigned size,
+                                    Arch arch)
+{
+    // Pick the supported version with the highest instruction set
+    // requirements. This runs only once per dispatcher.
+    FnVersion* best = find_best_version(versions, size, arch);
+    if (best == nullptr) {
         // The user didn't provide the NONE_NULL version and no SIMD
         // architecture is supported. We can't do anything except to abort
         std::abort();
     }
-    return versions[i];
+    return *best;
+}
+
+/*  Returns the mask of instruction sets whose versions don't use vectors
+    wider than @a bits bits. Zero means no limit. The instruction sets that
+    don't widen the vectors, such as FMA3 or POPCNT, are never masked.
+*/
+inline Arch get_arch_mask_for_vector_width(unsigned bits)
+{
+    Arch mask = static_cast<Arch>(~std::uint32_t(0));
+    if (bits == 0 || bits >= 512)
+        return mask;
+    mask &= ~(Arch::X86_AVX512F | Arch::X86_AVX512BW | Arch::X86_AVX512DQ |
+              Arch::X86_AVX512VL | Arch::X86_AVX512CD | Arch::X86_AVX512VBMI |
+              Arch::X86_AVX512VPOPCNTDQ | Arch::X86_AVX512VNNI);
+    if (bits >= 256)
+        return mask;
+    mask &= ~(Arch::X86_AVX | Arch::X86_AVX2);
+    return mask;
+}
+
+/*  Same as select_version_any, except that the versions that use vectors
+    not wider than @a preferred_width bits are preferred. For example, on
+    some x86 processors the use of 512-bit instructions lowers the clock
+    frequency of the core for some time, which slows down the surrounding
+    code. If none of such versions is supported, the preference is ignored.
+*/
+inline FnVersion select_version_preferred(FnVersion* versions, unsigned size,
+                                          Arch arch, unsigned preferred_width)
+{
+    Arch narrow_arch = arch & get_arch_mask_for_vector_width(preferred_width);
+    FnVersion* best = find_best_version(versions, size, narrow_arch);
+    if (best != nullptr)
+        return *best;
+    return select_version_any(versions, size, arch);
 }
 
 } // namespace detail
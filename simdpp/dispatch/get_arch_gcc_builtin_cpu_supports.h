@@ -8,7 +8,7 @@
 #ifndef LIBSIMDPP_DISPATCH_GET_ARCH_GCC_BUILTIN_CPU_SUPPORTS_H
 #define LIBSIMDPP_DISPATCH_GET_ARCH_GCC_BUILTIN_CPU_SUPPORTS_H
 
-#if ((__GNUC__ >= 4) && (__GNUC_MINOR__ >= 8)) && (__i386__ || __amd64__)
+#if ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8))) && (__i386__ || __amd64__)
 #define SIMDPP_HAS_GET_ARCH_GCC_BUILTIN_CPU_SUPPORTS 1
 
 #include <simdpp/dispatch/arch.h>
@@ -20,7 +20,7 @@ namespace simdpp {
 */
 inline Arch get_arch_gcc_builtin_cpu_supports()
 {
-    Arch arch_info;
+    Arch arch_info = Arch::NONE_NULL;
 #if (__GNUC__ > 4)
     if (__builtin_cpu_supports("avx512f")) { // since 5.0
         arch_info |= Arch::X86_SSE2;
@@ -61,8 +61,40 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
     } else if (__builtin_cpu_supports("sse2")) {
         arch_info |= Arch::X86_SSE2;
     }
+    if (__builtin_cpu_supports("sse4.2"))
+        arch_info |= Arch::X86_SSE4_2;
     if (__builtin_cpu_supports("popcnt"))
         arch_info |= Arch::X86_POPCNT_INSN;
+#if (__GNUC__ >= 11)
+    if (__builtin_cpu_supports("f16c") && __builtin_cpu_supports("avx")) // since 11.0
+        arch_info |= Arch::X86_F16C;
+#endif
+#if (__GNUC__ >= 6)
+    if (test_arch_subset(arch_info, Arch::X86_AVX512F)) { // since 6.0
+        if (__builtin_cpu_supports("avx512bw"))
+            arch_info |= Arch::X86_AVX512BW;
+        if (__builtin_cpu_supports("avx512dq"))
+            arch_info |= Arch::X86_AVX512DQ;
+        if (__builtin_cpu_supports("avx512vl"))
+            arch_info |= Arch::X86_AVX512VL;
+        if (__builtin_cpu_supports("avx512cd"))
+            arch_info |= Arch::X86_AVX512CD;
+        if (__builtin_cpu_supports("avx512vbmi"))
+            arch_info |= Arch::X86_AVX512VBMI | Arch::X86_AVX512BW;
+#if (__GNUC__ >= 8)
+        if (__builtin_cpu_supports("avx512vpopcntdq")) // since 8.0
+            arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+        if (__builtin_cpu_supports("avx512vnni"))
+            arch_info |= Arch::X86_AVX512VNNI;
+#endif
+    }
+    if (__builtin_cpu_supports("bmi2"))
+        arch_info |= Arch::X86_BMI2;
+#endif
+#if (__GNUC__ >= 8)
+    if (__builtin_cpu_supports("gfni")) // since 8.0
+        arch_info |= Arch::X86_GFNI;
+#endif
 
     return arch_info;
 }
@@ -40,14 +40,19 @@ inline Arch get_arch_linux_cpuinfo()
 #elif __aarch64__
     ident = "Features\t";
     features["asimd"] = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP;
+    features["asimddp"] = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP |
+                          Arch::ARM_NEON_DOTPROD;
+    features["sve"] = Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP | Arch::ARM_SVE;
 
 #elif __i386__ || __amd64__
     Arch a_sse2 = Arch::X86_SSE2;
     Arch a_sse3 = a_sse2 | Arch::X86_SSE3;
     Arch a_ssse3 = a_sse3 | Arch::X86_SSSE3;
     Arch a_sse4_1 = a_ssse3 | Arch::X86_SSE4_1;
+    Arch a_sse4_2 = a_sse4_1 | Arch::X86_SSE4_2;
     Arch a_popcnt = Arch::X86_POPCNT_INSN;
     Arch a_avx = a_sse4_1 | Arch::X86_AVX;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
     Arch a_avx2 = a_avx | Arch::X86_AVX2;
     Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
     Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
@@ -55,13 +60,22 @@ inline Arch get_arch_linux_cpuinfo()
     Arch a_avx512f = a_avx2 | Arch::X86_AVX512F;
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
+    Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512cd = a_avx512f | Arch::X86_AVX512CD;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_gfni = a_sse2 | Arch::X86_GFNI;
+    Arch a_bmi2 = Arch::X86_BMI2;
 
     ident = "flags\t";
     features["sse2"] = a_sse2;
     features["pni"] = a_sse3;
     features["ssse3"] = a_ssse3;
     features["sse4_1"] = a_sse4_1;
+    features["sse4_2"] = a_sse4_2;
     features["avx"] = a_avx;
+    features["f16c"] = a_f16c;
     features["avx2"] = a_avx2;
     features["popcnt"] = a_popcnt;
     features["fma"] = a_fma3;
@@ -70,6 +84,13 @@ inline Arch get_arch_linux_cpuinfo()
     features["avx512f"] = a_avx512f;
     features["avx512bw"] = a_avx512bw;
     features["avx512dq"] = a_avx512dq;
+    features["avx512vl"] = a_avx512vl;
+    features["avx512cd"] = a_avx512cd;
+    features["avx512vbmi"] = a_avx512vbmi;
+    features["avx512_vpopcntdq"] = a_avx512vpopcntdq;
+    features["avx512_vnni"] = a_avx512vnni;
+    features["gfni"] = a_gfni;
+    features["bmi2"] = a_bmi2;
 #else
     return res;
 #endif
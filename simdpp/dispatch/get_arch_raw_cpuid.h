@@ -100,6 +100,7 @@ inline Arch get_arch_raw_cpuid()
 
     uint32_t eax, ebx, ecx, edx;
     bool xsave_xrstore_avail = false;
+    bool avx512_state_avail = false;
 
     simdpp::detail::get_cpuid(0, 0, &eax, &ebx, &ecx, &edx);
     unsigned max_cpuid_level = eax;
@@ -120,6 +121,8 @@ inline Arch get_arch_raw_cpuid()
             arch_info |= Arch::X86_SSSE3;
         if (ecx & (1 << 19))
             arch_info |= Arch::X86_SSE4_1;
+        if (ecx & (1 << 20))
+            arch_info |= Arch::X86_SSE4_2;
         if (ecx & (1 << 20) && mfg == simdpp::detail::CPU_INTEL)
             arch_info |= Arch::X86_POPCNT_INSN; // popcnt is included in SSE4.2 on Intel
         if (ecx & (1 << 23))
@@ -131,10 +134,16 @@ inline Arch get_arch_raw_cpuid()
             uint64_t xcr = simdpp::detail::get_xcr(0);
             if ((xcr & 6) == 6)
                 xsave_xrstore_avail = true;
+            // The OS must also save the opmask and the upper halves of ZMM
+            // registers for AVX-512 to be usable
+            if ((xcr & 0xe6) == 0xe6)
+                avx512_state_avail = true;
         }
 
         if (ecx & (1 << 28) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX;
+        if (ecx & (1 << 29) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_F16C;
     }
     if (max_ex_cpuid_level >= 0x80000001) {
         simdpp::detail::get_cpuid(0x80000001, 0, &eax, &ebx, &ecx, &edx);
@@ -148,12 +157,26 @@ inline Arch get_arch_raw_cpuid()
         simdpp::detail::get_cpuid(0x00000007, 0, &eax, &ebx, &ecx, &edx);
         if (ebx & (1 << 5) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX2;
-        if (ebx & (1 << 16) && xsave_xrstore_avail)
+        if (ebx & (1 << 8))
+            arch_info |= Arch::X86_BMI2;
+        if (ebx & (1 << 16) && avx512_state_avail)
             arch_info |= Arch::X86_AVX512F;
-        if (ebx & (1 << 30) && xsave_xrstore_avail)
+        if (ebx & (1 << 30) && avx512_state_avail)
             arch_info |= Arch::X86_AVX512BW;
-        if (ebx & (1 << 17) && xsave_xrstore_avail)
+        if (ebx & (1 << 17) && avx512_state_avail)
             arch_info |= Arch::X86_AVX512DQ;
+        if (ebx & (1 << 31) && avx512_state_avail)
+            arch_info |= Arch::X86_AVX512VL;
+        if (ebx & (1 << 28) && avx512_state_avail)
+            arch_info |= Arch::X86_AVX512CD;
+        if (ecx & (1 << 1) && avx512_state_avail)
+            arch_info |= Arch::X86_AVX512VBMI;
+        if (ecx & (1 << 14) && avx512_state_avail)
+            arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+        if (ecx & (1 << 11) && avx512_state_avail)
+            arch_info |= Arch::X86_AVX512VNNI;
+        if (ecx & (1 << 8))
+            arch_info |= Arch::X86_GFNI;
     }
 
     return arch_info;
@@ -40,27 +40,45 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
 #elif SIMDPP_ARM && SIMDPP_64_BITS
     features.emplace_back("neon", Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP);
     features.emplace_back("neonfltsp", Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP);
+    features.emplace_back("neondotprod", Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP |
+                                         Arch::ARM_NEON_DOTPROD);
+    features.emplace_back("sve", Arch::ARM_NEON | Arch::ARM_NEON_FLT_SP |
+                                 Arch::ARM_SVE);
 #elif SIMDPP_X86
     Arch a_sse2 = Arch::X86_SSE2;
     Arch a_sse3 = a_sse2 | Arch::X86_SSE3;
     Arch a_ssse3 = a_sse3 | Arch::X86_SSSE3;
     Arch a_sse4_1 = a_ssse3 | Arch::X86_SSE4_1;
+    Arch a_sse4_2 = a_sse4_1 | Arch::X86_SSE4_2;
     Arch a_popcnt = Arch::X86_POPCNT_INSN;
     Arch a_avx = a_sse4_1 | Arch::X86_AVX;
-    Arch a_avx2 = a_avx | Arch::X86_AVX2;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
     Arch a_fma3 = a_sse3 | Arch::X86_FMA3;
+    // All processors that support AVX2 also support FMA3, F16C, SSE4.2 and
+    // POPCNT. The AVX2 configuration built by simdpp_get_compilable_archs()
+    // requires them too, thus "avx2" alone must be enough to select it.
+    Arch a_avx2 = a_f16c | a_sse4_2 | a_fma3 | a_popcnt | Arch::X86_AVX2;
     Arch a_fma4 = a_sse3 | Arch::X86_FMA4;
     Arch a_xop = a_sse3 | Arch::X86_XOP;
     Arch a_avx512f = a_avx2 | Arch::X86_AVX512F;
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
+    Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512cd = a_avx512f | Arch::X86_AVX512CD;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_gfni = a_sse2 | Arch::X86_GFNI;
+    Arch a_bmi2 = Arch::X86_BMI2;
 
     features.emplace_back("sse2", a_sse2);
     features.emplace_back("sse3", a_sse3);
     features.emplace_back("ssse3", a_ssse3);
     features.emplace_back("sse4p1", a_sse4_1);
+    features.emplace_back("sse4p2", a_sse4_2);
     features.emplace_back("popcnt", a_popcnt);
     features.emplace_back("avx", a_avx);
+    features.emplace_back("f16c", a_f16c);
     features.emplace_back("avx2", a_avx2);
     features.emplace_back("fma3", a_fma3);
     features.emplace_back("fma4", a_fma4);
@@ -68,6 +86,13 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     features.emplace_back("avx512f", a_avx512f);
     features.emplace_back("avx512bw", a_avx512bw);
     features.emplace_back("avx512dq", a_avx512dq);
+    features.emplace_back("avx512vl", a_avx512vl);
+    features.emplace_back("avx512cd", a_avx512cd);
+    features.emplace_back("avx512vbmi", a_avx512vbmi);
+    features.emplace_back("avx512vpopcntdq", a_avx512vpopcntdq);
+    features.emplace_back("avx512vnni", a_avx512vnni);
+    features.emplace_back("gfni", a_gfni);
+    features.emplace_back("bmi2", a_bmi2);
 #elif SIMDPP_PPC
     Arch a_altivec = Arch::POWER_ALTIVEC;
     Arch a_vsx_206 = a_altivec | Arch::POWER_VSX_206;
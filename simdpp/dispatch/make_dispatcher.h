@@ -12,11 +12,37 @@
 #include <simdpp/detail/preprocessor/punctuation/remove_parens.hpp>
 #include <simdpp/detail/preprocessor/seq/for_each.hpp>
 #include <simdpp/detail/preprocessor/variadic/to_seq.hpp>
+#include <cstdlib> // defines __GLIBC__
+
+/** @def SIMDPP_HAS_IFUNC
+    Set to 1 if the dispatchers can be implemented using GNU indirect
+    functions (STT_GNU_IFUNC symbols resolved by the dynamic loader), 0
+    otherwise. Indirect functions are supported on ELF targets using glibc
+    when compiling with GCC or Clang.
+*/
+#if defined(__ELF__) && defined(__GLIBC__) && (__GNUC__ || __clang__) && \
+    !__INTEL_COMPILER && !defined(__ANDROID__)
+    #define SIMDPP_HAS_IFUNC 1
+#else
+    #define SIMDPP_HAS_IFUNC 0
+#endif
+
+/** @def SIMDPP_DISPATCH_USE_IFUNC
+    If defined to 1 before simd.h is included and indirect functions are
+    supported (see SIMDPP_HAS_IFUNC), the dispatchers of non-template
+    functions defined by SIMDPP_MAKE_DISPATCHER are implemented as indirect
+    functions. See SIMDPP_MAKE_DISPATCHER_IFUNC for details. The dispatchers
+    of template functions always use the cached function pointer.
+*/
+#ifndef SIMDPP_DISPATCH_USE_IFUNC
+    #define SIMDPP_DISPATCH_USE_IFUNC 0
+#endif
 
 #if SIMDPP_EMIT_DISPATCHER
 #include <simdpp/detail/preprocessor/punctuation/comma_if.hpp>
 #include <simdpp/detail/preprocessor/seq/elem.hpp>
 #include <simdpp/detail/preprocessor/seq/for_each_i.hpp>
+#include <simdpp/detail/preprocessor/stringize.hpp>
 #include <simdpp/detail/preprocessor/tuple/rem.hpp>
 #include <simdpp/dispatch/collect_macros_generated.h>
 
@@ -268,19 +294,106 @@ SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)
 SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))                       \
 {                                                                               \
     using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
-    static FunPtr selected = nullptr;                                           \
+    static ::simdpp::detail::DispatchCache<FunPtr>                              \
+        cache(SIMDPP_PP_STRINGIZE(NAME));                                       \
+    FunPtr selected = cache.get();                                              \
     if (selected == nullptr) {                                                  \
         ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};   \
         SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions,                             \
             (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr)              \
-        ::simdpp::detail::FnVersion version =                                   \
-            ::simdpp::detail::select_version_any(versions,                      \
-                SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO);              \
-        selected = reinterpret_cast<FunPtr>(version.fun_ptr);                   \
+        selected = cache.resolve(versions, SIMDPP_DISPATCH_MAX_ARCHS,           \
+                                 SIMDPP_USER_ARCH_INFO,                         \
+                                 SIMDPP_USER_PREFER_VECTOR_WIDTH);              \
+    }                                                                           \
+    SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R) selected(SIMDPP_DETAIL_FORWARD(ARGS));  \
+}
+
+#if SIMDPP_HAS_IFUNC
+
+#define SIMDPP_DETAIL_IFUNC_RESOLVER(NAME) SIMDPP_PP_CAT(simdpp_ifunc_resolve_, NAME)
+
+// __builtin_cpu_supports requires explicit initialization when called before
+// the constructors have run
+#if SIMDPP_X86
+    #define SIMDPP_DETAIL_IFUNC_CPU_INIT() __builtin_cpu_init();
+#else
+    #define SIMDPP_DETAIL_IFUNC_CPU_INIT()
+#endif
+
+// The resolver has C linkage so that its name can be referred to in the ifunc
+// attribute. It has internal linkage, thus the name needs to be unique only
+// within the translation unit.
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC_IMPL(R, NAME, ARGS)                 \
+                                                                                \
+SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
+    (SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_DETAIL_TYPES(ARGS))))              \
+                                                                                \
+extern "C" {                                                                    \
+static SIMDPP_PP_REMOVE_PARENS(R)                                               \
+    (*SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)())(SIMDPP_DETAIL_TYPES(ARGS))          \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    SIMDPP_DETAIL_IFUNC_CPU_INIT()                                              \
+    ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};       \
+    SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, (NAME), FunPtr)                 \
+    ::simdpp::detail::FnVersion version =                                       \
+        ::simdpp::detail::select_version_preferred(versions,                    \
+            SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO,                   \
+            SIMDPP_USER_PREFER_VECTOR_WIDTH);                                   \
+    static ::simdpp::detail::DispatchCacheBase info(SIMDPP_PP_STRINGIZE(NAME)); \
+    info.record(version);                                                       \
+    return reinterpret_cast<FunPtr>(version.fun_ptr);                           \
+}                                                                               \
+}                                                                               \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))                       \
+    __attribute__((ifunc(SIMDPP_PP_STRINGIZE(SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)))));
+
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC3(DESC)                              \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC_IMPL(                                   \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
+        SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))))
+
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC1(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC2(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC4(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC5(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+
+#endif // SIMDPP_HAS_IFUNC
+
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_AUTOTUNE_IMPL(R, NAME, ARGS, TUNER)      \
+                                                                                \
+SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
+    (SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_DETAIL_TYPES(ARGS))))              \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))                       \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    static ::simdpp::detail::AutotuneDispatchCache<FunPtr>                      \
+        cache(SIMDPP_PP_STRINGIZE(NAME));                                       \
+    FunPtr selected = cache.get();                                              \
+    if (selected == nullptr) {                                                  \
+        ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};   \
+        SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, (NAME), FunPtr)             \
+        selected = cache.resolve(versions, SIMDPP_DISPATCH_MAX_ARCHS,           \
+                                 SIMDPP_USER_ARCH_INFO, TUNER);                 \
     }                                                                           \
     SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R) selected(SIMDPP_DETAIL_FORWARD(ARGS));  \
 }
 
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_AUTOTUNE3(DESC, TUNER)                    \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_AUTOTUNE_IMPL(                                \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
+        SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))), \
+        TUNER)
+
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_AUTOTUNE1(DESC, TUNER) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_AUTOTUNE2(DESC, TUNER) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_AUTOTUNE4(DESC, TUNER) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_AUTOTUNE5(DESC, TUNER) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+
 #define SIMDPP_DETAIL_IGNORE_PARENS2(x)                                         \
     SIMDPP_DETAIL_IGNORE_PARENS(SIMDPP_DETAIL_IGNORE_PARENS(x))
 
@@ -298,7 +411,7 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
 // so we use a workaround
 #define SIMDPP_DETAIL_MAKE_DISPATCHER1(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 #define SIMDPP_DETAIL_MAKE_DISPATCHER2(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
-#define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC)                                    \
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_PTR3(DESC)                                \
     SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(                                         \
         (),                                                                     \
         (),                                                                     \
@@ -306,6 +419,12 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
         SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))))
 
+#if SIMDPP_HAS_IFUNC && SIMDPP_DISPATCH_USE_IFUNC
+#define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC) SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC3(DESC)
+#else
+#define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC) SIMDPP_DETAIL_MAKE_DISPATCHER_PTR3(DESC)
+#endif
+
 #define SIMDPP_DETAIL_MAKE_DISPATCHER4(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 #define SIMDPP_DETAIL_MAKE_DISPATCHER5(DESC)                                    \
     SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(                                         \
@@ -362,8 +481,10 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
     implements the dispatch mechanism.
 
     The dispatch functions check the enabled instruction set and select the
-    best function on first call. The initialization does not introduce race
-    conditions when done concurrently.
+    best function on first call. The selected function pointer is cached in an
+    atomic variable, so the initialization does not introduce race conditions
+    when done concurrently and does not take any locks. Subsequent calls cost
+    a single load and an indirect call.
 
     The generated dispatching code links to all versions of the dispatched
     function statically, so techniques to prevent linkers from stripping
@@ -371,8 +492,82 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
 */
 #define SIMDPP_MAKE_DISPATCHER(DESC)                                            \
     SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_DISPATCHER, SIMDPP_PP_SEQ_SIZE(DESC))(DESC)
+
+/** Builds a dispatcher for a specific non-member non-template function using
+    a GNU indirect function. The macro accepts the same arguments as
+    SIMDPP_MAKE_DISPATCHER except that the template prefix and template
+    argument list must not be present.
+
+    The version of the function is selected by the dynamic loader when the
+    binary is loaded, thus the calls go directly through PLT/GOT without any
+    checks in the dispatcher and without a first-call penalty. The selection
+    logic is the same as in SIMDPP_MAKE_DISPATCHER.
+
+    The function identified by SIMDPP_USER_ARCH_INFO is called while the
+    relocations are processed, that is, before any static constructors have
+    run. It must not depend on any initialized global state;
+    get_arch_raw_cpuid() and get_arch_gcc_builtin_cpu_supports() are
+    suitable. For the same reason the mask set via the SIMDPP_DISPATCH_ARCH
+    environment variable or set_dispatch_arch_mask() and the global preferred
+    vector width are not applied. SIMDPP_USER_PREFER_VECTOR_WIDTH is
+    respected. The selected version is still listed by get_dispatch_info().
+    The resolver of the indirect function is named simdpp_ifunc_resolve_NAME,
+    thus the same function name can't be dispatched in several namespaces in
+    the same translation unit.
+
+    If indirect functions are not supported (see SIMDPP_HAS_IFUNC), the macro
+    falls back to SIMDPP_MAKE_DISPATCHER.
+*/
+#if SIMDPP_HAS_IFUNC
+#define SIMDPP_MAKE_DISPATCHER_IFUNC(DESC)                                      \
+    SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC, SIMDPP_PP_SEQ_SIZE(DESC))(DESC)
+#else
+#define SIMDPP_MAKE_DISPATCHER_IFUNC(DESC) SIMDPP_MAKE_DISPATCHER(DESC)
+#endif
+
+/** Builds a dispatcher for a specific non-member non-template function that
+    selects the fastest version by timing all candidates. The first argument
+    is the same as that of SIMDPP_MAKE_DISPATCHER except that the template
+    prefix and template argument list must not be present.
+
+    @a TUNER must be an expression convertible to a pointer to function that
+    accepts a pointer to the dispatched function and calls it on
+    representative input, for example:
+
+    @code
+    void tune_sum(float (*f)(const float*, unsigned))
+    {
+        static std::vector<float> data(4096, 1.0f);
+        f(data.data(), data.size());
+    }
+    SIMDPP_MAKE_DISPATCHER_AUTOTUNE((float)(sum)((const float*) p, (unsigned) n),
+                                    tune_sum)
+    @endcode
+
+    On the first call, the tuner is invoked several times with each version
+    of the function that is supported by the processor and allowed by the
+    dispatch arch mask (see set_dispatch_arch_mask()). The version with the
+    shortest run time is selected. The preferred vector width is ignored.
+    This is useful for kernels for which the widest supported instruction set
+    is not the fastest on some microarchitectures, e.g. gather-heavy code.
+
+    If the SIMDPP_AUTOTUNE_CACHE environment variable is set to the path of a
+    file, the decision is appended to that file together with the processor
+    model and is reused by subsequent runs of the program on the same
+    processor model without timing the versions again. The file is created if
+    it does not exist.
+
+    If the dispatcher is first invoked concurrently from several threads, the
+    versions may be timed more than once and different threads may select
+    different versions.
+*/
+#define SIMDPP_MAKE_DISPATCHER_AUTOTUNE(DESC, TUNER)                            \
+    SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_DISPATCHER_AUTOTUNE,                       \
+                  SIMDPP_PP_SEQ_SIZE(DESC))(DESC, TUNER)
 #else // #if SIMDPP_EMIT_DISPATCHER
 #define SIMDPP_MAKE_DISPATCHER(DESC)
+#define SIMDPP_MAKE_DISPATCHER_IFUNC(DESC)
+#define SIMDPP_MAKE_DISPATCHER_AUTOTUNE(DESC, TUNER)
 #endif
 
 #define SIMDPP_DETAIL_SIGNATURE_EACH(r, data, x) SIMDPP_PP_REMOVE_PARENS(x) ;
@@ -59,6 +59,9 @@ static inline Arch this_compile_arch()
 #if SIMDPP_ARCH_PP_USE_SSE4_1
     res |= Arch::X86_SSE4_1;
 #endif
+#if SIMDPP_ARCH_PP_USE_SSE4_2
+    res |= Arch::X86_SSE4_2;
+#endif
 #if SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN
     res |= Arch::X86_POPCNT_INSN;
 #endif
@@ -86,12 +89,42 @@ static inline Arch this_compile_arch()
 #if SIMDPP_ARCH_PP_USE_AVX512DQ
     res |= Arch::X86_AVX512DQ;
 #endif
+#if SIMDPP_ARCH_PP_USE_F16C
+    res |= Arch::X86_F16C;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VL
+    res |= Arch::X86_AVX512VL;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+    res |= Arch::X86_AVX512CD;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+    res |= Arch::X86_AVX512VBMI;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+    res |= Arch::X86_AVX512VPOPCNTDQ;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+    res |= Arch::X86_AVX512VNNI;
+#endif
+#if SIMDPP_ARCH_PP_USE_GFNI
+    res |= Arch::X86_GFNI;
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI2
+    res |= Arch::X86_BMI2;
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
     res |= Arch::ARM_NEON;
 #endif
 #if SIMDPP_ARCH_PP_USE_NEON_FLT_SP
     res |= Arch::ARM_NEON_FLT_SP;
 #endif
+#if SIMDPP_ARCH_PP_USE_NEON_DOTPROD
+    res |= Arch::ARM_NEON_DOTPROD;
+#endif
+#if SIMDPP_ARCH_PP_USE_SVE
+    res |= Arch::ARM_SVE;
+#endif
 #if SIMDPP_ARCH_PP_USE_ALTIVEC
     res |= Arch::POWER_ALTIVEC;
 #endif
@@ -0,0 +1,284 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_REGISTRY_H
+#define LIBSIMDPP_DISPATCH_REGISTRY_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <simdpp/dispatch/arch.h>
+#include <simdpp/dispatch/dispatcher.h>
+#include <simdpp/dispatch/get_arch_string_list.h>
+
+namespace simdpp {
+namespace detail {
+
+/*  Parses the value of the SIMDPP_DISPATCH_ARCH environment variable. The
+    variable contains a list of instruction set ids as accepted by
+    get_arch_string_list() separated by commas or spaces. If the variable is
+    not set, all instruction sets are allowed.
+*/
+inline Arch get_dispatch_arch_mask_from_env()
+{
+    const char* env = std::getenv("SIMDPP_DISPATCH_ARCH");
+    if (env == nullptr)
+        return static_cast<Arch>(~std::uint32_t(0));
+
+    std::string value = env;
+    std::vector<const char*> ids;
+    char* token = nullptr;
+    for (char& c : value) {
+        if (c == ',' || c == ' ') {
+            c = '\0';
+            token = nullptr;
+        } else if (token == nullptr) {
+            token = &c;
+            ids.push_back(token);
+        }
+    }
+    return get_arch_string_list(ids.data(), int(ids.size()), "");
+}
+
+inline std::atomic<std::uint32_t>& dispatch_arch_mask_storage()
+{
+    static std::atomic<std::uint32_t> mask(
+            static_cast<std::uint32_t>(get_dispatch_arch_mask_from_env()));
+    return mask;
+}
+
+/*  Parses the value of the SIMDPP_DISPATCH_PREFER_VECTOR_WIDTH environment
+    variable. Returns zero, i.e. no preference, if the variable is not set or
+    is not a number.
+*/
+inline unsigned get_dispatch_prefer_vector_width_from_env()
+{
+    const char* env = std::getenv("SIMDPP_DISPATCH_PREFER_VECTOR_WIDTH");
+    if (env == nullptr)
+        return 0;
+    return unsigned(std::strtoul(env, nullptr, 10));
+}
+
+inline std::atomic<unsigned>& dispatch_prefer_vector_width_storage()
+{
+    static std::atomic<unsigned> width(
+            get_dispatch_prefer_vector_width_from_env());
+    return width;
+}
+
+class DispatchCacheBase;
+
+/*  The head of the intrusive singly-linked list of all dispatchers that
+    have resolved their function. Entries are only ever prepended.
+*/
+inline std::atomic<DispatchCacheBase*>& dispatch_registry_head()
+{
+    static std::atomic<DispatchCacheBase*> head(nullptr);
+    return head;
+}
+
+/*  Holds the function pointer selected by a dispatcher. The pointer is
+    published atomically, so that the dispatcher can be invoked concurrently
+    without external synchronization. Once the pointer has been resolved,
+    each invocation costs a single load and an indirect call.
+
+    On the first resolution the dispatcher adds itself to the dispatcher
+    registry so that the selected versions can be queried using
+    get_dispatch_info().
+
+    The constructor is constexpr, thus function-local static variables of
+    this type are initialized statically and don't need a guard variable.
+*/
+class DispatchCacheBase {
+public:
+    constexpr DispatchCacheBase(const char* name) :
+        name_(name), arch_name_(nullptr), next_(nullptr), ptr_(nullptr),
+        registered_(false) {}
+
+    const char* name() const { return name_; }
+    const char* arch_name() const
+    {
+        return arch_name_.load(std::memory_order_acquire);
+    }
+    DispatchCacheBase* next() const { return next_; }
+
+    // Forces the dispatcher to select the version again on the next call
+    void reset() { ptr_.store(nullptr, std::memory_order_release); }
+
+    /*  Records @a version as selected and adds the dispatcher to the
+        registry. Does not allocate and does not depend on any initialized
+        global state, thus may be called from indirect function resolvers.
+    */
+    void record(const FnVersion& version)
+    {
+        arch_name_.store(version.arch_name, std::memory_order_release);
+        if (registered_.exchange(true, std::memory_order_acq_rel))
+            return;
+        std::atomic<DispatchCacheBase*>& head = dispatch_registry_head();
+        next_ = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(next_, this,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+        }
+    }
+
+protected:
+    /*  Selects the version to use out of @a versions taking the dispatch
+        arch mask and the preferred vector width into account and publishes
+        it. @a prefer_width overrides the global preferred vector width unless
+        it is zero. If several threads race to resolve the same dispatcher,
+        all of them select the same version, so it does not matter which
+        store wins.
+    */
+    VoidFunPtr resolve_any(FnVersion* versions, unsigned size, Arch arch,
+                           unsigned prefer_width)
+    {
+        arch &= static_cast<Arch>(dispatch_arch_mask_storage().load());
+        if (prefer_width == 0)
+            prefer_width = dispatch_prefer_vector_width_storage().load();
+        FnVersion version = select_version_preferred(versions, size, arch,
+                                                     prefer_width);
+        return publish_version(version);
+    }
+
+    // Records @a version as selected and publishes its function pointer
+    VoidFunPtr publish_version(const FnVersion& version)
+    {
+        record(version);
+        ptr_.store(version.fun_ptr, std::memory_order_release);
+        return version.fun_ptr;
+    }
+
+    const char* name_;
+    std::atomic<const char*> arch_name_;
+    DispatchCacheBase* next_;
+    std::atomic<VoidFunPtr> ptr_;
+    std::atomic<bool> registered_;
+};
+
+template<class FunPtr>
+class DispatchCache : public DispatchCacheBase {
+public:
+    constexpr DispatchCache(const char* name) : DispatchCacheBase(name) {}
+
+    FunPtr get() const
+    {
+        return reinterpret_cast<FunPtr>(ptr_.load(std::memory_order_acquire));
+    }
+
+    FunPtr resolve(FnVersion* versions, unsigned size, Arch arch,
+                   unsigned prefer_width)
+    {
+        return reinterpret_cast<FunPtr>(resolve_any(versions, size, arch,
+                                                    prefer_width));
+    }
+};
+
+inline void reset_all_dispatchers()
+{
+    DispatchCacheBase* d = dispatch_registry_head().load(std::memory_order_acquire);
+    for (; d != nullptr; d = d->next()) {
+        d->reset();
+    }
+}
+
+} // namespace detail
+
+/// Describes the version selected by a dispatcher
+struct DispatchInfo {
+    /// The name of the dispatched function
+    const char* name;
+    /// The name of the namespace of the selected version, e.g. "arch_sse2"
+    const char* arch_name;
+};
+
+/** Returns the list of dispatchers that have selected the version of their
+    function so far, that is, the dispatchers that have been called at least
+    once and all indirect function dispatchers (see
+    SIMDPP_MAKE_DISPATCHER_IFUNC). The function may be called concurrently with
+    the dispatchers.
+*/
+inline std::vector<DispatchInfo> get_dispatch_info()
+{
+    std::vector<DispatchInfo> res;
+    detail::DispatchCacheBase* d;
+    d = detail::dispatch_registry_head().load(std::memory_order_acquire);
+    for (; d != nullptr; d = d->next()) {
+        DispatchInfo info;
+        info.name = d->name();
+        info.arch_name = d->arch_name();
+        res.push_back(info);
+    }
+    return res;
+}
+
+/** Returns the mask that is applied to the instruction sets returned by
+    SIMDPP_USER_ARCH_INFO before a dispatcher selects the version of its
+    function. The initial value is taken from the SIMDPP_DISPATCH_ARCH
+    environment variable, which contains a list of instruction set ids
+    separated by commas or spaces, e.g. "avx2,fma3,popcnt". The ids are the
+    same as those accepted by get_arch_string_list(). Each id includes the
+    instruction sets that it depends on, thus "avx2" allows SSE2 to AVX2, but
+    not AVX-512. If the variable is not set, all bits of the mask are set.
+*/
+inline Arch get_dispatch_arch_mask()
+{
+    return static_cast<Arch>(detail::dispatch_arch_mask_storage().load());
+}
+
+/** Sets the mask of allowed instruction sets, see get_dispatch_arch_mask().
+    All dispatchers that have already selected their version are reset and
+    select it again on their next call. The calls that run concurrently may
+    still use the previously selected versions.
+
+    The dispatchers defined via SIMDPP_MAKE_DISPATCHER_IFUNC are resolved
+    before the program starts and are not affected by the mask.
+*/
+inline void set_dispatch_arch_mask(Arch mask)
+{
+    detail::dispatch_arch_mask_storage().store(static_cast<std::uint32_t>(mask));
+    detail::reset_all_dispatchers();
+}
+
+/** Returns the maximum vector width in bits that the dispatchers should
+    preferably use. This is similar to the -mprefer-vector-width option of
+    GCC and Clang: on some processors the use of wide vectors, especially
+    512-bit AVX-512 instructions, lowers the clock frequency of the core, which
+    may slow down the program as a whole even if the dispatched function
+    itself becomes faster. A dispatcher selects a version using wider vectors
+    only if no version fitting the preference is supported.
+
+    The initial value is taken from the SIMDPP_DISPATCH_PREFER_VECTOR_WIDTH
+    environment variable. Zero means no preference, which is the default. The
+    preference of individual dispatchers may be overridden by
+    SIMDPP_USER_PREFER_VECTOR_WIDTH.
+*/
+inline unsigned get_dispatch_prefer_vector_width()
+{
+    return detail::dispatch_prefer_vector_width_storage().load();
+}
+
+/** Sets the preferred maximum vector width in bits, see
+    get_dispatch_prefer_vector_width(). Possible values are 0 (no
+    preference), 128, 256 and 512. All dispatchers that have already selected
+    their version are reset as in set_dispatch_arch_mask().
+*/
+inline void set_dispatch_prefer_vector_width(unsigned bits)
+{
+    detail::dispatch_prefer_vector_width_storage().store(bits);
+    detail::reset_all_dispatchers();
+}
+
+} // namespace simdpp
+
+#endif
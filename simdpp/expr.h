@@ -258,6 +258,13 @@ struct expr_vec_load_u : expr_vec_construct<expr_vec_load_u> {
     expr_vec_load_u(const char* x) : a(x) {}
 };
 
+struct expr_vec_load_partial : expr_vec_construct<expr_vec_load_partial> {
+    const char* a;
+    unsigned n;
+
+    expr_vec_load_partial(const char* x, unsigned y) : a(x), n(y) {}
+};
+
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
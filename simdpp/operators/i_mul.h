@@ -76,6 +76,39 @@ typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
 
 SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(operator*, expr_mul_lo, any_int32, int32, uint32)
 
+/** Multiplies 64-bit values and returns the lower half of the result.
+
+    @code
+    r0 = low(a0 * b0)
+    ...
+    rN = low(aN * bN)
+    @endcode
+
+    The multiplication is composed of three 32x32-bit multiplications on
+    architectures that don't support 64-bit multiplication natively.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX512F, 8-12}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 16-24}
+    @icost{AVX2-AVX512F, 8}
+
+    @par 512-bit version:
+    @icost{AVX512F, 8}
+    @icost{AVX512DQ, 1}
+*/
+template<unsigned N, class V1, class V2> SIMDPP_INL
+typename detail::get_expr_uint<expr_mul_lo, V1, V2>::type
+        operator*(const any_int64<N,V1>& a,
+               const any_int64<N,V2>& b)
+{
+    using expr = typename detail::get_expr_uint<expr_mul_lo, V1, V2>;
+    return { { detail::cast_expr<typename expr::v1_type>(a.wrapped()),
+               detail::cast_expr<typename expr::v2_type>(b.wrapped()) } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_INT_UNSIGNED(operator*, expr_mul_lo, any_int64, int64, uint64)
 
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
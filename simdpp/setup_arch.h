@@ -41,6 +41,11 @@
 #else
 #define SIMDPP_USE_SSE4_1 0
 #endif
+#if SIMDPP_ARCH_PP_USE_SSE4_2
+#define SIMDPP_USE_SSE4_2 1
+#else
+#define SIMDPP_USE_SSE4_2 0
+#endif
 #if SIMDPP_ARCH_PP_USE_X86_POPCNT_INSN
 #define SIMDPP_USE_X86_POPCNT_INSN 1
 #else
@@ -86,6 +91,56 @@
 #else
 #define SIMDPP_USE_AVX512DQ 0
 #endif
+#if SIMDPP_ARCH_PP_USE_F16C
+#define SIMDPP_USE_F16C 1
+#else
+#define SIMDPP_USE_F16C 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VL
+#define SIMDPP_USE_AVX512VL 1
+#else
+#define SIMDPP_USE_AVX512VL 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+#define SIMDPP_USE_AVX512CD 1
+#else
+#define SIMDPP_USE_AVX512CD 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+#define SIMDPP_USE_AVX512VBMI 1
+#else
+#define SIMDPP_USE_AVX512VBMI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#define SIMDPP_USE_AVX512VPOPCNTDQ 1
+#else
+#define SIMDPP_USE_AVX512VPOPCNTDQ 0
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_USE_AVX512VNNI 1
+#else
+#define SIMDPP_USE_AVX512VNNI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_GFNI
+#define SIMDPP_USE_GFNI 1
+#else
+#define SIMDPP_USE_GFNI 0
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI2
+#define SIMDPP_USE_BMI2 1
+#else
+#define SIMDPP_USE_BMI2 0
+#endif
+#if SIMDPP_ARCH_PP_USE_NEON_DOTPROD
+#define SIMDPP_USE_NEON_DOTPROD 1
+#else
+#define SIMDPP_USE_NEON_DOTPROD 0
+#endif
+#if SIMDPP_ARCH_PP_USE_SVE
+#define SIMDPP_USE_SVE 1
+#else
+#define SIMDPP_USE_SVE 0
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
 #define SIMDPP_USE_NEON 1
 #else
@@ -144,6 +199,11 @@
 #else
 #define SIMDPP_NS_ID_SSE4_1
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+#define SIMDPP_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+#else
+#define SIMDPP_NS_ID_SSE4_2
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
 #define SIMDPP_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
 #else
@@ -189,6 +249,56 @@
 #else
 #define SIMDPP_NS_ID_AVX512DQ
 #endif
+#if SIMDPP_ARCH_PP_NS_USE_F16C
+#define SIMDPP_NS_ID_F16C SIMDPP_INSN_ID_F16C
+#else
+#define SIMDPP_NS_ID_F16C
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+#define SIMDPP_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+#else
+#define SIMDPP_NS_ID_AVX512VL
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#define SIMDPP_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+#else
+#define SIMDPP_NS_ID_AVX512CD
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#define SIMDPP_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+#else
+#define SIMDPP_NS_ID_AVX512VBMI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#define SIMDPP_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+#else
+#define SIMDPP_NS_ID_AVX512VPOPCNTDQ
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#define SIMDPP_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+#else
+#define SIMDPP_NS_ID_AVX512VNNI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_GFNI
+#define SIMDPP_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+#else
+#define SIMDPP_NS_ID_GFNI
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_BMI2
+#define SIMDPP_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+#else
+#define SIMDPP_NS_ID_BMI2
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+#define SIMDPP_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+#else
+#define SIMDPP_NS_ID_NEON_DOTPROD
+#endif
+#if SIMDPP_ARCH_PP_NS_USE_SVE
+#define SIMDPP_NS_ID_SVE SIMDPP_INSN_ID_SVE
+#else
+#define SIMDPP_NS_ID_SVE
+#endif
 #if SIMDPP_ARCH_PP_NS_USE_NEON
 #define SIMDPP_NS_ID_NEON SIMDPP_INSN_ID_NEON
 #else
@@ -220,23 +330,34 @@
 #define SIMDPP_NS_ID_MSA
 #endif
 
-#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE21(arch,                           \
+#define SIMDPP_ARCH_NAMESPACE SIMDPP_PP_PASTE32(arch,                           \
     SIMDPP_NS_ID_NULL,                                                          \
     SIMDPP_NS_ID_SSE2,                                                          \
     SIMDPP_NS_ID_SSE3,                                                          \
     SIMDPP_NS_ID_SSSE3,                                                         \
     SIMDPP_NS_ID_SSE4_1,                                                        \
+    SIMDPP_NS_ID_SSE4_2,                                                        \
     SIMDPP_NS_ID_POPCNT_INSN,                                                   \
     SIMDPP_NS_ID_AVX,                                                           \
     SIMDPP_NS_ID_AVX2,                                                          \
     SIMDPP_NS_ID_AVX512F,                                                       \
     SIMDPP_NS_ID_AVX512BW,                                                      \
     SIMDPP_NS_ID_AVX512DQ,                                                      \
+    SIMDPP_NS_ID_AVX512VL,                                                      \
+    SIMDPP_NS_ID_AVX512CD,                                                      \
+    SIMDPP_NS_ID_AVX512VBMI,                                                    \
+    SIMDPP_NS_ID_AVX512VPOPCNTDQ,                                               \
+    SIMDPP_NS_ID_AVX512VNNI,                                                    \
+    SIMDPP_NS_ID_F16C,                                                          \
     SIMDPP_NS_ID_FMA3,                                                          \
     SIMDPP_NS_ID_FMA4,                                                          \
     SIMDPP_NS_ID_XOP,                                                           \
+    SIMDPP_NS_ID_GFNI,                                                          \
+    SIMDPP_NS_ID_BMI2,                                                          \
     SIMDPP_NS_ID_NEON,                                                          \
     SIMDPP_NS_ID_NEON_FLT_SP,                                                   \
+    SIMDPP_NS_ID_NEON_DOTPROD,                                                  \
+    SIMDPP_NS_ID_SVE,                                                           \
     SIMDPP_NS_ID_MSA,                                                           \
     SIMDPP_NS_ID_ALTIVEC,                                                       \
     SIMDPP_NS_ID_VSX_206,                                                       \
@@ -266,6 +387,10 @@
     #include <smmintrin.h>
 #endif
 
+#if SIMDPP_USE_SSE4_2
+    #include <nmmintrin.h>
+#endif
+
 #if SIMDPP_USE_AVX
     #include <immintrin.h>
 #endif
@@ -278,6 +403,10 @@
     #include <immintrin.h>
 #endif
 
+#if SIMDPP_USE_F16C
+    #include <immintrin.h>
+#endif
+
 #if SIMDPP_USE_FMA4
     #include <x86intrin.h>
     #if SIMDPP_USE_FMA3
@@ -293,10 +422,18 @@
     #include <immintrin.h>
 #endif
 
+#if SIMDPP_USE_GFNI || SIMDPP_USE_BMI2
+    #include <immintrin.h>
+#endif
+
 #if SIMDPP_USE_NEON || SIMDPP_USE_NEON_FLT_SP
     #include <arm_neon.h>
 #endif
 
+#if SIMDPP_USE_SVE
+    #include <arm_sve.h>
+#endif
+
 #if SIMDPP_USE_ALTIVEC
     #include <altivec.h>
     #undef vector
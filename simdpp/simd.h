@@ -32,21 +32,31 @@
 #include <simdpp/core/cmp_le.h>
 #include <simdpp/core/cmp_lt.h>
 #include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/divider.h>
 #include <simdpp/core/extract.h>
 #include <simdpp/core/extract_bits.h>
 #include <simdpp/core/f_abs.h>
 #include <simdpp/core/f_add.h>
 #include <simdpp/core/f_ceil.h>
+#include <simdpp/core/f_cos.h>
 #include <simdpp/core/f_div.h>
+#include <simdpp/core/f_erf.h>
+#include <simdpp/core/f_exp.h>
+#include <simdpp/core/f_exp2.h>
 #include <simdpp/core/f_floor.h>
 #include <simdpp/core/f_fmadd.h>
 #include <simdpp/core/f_fmsub.h>
+#include <simdpp/core/f_gelu.h>
 #include <simdpp/core/f_isnan.h>
 #include <simdpp/core/f_isnan2.h>
+#include <simdpp/core/f_log.h>
+#include <simdpp/core/f_log1p.h>
+#include <simdpp/core/f_log2.h>
 #include <simdpp/core/f_max.h>
 #include <simdpp/core/f_min.h>
 #include <simdpp/core/f_mul.h>
 #include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_pow.h>
 #include <simdpp/core/f_reduce_add.h>
 #include <simdpp/core/f_reduce_max.h>
 #include <simdpp/core/f_reduce_min.h>
@@ -55,16 +65,24 @@
 #include <simdpp/core/f_rcp_rh.h>
 #include <simdpp/core/f_rsqrt_e.h>
 #include <simdpp/core/f_rsqrt_rh.h>
+#include <simdpp/core/f_sigmoid.h>
 #include <simdpp/core/f_sign.h>
+#include <simdpp/core/f_sin.h>
+#include <simdpp/core/f_sincos.h>
+#include <simdpp/core/f_softplus.h>
 #include <simdpp/core/f_sqrt.h>
 #include <simdpp/core/f_sub.h>
+#include <simdpp/core/f_tan.h>
+#include <simdpp/core/f_tanh.h>
 #include <simdpp/core/f_trunc.h>
 #include <simdpp/core/for_each.h>
+#include <simdpp/core/gather.h>
 #include <simdpp/core/i_abs.h>
 #include <simdpp/core/i_add.h>
 #include <simdpp/core/i_add_sat.h>
 #include <simdpp/core/i_avg.h>
 #include <simdpp/core/i_avg_trunc.h>
+#include <simdpp/core/i_div.h>
 #include <simdpp/core/i_div_p.h>
 #include <simdpp/core/i_max.h>
 #include <simdpp/core/i_min.h>
@@ -85,9 +103,12 @@
 #include <simdpp/core/i_sub_sat.h>
 #include <simdpp/core/insert.h>
 #include <simdpp/core/load.h>
+#include <simdpp/core/load_expand.h>
+#include <simdpp/core/load_masked.h>
 #include <simdpp/core/load_packed2.h>
 #include <simdpp/core/load_packed3.h>
 #include <simdpp/core/load_packed4.h>
+#include <simdpp/core/load_partial.h>
 #include <simdpp/core/load_splat.h>
 #include <simdpp/core/load_u.h>
 #include <simdpp/core/make_float.h>
@@ -100,14 +121,18 @@
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/permute_bytes16.h>
 #include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/prefix_sum.h>
+#include <simdpp/core/scatter.h>
 #include <simdpp/core/set_splat.h>
 #include <simdpp/core/shuffle1.h>
 #include <simdpp/core/shuffle2.h>
 #include <simdpp/core/shuffle4x2.h>
 #include <simdpp/core/shuffle_bytes16.h>
 #include <simdpp/core/shuffle_zbytes16.h>
+#include <simdpp/core/sort_network.h>
 #include <simdpp/core/splat.h>
 #include <simdpp/core/splat_n.h>
+#include <simdpp/core/store_compress.h>
 #include <simdpp/core/store_first.h>
 #include <simdpp/core/store.h>
 #include <simdpp/core/store_last.h>
@@ -115,9 +140,11 @@
 #include <simdpp/core/store_packed2.h>
 #include <simdpp/core/store_packed3.h>
 #include <simdpp/core/store_packed4.h>
+#include <simdpp/core/store_partial.h>
 #include <simdpp/core/store_u.h>
 #include <simdpp/core/stream.h>
 #include <simdpp/core/test_bits.h>
+#include <simdpp/core/to_float16.h>
 #include <simdpp/core/to_float32.h>
 #include <simdpp/core/to_float64.h>
 #include <simdpp/core/to_int16.h>
@@ -196,12 +223,23 @@
 #include <simdpp/operators/i_shift_r.h>
 #include <simdpp/operators/i_sub.h>
 
+#include <simdpp/algorithm/encoding.h>
+#include <simdpp/algorithm/find.h>
+#include <simdpp/algorithm/hash.h>
+#include <simdpp/algorithm/scan.h>
+#include <simdpp/algorithm/set_operations.h>
+#include <simdpp/algorithm/sort.h>
+#include <simdpp/algorithm/structural.h>
+#include <simdpp/algorithm/utf8.h>
+
 /** @def SIMDPP_NO_DISPATCHER
     Disables internal dispatching functionality. If the internal dispathcher
     mechanism is not needed, the user can define the @c SIMDPP_NO_DISPATCHER.
 */
 #ifndef SIMDPP_NO_DISPATCHER
 #include <simdpp/dispatch/dispatcher.h>
+#include <simdpp/dispatch/registry.h>
+#include <simdpp/dispatch/autotune.h>
 #include <simdpp/dispatch/make_dispatcher.h>
 #endif
 
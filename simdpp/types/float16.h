@@ -0,0 +1,133 @@
+/*  Copyright (C) 2013-2014  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_TYPES_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_TYPES_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <simdpp/types/fwd.h>
+#include <simdpp/types/any.h>
+#include <simdpp/types/int16x8.h>
+#include <simdpp/types/int16x16.h>
+#include <simdpp/types/int16x32.h>
+#include <simdpp/types/int16.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/detail/construct_eval.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Class representing a vector of IEEE 754 half-precision floating-point
+    values of arbitrary length. The vector always contains at least one native
+    vector.
+
+    This is a storage-only type: the values can be loaded, stored, bit-cast
+    and converted to and from float32 using @c to_float32 and @c to_float16,
+    but no arithmetic is supported directly on it.
+*/
+template<unsigned N>
+class float16<N, void> : public any_vec16<N, float16<N,void>> {
+public:
+    static const unsigned length = N;
+    static const unsigned base_length = uint16<N>::base_length;
+    static const unsigned vec_length = uint16<N>::vec_length;
+    using element_type = uint16_t;
+    using uint_element_type = uint16_t;
+    using uint_vector_type = uint16<N>;
+    using base_vector_type = typename uint16<N>::base_vector_type;
+    using expr_type = void;
+
+    SIMDPP_INL float16<N>() = default;
+    SIMDPP_INL float16<N>(const float16<N>&) = default;
+    SIMDPP_INL float16<N>& operator=(const float16<N>&) = default;
+
+    template<class V> SIMDPP_INL explicit float16<N>(const any_vec<N*2,V>& d)
+    {
+        *this = bit_cast<float16<N>>(d.wrapped().eval());
+    }
+    template<class V> SIMDPP_INL float16<N>& operator=(const any_vec<N*2,V>& d)
+    {
+        *this = bit_cast<float16<N>>(d.wrapped().eval()); return *this;
+    }
+
+    template<class E> SIMDPP_INL float16<N>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> SIMDPP_INL float16<N>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+
+    SIMDPP_INL const base_vector_type& vec(unsigned i) const { return d_.vec(i); }
+    SIMDPP_INL base_vector_type& vec(unsigned i)             { return d_.vec(i); }
+
+    SIMDPP_INL float16<N> eval() const { return *this; }
+
+private:
+    uint16<N> d_;
+};
+
+/** Class representing a vector of bfloat16 (the upper half of IEEE 754
+    single-precision) floating-point values of arbitrary length. The vector
+    always contains at least one native vector.
+
+    This is a storage-only type: the values can be loaded, stored, bit-cast
+    and converted to and from float32 using @c to_float32 and @c to_bfloat16,
+    but no arithmetic is supported directly on it.
+*/
+template<unsigned N>
+class bfloat16<N, void> : public any_vec16<N, bfloat16<N,void>> {
+public:
+    static const unsigned length = N;
+    static const unsigned base_length = uint16<N>::base_length;
+    static const unsigned vec_length = uint16<N>::vec_length;
+    using element_type = uint16_t;
+    using uint_element_type = uint16_t;
+    using uint_vector_type = uint16<N>;
+    using base_vector_type = typename uint16<N>::base_vector_type;
+    using expr_type = void;
+
+    SIMDPP_INL bfloat16<N>() = default;
+    SIMDPP_INL bfloat16<N>(const bfloat16<N>&) = default;
+    SIMDPP_INL bfloat16<N>& operator=(const bfloat16<N>&) = default;
+
+    template<class V> SIMDPP_INL explicit bfloat16<N>(const any_vec<N*2,V>& d)
+    {
+        *this = bit_cast<bfloat16<N>>(d.wrapped().eval());
+    }
+    template<class V> SIMDPP_INL bfloat16<N>& operator=(const any_vec<N*2,V>& d)
+    {
+        *this = bit_cast<bfloat16<N>>(d.wrapped().eval()); return *this;
+    }
+
+    template<class E> SIMDPP_INL bfloat16<N>(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr());
+    }
+    template<class E> SIMDPP_INL bfloat16<N>& operator=(const expr_vec_construct<E>& e)
+    {
+        detail::construct_eval_wrapper(*this, e.expr()); return *this;
+    }
+
+    SIMDPP_INL const base_vector_type& vec(unsigned i) const { return d_.vec(i); }
+    SIMDPP_INL base_vector_type& vec(unsigned i)             { return d_.vec(i); }
+
+    SIMDPP_INL bfloat16<N> eval() const { return *this; }
+
+private:
+    uint16<N> d_;
+};
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
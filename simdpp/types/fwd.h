@@ -41,6 +41,14 @@ using float64x4 = float64<4>;
 using mask_float64x2 = mask_float64<2>;
 using mask_float64x4 = mask_float64<4>;
 
+template<unsigned N, class E = void> class float16;
+template<unsigned N, class E = void> class bfloat16;
+
+using float16x8 = float16<8>;
+using float16x16 = float16<16>;
+using bfloat16x8 = bfloat16<8>;
+using bfloat16x16 = bfloat16<16>;
+
 template<unsigned N, class E = void> class int8;
 template<unsigned N, class E = void> class uint8;
 template<unsigned N, class E = void> class mask_int8;
@@ -8,6 +8,7 @@
 #define SIMDPP_USER_ARCH_INFO get_supported_arch()
 #include "dispatcher.h"
 #include <simdpp/simd.h>
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
@@ -16,6 +17,26 @@ simdpp::Arch test_dispatcher_get_arch()
     return simdpp::this_compile_arch();
 }
 
+simdpp::Arch test_dispatcher_ptr_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
+simdpp::Arch test_dispatcher_ifunc_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
+simdpp::Arch test_dispatcher_narrow_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
+simdpp::Arch test_dispatcher_autotune_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
 int test_dispatcher1(int arg)
 {
     return arg;
@@ -442,3 +463,43 @@ SIMDPP_INSTANTIATE_DISPATCHER(
     (template std::pair<int, int>
         test_dispatcher_ret_template2_nondeductible<int, int>())
 )
+
+// Prefers the versions that don't use vectors wider than 128 bits
+#undef SIMDPP_USER_PREFER_VECTOR_WIDTH
+#define SIMDPP_USER_PREFER_VECTOR_WIDTH 128
+SIMDPP_MAKE_DISPATCHER((simdpp::Arch)(test_dispatcher_narrow_get_arch)())
+#undef SIMDPP_USER_PREFER_VECTOR_WIDTH
+#define SIMDPP_USER_PREFER_VECTOR_WIDTH 0
+
+#if SIMDPP_EMIT_DISPATCHER
+/*  Runs the dispatched function. The cost of each version is supplied by the
+    hook set in test_dispatcher_autotune().
+*/
+static void test_dispatcher_autotune_tuner(simdpp::Arch (*f)())
+{
+    f();
+}
+#endif
+
+SIMDPP_MAKE_DISPATCHER_AUTOTUNE((simdpp::Arch)(test_dispatcher_autotune_get_arch)(),
+                                test_dispatcher_autotune_tuner)
+
+/*  The indirect function is resolved before main() is entered, thus the
+    supported architecture given on the command line can't be used. Both
+    dispatchers below use information that is available at load time and must
+    select the same version.
+*/
+inline simdpp::Arch test_dispatcher_load_time_arch()
+{
+#if SIMDPP_HAS_GET_ARCH_RAW_CPUID
+    return simdpp::get_arch_raw_cpuid();
+#else
+    return simdpp::Arch::NONE_NULL;
+#endif
+}
+
+#undef SIMDPP_USER_ARCH_INFO
+#define SIMDPP_USER_ARCH_INFO test_dispatcher_load_time_arch()
+
+SIMDPP_MAKE_DISPATCHER((simdpp::Arch)(test_dispatcher_ptr_get_arch)())
+SIMDPP_MAKE_DISPATCHER_IFUNC((simdpp::Arch)(test_dispatcher_ifunc_get_arch)())
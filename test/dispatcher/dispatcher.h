@@ -10,6 +10,10 @@
 
 simdpp::Arch get_supported_arch(); // in main_dispatcher.cc
 simdpp::Arch test_dispatcher_get_arch();
+simdpp::Arch test_dispatcher_ptr_get_arch();
+simdpp::Arch test_dispatcher_ifunc_get_arch();
+simdpp::Arch test_dispatcher_narrow_get_arch();
+simdpp::Arch test_dispatcher_autotune_get_arch();
 
 extern int g_test_dispatcher_val;
 int test_dispatcher_old_ret0();
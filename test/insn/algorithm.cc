@@ -0,0 +1,838 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../utils/test_helpers.h"
+#include "../utils/test_results.h"
+#include <simdpp/simd.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+template<class V>
+void test_prefix_sum_type(TestResultsSet& ts, TestReporter& tr)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    E src[V::length], expected[V::length];
+    for (unsigned i = 0; i < V::length; ++i) {
+        src[i] = E(i * 3 + 1);
+    }
+    std::partial_sum(src, src + V::length, expected);
+
+    V v = load_u(src);
+    V r = prefix_sum(v);
+    TEST_PUSH(ts, V, r);
+    TEST_EQUAL(tr, r, V(load_u(expected)));
+
+    // the sums must wrap around in the same way as the scalar sums
+    for (unsigned i = 0; i < V::length; ++i) {
+        src[i] = std::numeric_limits<E>::max();
+    }
+    std::partial_sum(src, src + V::length, expected);
+    v = load_u(src);
+    TEST_EQUAL(tr, prefix_sum(v), V(load_u(expected)));
+}
+
+template<unsigned B>
+void test_prefix_sum_n(TestResultsSet& ts, TestReporter& tr)
+{
+    using namespace simdpp;
+    test_prefix_sum_type<int8<B>>(ts, tr);
+    test_prefix_sum_type<uint8<B>>(ts, tr);
+    test_prefix_sum_type<int16<B/2>>(ts, tr);
+    test_prefix_sum_type<uint16<B/2>>(ts, tr);
+    test_prefix_sum_type<int32<B/4>>(ts, tr);
+    test_prefix_sum_type<uint32<B/4>>(ts, tr);
+    test_prefix_sum_type<int64<B/8>>(ts, tr);
+    test_prefix_sum_type<uint64<B/8>>(ts, tr);
+    test_prefix_sum_type<float32<B/4>>(ts, tr);
+    test_prefix_sum_type<float64<B/8>>(ts, tr);
+}
+
+template<class T>
+void test_scan_type(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    const unsigned sizes[] = { 0, 1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100, 257 };
+    for (unsigned size : sizes) {
+        std::vector<T> src(size), expected(size), r(size);
+        for (unsigned i = 0; i < size; ++i) {
+            src[i] = T(i * 5 + 2);
+        }
+
+        std::partial_sum(src.begin(), src.end(), expected.begin());
+        inclusive_scan(src.data(), src.data() + size, r.data());
+        for (unsigned i = 0; i < size; ++i) {
+            TEST_EQUAL(tr, expected[i], r[i]);
+        }
+
+        // in-place operation
+        r = src;
+        inclusive_scan(r.data(), r.data() + size, r.data());
+        for (unsigned i = 0; i < size; ++i) {
+            TEST_EQUAL(tr, expected[i], r[i]);
+        }
+
+        T init = T(11);
+        for (unsigned i = 0; i < size; ++i) {
+            expected[i] = init;
+            init = T(init + src[i]);
+        }
+        r = src;
+        exclusive_scan(r.data(), r.data() + size, r.data(), T(11));
+        for (unsigned i = 0; i < size; ++i) {
+            TEST_EQUAL(tr, expected[i], r[i]);
+        }
+    }
+}
+
+// Checks that the elements of each lane of the vectors in src are sorted by
+// sort_network. A lane consists of S elements of each of the R vectors.
+template<class V, unsigned R>
+void test_sort_network_check(TestReporter& tr, const V* src, const V* r)
+{
+    using E = typename V::element_type;
+    const unsigned S = 16 / sizeof(E);
+
+    E in[R][V::length], out[R][V::length];
+    for (unsigned i = 0; i < R; ++i) {
+        store_u(in[i], src[i]);
+        store_u(out[i], r[i]);
+    }
+
+    for (unsigned l = 0; l < V::length; l += S) {
+        std::vector<E> expected, result;
+        for (unsigned i = 0; i < R; ++i) {
+            expected.insert(expected.end(), in[i] + l, in[i] + l + S);
+            result.insert(result.end(), out[i] + l, out[i] + l + S);
+        }
+        std::sort(expected.begin(), expected.end());
+        for (unsigned i = 0; i < expected.size(); ++i) {
+            TEST_EQUAL(tr, expected[i], result[i]);
+        }
+    }
+}
+
+template<class V>
+void test_sort_network_type(TestReporter& tr)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    std::vector<E> data(4 * V::length);
+    for (unsigned seed = 0; seed < 16; ++seed) {
+        // includes duplicate and negative values for signed types
+        for (unsigned i = 0; i < data.size(); ++i) {
+            data[i] = E(((i * 7 + seed * 13) % 23) * 3 % 19) - E(seed % 2);
+        }
+
+        V src[4], r[4];
+        for (unsigned i = 0; i < 4; ++i) {
+            src[i] = load_u(data.data() + i * V::length);
+            r[i] = src[i];
+        }
+
+        sort_network(r[0]);
+        test_sort_network_check<V,1>(tr, src, r);
+
+        r[0] = src[0]; r[1] = src[1];
+        sort_network(r[0], r[1]);
+        test_sort_network_check<V,2>(tr, src, r);
+
+        r[0] = src[0]; r[1] = src[1]; r[2] = src[2];
+        sort_network(r[0], r[1], r[2]);
+        test_sort_network_check<V,3>(tr, src, r);
+
+        r[0] = src[0]; r[1] = src[1]; r[2] = src[2]; r[3] = src[3];
+        sort_network(r[0], r[1], r[2], r[3]);
+        test_sort_network_check<V,4>(tr, src, r);
+    }
+}
+
+template<unsigned B>
+void test_sort_network_n(TestReporter& tr)
+{
+    using namespace simdpp;
+    test_sort_network_type<int32<B/4>>(tr);
+    test_sort_network_type<uint32<B/4>>(tr);
+    test_sort_network_type<float32<B/4>>(tr);
+    test_sort_network_type<float64<B/8>>(tr);
+#if SIMDPP_HAS_INT64_MIN_MAX
+    test_sort_network_type<int64<B/8>>(tr);
+    test_sort_network_type<uint64<B/8>>(tr);
+#endif
+}
+
+template<class T>
+void test_sort_type(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    const unsigned sizes[] = { 0, 1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100,
+                               257, 1000, 4099 };
+    for (unsigned size : sizes) {
+        std::vector<T> src(size), expected, r;
+        for (unsigned i = 0; i < size; ++i) {
+            src[i] = T((i * 7919) % 1013) - T(i % 3);
+        }
+        expected = src;
+        std::sort(expected.begin(), expected.end());
+        r = src;
+        simdpp::sort(r.data(), r.data() + size);
+        for (unsigned i = 0; i < size; ++i) {
+            TEST_EQUAL(tr, expected[i], r[i]);
+        }
+    }
+}
+
+template<class K>
+void test_sort_by_key_type(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    const unsigned sizes[] = { 0, 1, 7, 16, 33, 47, 100, 1000, 4099 };
+    for (unsigned size : sizes) {
+        std::vector<K> keys(size), orig_keys;
+        std::vector<uint32_t> values(size);
+        for (unsigned i = 0; i < size; ++i) {
+            keys[i] = K((i * 7919) % 101) - K(i % 3);
+            values[i] = i;
+        }
+        orig_keys = keys;
+
+        sort_by_key(keys.data(), keys.data() + size, values.data());
+        std::vector<unsigned> seen(size);
+        for (unsigned i = 0; i < size; ++i) {
+            // the values must move together with the keys
+            TEST_EQUAL(tr, orig_keys[values[i]], keys[i]);
+            if (i > 0) {
+                TEST_EQUAL(tr, true, keys[i-1] <= keys[i]);
+            }
+            if (values[i] < size)
+                seen[values[i]]++;
+        }
+        // no value may be duplicated or lost
+        for (unsigned i = 0; i < size; ++i) {
+            TEST_EQUAL(tr, 1u, seen[i]);
+        }
+    }
+}
+
+void test_sort_float_order(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    // negative zero must be ordered before positive zero
+    float src[] = { 0.0f, 1.0f, -0.0f, -1.0f, 0.0f, -0.0f };
+    float expected[] = { -1.0f, -0.0f, -0.0f, 0.0f, 0.0f, 1.0f };
+    simdpp::sort(src, src + 6);
+    TEST_EQUAL(tr, 0, std::memcmp(src, expected, sizeof(src)));
+
+    double dsrc[] = { 0.0, 1.0, -0.0, -1.0, 0.0, -0.0 };
+    double dexpected[] = { -1.0, -0.0, -0.0, 0.0, 0.0, 1.0 };
+    simdpp::sort(dsrc, dsrc + 6);
+    TEST_EQUAL(tr, 0, std::memcmp(dsrc, dexpected, sizeof(dsrc)));
+
+    // NaNs are ordered by their sign bit at either end
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    double nsrc[] = { 1.0, -nan, -0.0, nan, 0.0, -1.0 };
+    double nexpected[] = { -nan, -1.0, -0.0, 0.0, 1.0, nan };
+    simdpp::sort(nsrc, nsrc + 6);
+    TEST_EQUAL(tr, 0, std::memcmp(nsrc, nexpected, sizeof(nsrc)));
+}
+
+// Checks that nothing is written past the space that the output range of a
+// set operation is required to have
+template<class T>
+struct test_set_output {
+    static const unsigned guard = 8;
+    std::vector<T> data;
+    std::size_t size;
+
+    test_set_output(std::size_t size) : data(size + guard, T(0x5a)), size(size) {}
+    T* begin() { return data.data(); }
+    bool guard_intact() const
+    {
+        for (unsigned i = 0; i < guard; ++i) {
+            if (data[size + i] != T(0x5a))
+                return false;
+        }
+        return true;
+    }
+};
+
+template<class T>
+void test_set_operations_check(TestReporter& tr, const std::vector<T>& a,
+                               const std::vector<T>& b)
+{
+    using namespace simdpp;
+
+    std::vector<T> expected(a.size() + b.size());
+    const T* a0 = a.data(); const T* a1 = a0 + a.size();
+    const T* b0 = b.data(); const T* b1 = b0 + b.size();
+
+    test_set_output<T> r_merge(a.size() + b.size());
+    auto e_end = std::merge(a0, a1, b0, b1, expected.begin());
+    T* r_end = merge_sorted(a0, a1, b0, b1, r_merge.begin());
+    TEST_EQUAL(tr, e_end - expected.begin(), r_end - r_merge.begin());
+    TEST_EQUAL(tr, true, std::equal(expected.begin(), e_end, r_merge.begin()));
+    TEST_EQUAL(tr, true, r_merge.guard_intact());
+
+    test_set_output<T> r_inter(std::min(a.size(), b.size()));
+    e_end = std::set_intersection(a0, a1, b0, b1, expected.begin());
+    r_end = set_intersection(a0, a1, b0, b1, r_inter.begin());
+    TEST_EQUAL(tr, e_end - expected.begin(), r_end - r_inter.begin());
+    TEST_EQUAL(tr, true, std::equal(expected.begin(), e_end, r_inter.begin()));
+    TEST_EQUAL(tr, true, r_inter.guard_intact());
+    TEST_EQUAL(tr, std::size_t(e_end - expected.begin()),
+               set_intersection_size(a0, a1, b0, b1));
+
+    test_set_output<T> r_union(a.size() + b.size());
+    e_end = std::set_union(a0, a1, b0, b1, expected.begin());
+    r_end = set_union(a0, a1, b0, b1, r_union.begin());
+    TEST_EQUAL(tr, e_end - expected.begin(), r_end - r_union.begin());
+    TEST_EQUAL(tr, true, std::equal(expected.begin(), e_end, r_union.begin()));
+    TEST_EQUAL(tr, true, r_union.guard_intact());
+
+    test_set_output<T> r_diff(a.size());
+    e_end = std::set_difference(a0, a1, b0, b1, expected.begin());
+    r_end = set_difference(a0, a1, b0, b1, r_diff.begin());
+    TEST_EQUAL(tr, e_end - expected.begin(), r_end - r_diff.begin());
+    TEST_EQUAL(tr, true, std::equal(expected.begin(), e_end, r_diff.begin()));
+    TEST_EQUAL(tr, true, r_diff.guard_intact());
+}
+
+template<class T>
+void test_set_operations_type(TestReporter& tr)
+{
+    const unsigned sizes[] = { 0, 1, 3, 4, 5, 8, 9, 17, 64, 100, 1000 };
+    const unsigned strides[] = { 1, 2, 3, 7 };
+    for (unsigned na : sizes) {
+        for (unsigned nb : sizes) {
+            for (unsigned stride : strides) {
+                // a contains multiples of stride, b contains multiples of 2
+                // offset by the size so that the overlap varies
+                std::vector<T> a(na), b(nb);
+                for (unsigned i = 0; i < na; ++i)
+                    a[i] = T(i * stride);
+                for (unsigned i = 0; i < nb; ++i)
+                    b[i] = T(i * 2 + nb % 5);
+                test_set_operations_check(tr, a, b);
+                test_set_operations_check(tr, b, a);
+            }
+        }
+    }
+}
+
+void test_find_bytes(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    // the ranges start at all offsets within a vector, thus the aligned
+    // prologues and epilogues are exercised
+    std::vector<char> buf(600);
+    for (unsigned i = 0; i < buf.size(); ++i)
+        buf[i] = char('a' + (i * 7919) % 23);
+    const char set[] = ",;:\"{}[]";
+    buf[17] = ','; buf[250] = '{'; buf[251] = ']'; buf[499] = '"';
+
+    for (unsigned begin = 0; begin < 64; ++begin) {
+        for (unsigned size : { 0u, 1u, 15u, 16u, 31u, 33u, 100u, 300u, 500u }) {
+            const char* first = buf.data() + begin;
+            const char* last = first + size;
+
+            for (char value : { 'a', 'k', 'z', '{' }) {
+                TEST_EQUAL(tr, std::find(first, last, value) - first,
+                           find_byte(first, last, value) - first);
+                const char* expected = last;
+                for (const char* p = first; p != last; ++p) {
+                    if (*p == value)
+                        expected = p;
+                }
+                TEST_EQUAL(tr, expected - first,
+                           find_last_byte(first, last, value) - first);
+                TEST_EQUAL(tr, std::size_t(std::count(first, last, value)),
+                           count_byte(first, last, value));
+            }
+            for (unsigned set_size : { 1u, 3u, 9u }) {
+                TEST_EQUAL(tr, std::find_first_of(first, last, set, set + set_size) - first,
+                           find_any_of(first, last, set, set + set_size) - first);
+            }
+
+            std::vector<char> copy(first, last);
+            copy.push_back(0);
+            TEST_EQUAL(tr, std::size_t(size), simdpp::strlen(copy.data()));
+            TEST_EQUAL(tr, std::size_t(size), find_first_mismatch(first, copy.data(), size));
+            if (size > 0) {
+                copy[size / 3] ^= 1;
+                TEST_EQUAL(tr, std::size_t(size / 3), find_first_mismatch(first, copy.data(), size));
+            }
+        }
+    }
+}
+
+// Reference UTF-8 decoder. Returns false if the text is not valid UTF-8.
+inline bool test_utf8_decode_ref(const std::string& s, std::u32string& out)
+{
+    static const uint32_t min_cp[] = { 0, 0, 0x80, 0x800, 0x10000 };
+    out.clear();
+    for (std::size_t i = 0; i < s.size();) {
+        uint8_t c = s[i];
+        unsigned len = c < 0x80 ? 1 : (c & 0xe0) == 0xc0 ? 2 :
+                       (c & 0xf0) == 0xe0 ? 3 : (c & 0xf8) == 0xf0 ? 4 : 0;
+        if (len == 0 || i + len > s.size())
+            return false;
+        uint32_t cp = len == 1 ? c : c & (0x3f >> (len - 1));
+        for (unsigned k = 1; k < len; ++k) {
+            uint8_t d = s[i + k];
+            if ((d & 0xc0) != 0x80)
+                return false;
+            cp = (cp << 6) | (d & 0x3f);
+        }
+        if (cp < min_cp[len] || cp > 0x10ffff || (cp >= 0xd800 && cp < 0xe000))
+            return false;
+        out.push_back(char32_t(cp));
+        i += len;
+    }
+    return true;
+}
+
+inline void test_utf8_encode_ref(const std::u32string& cps, std::string& s8,
+                                 std::u16string& s16)
+{
+    for (char32_t cp : cps) {
+        if (cp < 0x80) {
+            s8 += char(cp);
+        } else if (cp < 0x800) {
+            s8 += char(0xc0 | (cp >> 6));
+            s8 += char(0x80 | (cp & 0x3f));
+        } else if (cp < 0x10000) {
+            s8 += char(0xe0 | (cp >> 12));
+            s8 += char(0x80 | ((cp >> 6) & 0x3f));
+            s8 += char(0x80 | (cp & 0x3f));
+        } else {
+            s8 += char(0xf0 | (cp >> 18));
+            s8 += char(0x80 | ((cp >> 12) & 0x3f));
+            s8 += char(0x80 | ((cp >> 6) & 0x3f));
+            s8 += char(0x80 | (cp & 0x3f));
+        }
+        if (cp < 0x10000) {
+            s16 += char16_t(cp);
+        } else {
+            s16 += char16_t(0xd800 | ((cp - 0x10000) >> 10));
+            s16 += char16_t(0xdc00 | (cp & 0x3ff));
+        }
+    }
+}
+
+void test_utf8_fuzz(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    // text of random characters of up to 4 bytes mixed in different
+    // proportions. Every third string is corrupted by inserting, removing or
+    // replacing bytes.
+    const char* const bad_sequences[] = {
+        "\xed\xa0\x80", "\xc0\xaf", "\xe0\x80\xaf", "\xf4\x90\x80\x80",
+        "\xf0\x80\x80\xaf", "\xf8", "\xff", "\xc2"
+    };
+    std::mt19937 rng(5);
+    for (unsigned iter = 0; iter < 3000; ++iter) {
+        std::u32string cps;
+        unsigned length = rng() % (iter % 10 == 0 ? 300 : 50);
+        unsigned mix = iter % 5;
+        for (unsigned i = 0; i < length; ++i) {
+            unsigned cls = mix == 4 ? 2 : mix == 0 ? 0 : rng() % (mix + 1);
+            uint32_t cp;
+            switch (cls) {
+            case 0: cp = rng() % 0x80; break;
+            case 1: cp = 0x80 + rng() % 0x780; break;
+            case 2: do { cp = 0x800 + rng() % 0xf800; } while (cp >= 0xd800 && cp < 0xe000); break;
+            default: cp = 0x10000 + rng() % 0x100000; break;
+            }
+            cps.push_back(char32_t(cp));
+        }
+        std::string s8;
+        std::u16string s16;
+        test_utf8_encode_ref(cps, s8, s16);
+
+        if (iter % 3 == 1 && !s8.empty()) {
+            std::size_t pos = rng() % s8.size();
+            switch (rng() % 4) {
+            case 0: s8[pos] = char(rng()); break;
+            case 1: s8.erase(pos, 1); break;
+            case 2: s8.insert(pos, 1, char(0x80 | rng() % 0x40)); break;
+            default: s8.insert(pos, bad_sequences[rng() % 8]); break;
+            }
+        }
+
+        std::u32string ref;
+        bool valid = test_utf8_decode_ref(s8, ref);
+        const char* first = s8.data();
+        const char* last = first + s8.size();
+        TEST_EQUAL(tr, valid, utf8_validate(first, last));
+
+        // the output buffers have the minimum size required by the functions
+        std::vector<char16_t> out16(std::max<std::size_t>(s8.size(), 1));
+        std::vector<char32_t> out32(std::max<std::size_t>(s8.size(), 1));
+        char16_t* end16 = utf8_to_utf16(first, last, out16.data());
+        char32_t* end32 = utf8_to_utf32(first, last, out32.data());
+        TEST_EQUAL(tr, valid, end16 != nullptr);
+        TEST_EQUAL(tr, valid, end32 != nullptr);
+        if (!valid || end16 == nullptr || end32 == nullptr)
+            continue;
+
+        // the corrupted text may still be valid
+        std::string unused;
+        cps = ref;
+        s16.clear();
+        test_utf8_encode_ref(cps, unused, s16);
+        TEST_EQUAL(tr, true, std::u16string(out16.data(), end16) == s16);
+        TEST_EQUAL(tr, true, std::u32string(out32.data(), end32) == cps);
+
+        std::vector<char> out8(std::max<std::size_t>(3 * s16.size(), 1));
+        char* end8 = utf16_to_utf8(s16.data(), s16.data() + s16.size(), out8.data());
+        TEST_EQUAL(tr, true, end8 != nullptr && std::string(out8.data(), end8) == s8);
+        out8.resize(std::max<std::size_t>(4 * cps.size(), 1));
+        end8 = utf32_to_utf8(cps.data(), cps.data() + cps.size(), out8.data());
+        TEST_EQUAL(tr, true, end8 != nullptr && std::string(out8.data(), end8) == s8);
+
+        if (!cps.empty() && iter % 4 == 0) {
+            // unpaired surrogates and values above U+10FFFF
+            std::size_t pos = rng() % cps.size();
+            cps[pos] = char32_t(iter % 8 == 0 ? 0xd800 + rng() % 0x800 : 0x110000 + rng() % 0x1000);
+            TEST_EQUAL(tr, true, utf32_to_utf8(cps.data(), cps.data() + cps.size(),
+                                               out8.data()) == nullptr);
+            std::u16string bad16;
+            std::string unused;
+            test_utf8_encode_ref(cps.substr(0, pos), unused, bad16);
+            bad16 += char16_t(0xdc00 + rng() % 0x400);
+            test_utf8_encode_ref(cps.substr(pos + 1), unused, bad16);
+            TEST_EQUAL(tr, true, utf16_to_utf8(bad16.data(), bad16.data() + bad16.size(),
+                                               out8.data()) == nullptr);
+        }
+    }
+}
+
+void test_base64_hex(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    const char* const alphabets[] = {
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+    };
+    const char digits[] = "0123456789abcdef";
+
+    for (unsigned size = 0; size < 400; size += size < 100 ? 1 : 37) {
+        std::string data(size, 0);
+        for (unsigned i = 0; i < size; ++i)
+            data[i] = char((i * 7919 + size) >> 2);
+
+        for (unsigned ia = 0; ia < 2; ++ia) {
+            base64_alphabet alphabet = ia == 0 ? base64_alphabet::standard
+                                               : base64_alphabet::url;
+            std::string expected;
+            for (unsigned i = 0; i < size; i += 3) {
+                uint32_t v = uint32_t(uint8_t(data[i])) << 16;
+                if (i + 1 < size) v |= uint32_t(uint8_t(data[i + 1])) << 8;
+                if (i + 2 < size) v |= uint8_t(data[i + 2]);
+                unsigned count = std::min(size - i, 3u) + 1;
+                for (unsigned j = 0; j < 4; ++j) {
+                    if (j < count)
+                        expected += alphabets[ia][(v >> (18 - 6 * j)) & 0x3f];
+                    else if (alphabet == base64_alphabet::standard)
+                        expected += '=';
+                }
+            }
+
+            std::vector<char> text(base64_encoded_size(size, alphabet) + 1);
+            char* text_end = base64_encode(data.data(), data.data() + size,
+                                           text.data(), alphabet);
+            TEST_EQUAL(tr, expected.size(), base64_encoded_size(size, alphabet));
+            TEST_EQUAL(tr, true, std::string(text.data(), text_end) == expected);
+
+            std::vector<char> out(size + 3);
+            decode_result r = base64_decode(expected.data(),
+                                            expected.data() + expected.size(),
+                                            out.data(), alphabet);
+            TEST_EQUAL(tr, true, r.error == nullptr);
+            TEST_EQUAL(tr, true, std::string(out.data(), r.out) == data);
+
+            // the padding is optional
+            std::string other = expected;
+            if (alphabet == base64_alphabet::standard) {
+                while (!other.empty() && other.back() == '=')
+                    other.pop_back();
+            } else {
+                while (other.size() % 4 != 0)
+                    other += '=';
+            }
+            r = base64_decode(other.data(), other.data() + other.size(),
+                              out.data(), alphabet);
+            TEST_EQUAL(tr, true, r.error == nullptr);
+            TEST_EQUAL(tr, true, std::string(out.data(), r.out) == data);
+
+            if (size == 0)
+                continue;
+            std::size_t pos = (size * 13) % other.size();
+            if (pos < other.size() && other[pos] != '=') {
+                other[pos] = alphabets[1 - ia][62 + size % 2];
+                r = base64_decode(other.data(), other.data() + other.size(),
+                                  out.data(), alphabet);
+                TEST_EQUAL(tr, std::size_t(pos), std::size_t(r.error - other.data()));
+            }
+        }
+
+        std::string hex;
+        for (unsigned i = 0; i < size; ++i) {
+            hex += digits[uint8_t(data[i]) >> 4];
+            hex += digits[uint8_t(data[i]) & 0xf];
+        }
+        std::vector<char> text(2 * size + 1);
+        char* text_end = hex_encode(data.data(), data.data() + size, text.data());
+        TEST_EQUAL(tr, true, std::string(text.data(), text_end) == hex);
+
+        for (unsigned i = 0; i < hex.size(); i += 3) {
+            if (hex[i] >= 'a')
+                hex[i] = char(hex[i] - 'a' + 'A');
+        }
+        std::vector<char> out(size + 1);
+        decode_result r = hex_decode(hex.data(), hex.data() + hex.size(), out.data());
+        TEST_EQUAL(tr, true, r.error == nullptr);
+        TEST_EQUAL(tr, true, std::string(out.data(), r.out) == data);
+
+        if (size == 0)
+            continue;
+        r = hex_decode(hex.data(), hex.data() + hex.size() - 1, out.data());
+        TEST_EQUAL(tr, std::size_t(hex.size() - 1), std::size_t(r.error - hex.data()));
+        std::size_t pos = (size * 13) % hex.size();
+        hex[pos] = "g/:@`G"[size % 6];
+        r = hex_decode(hex.data(), hex.data() + hex.size(), out.data());
+        TEST_EQUAL(tr, std::size_t(pos), std::size_t(r.error - hex.data()));
+    }
+}
+
+// Computes the JSON structural characters one byte at a time
+inline std::vector<uint32_t> test_json_structural_ref(const std::string& s, bool& ok)
+{
+    std::vector<uint32_t> r;
+    bool escaped = false, in_string = false, follows_scalar = false;
+    for (std::size_t i = 0; i < s.size(); ++i) {
+        char c = s[i];
+        bool quote = c == '"' && !escaped;
+        bool op = c != 0 && std::strchr("{}[]:,", c) != nullptr;
+        bool space = c != 0 && std::strchr(" \t\n\r", c) != nullptr;
+        bool scalar = !op && !space;
+        if (quote)
+            in_string = !in_string;
+        // the opening quote is included, the rest of the string is not
+        bool string_tail = in_string != quote;
+        if (!string_tail && (op || (scalar && !follows_scalar)))
+            r.push_back(uint32_t(i));
+        follows_scalar = scalar && !quote;
+        escaped = c == '\\' && !escaped;
+    }
+    ok = !in_string;
+    return r;
+}
+
+void test_structural_index(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    std::string json = "{\"a\\\"\": [1, true,\"x\\\\\"], \"b\":-2.5e3}";
+    std::vector<uint32_t> out(json.size() + 3);
+    uint32_t* r = json_structural_index(json.data(), json.data() + json.size(),
+                                        out.data());
+    const uint32_t json_expected[] = { 0, 1, 6, 8, 9, 10, 12, 16, 17, 22, 23,
+                                       25, 28, 29, 35 };
+    TEST_EQUAL(tr, true, r != nullptr &&
+               std::vector<uint32_t>(out.data(), r) ==
+               std::vector<uint32_t>(json_expected, json_expected + 15));
+
+    std::string csv = "a,\"b,\"\"c\"\"\n\",d\ne,f";
+    out.resize(csv.size() + 3);
+    r = csv_structural_index(csv.data(), csv.data() + csv.size(), out.data());
+    const uint32_t csv_expected[] = { 1, 12, 14, 16 };
+    TEST_EQUAL(tr, true, r != nullptr &&
+               std::vector<uint32_t>(out.data(), r) ==
+               std::vector<uint32_t>(csv_expected, csv_expected + 4));
+
+    // random text of the characters that affect the state, the blocks are
+    // 64 bytes long, thus the sequences must cross several boundaries
+    std::mt19937 rng(11);
+    const char chars[] = "{}[]:, \t\n\"\\\\\\ab1\"";
+    for (unsigned iter = 0; iter < 2000; ++iter) {
+        std::size_t size = rng() % (iter % 8 == 0 ? 600 : 150);
+        std::string s(size, ' ');
+        for (std::size_t i = 0; i < size; ++i)
+            s[i] = iter % 4 == 3 ? char(rng()) : chars[rng() % (sizeof(chars) - 1)];
+
+        out.resize(size + 3);
+        bool ok;
+        std::vector<uint32_t> expected = test_json_structural_ref(s, ok);
+        r = json_structural_index(s.data(), s.data() + size, out.data());
+        TEST_EQUAL(tr, ok, r != nullptr);
+        if (ok && r != nullptr)
+            TEST_EQUAL(tr, true, std::vector<uint32_t>(out.data(), r) == expected);
+
+        char separator = iter % 2 ? ',' : '\t';
+        bool in_quotes = false;
+        expected.clear();
+        for (std::size_t i = 0; i < size; ++i) {
+            if (s[i] == '"')
+                in_quotes = !in_quotes;
+            else if (!in_quotes && (s[i] == separator || s[i] == '\n'))
+                expected.push_back(uint32_t(i));
+        }
+        r = csv_structural_index(s.data(), s.data() + size, out.data(), separator);
+        TEST_EQUAL(tr, !in_quotes, r != nullptr);
+        if (!in_quotes && r != nullptr)
+            TEST_EQUAL(tr, true, std::vector<uint32_t>(out.data(), r) == expected);
+    }
+}
+
+void test_hash(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    const char* abc = "abc";
+    TEST_EQUAL(tr, uint32_t(0x02cc5d05), xxhash32(abc, abc));
+    TEST_EQUAL(tr, uint32_t(0x32d153ff), xxhash32(abc, abc + 3));
+    TEST_EQUAL(tr, uint64_t(0xef46db3751d8e999ull), xxhash64(abc, abc));
+    TEST_EQUAL(tr, uint64_t(0x44bc2cf5ad770999ull), xxhash64(abc, abc + 3));
+
+    const char* digits = "123456789";
+    TEST_EQUAL(tr, uint32_t(0xe3069283), crc32c(digits, digits + 9));
+    TEST_EQUAL(tr, uint32_t(0xe3069283),
+               crc32c(digits + 4, digits + 9, crc32c(digits, digits + 4)));
+
+    // the lengths cover the tails of the 16 and 32 byte stripes and the
+    // parallel CRC32C parts of 256 and 8192 bytes
+    std::mt19937 rng(13);
+    std::vector<char> data(3 * 8192 + 1000);
+    for (char& c : data)
+        c = char(rng());
+
+    for (unsigned iter = 0; iter < 300; ++iter) {
+        std::size_t size = iter < 100 ? iter : rng() % (iter % 16 == 0 ? data.size() : 1000);
+        const char* first = data.data() + data.size() - size;
+        uint32_t crc = rng();
+
+        uint32_t expected = ~crc;
+        for (std::size_t i = 0; i < size; ++i) {
+            expected ^= uint8_t(first[i]);
+            for (unsigned k = 0; k < 8; ++k)
+                expected = (expected >> 1) ^ (0x82f63b78u & (0 - (expected & 1)));
+        }
+        TEST_EQUAL(tr, ~expected, crc32c(first, first + size, crc));
+    }
+
+    // the results of the multi-lane functions must be the same as those of
+    // the bulk ones and the scalar finalizer
+    for (unsigned iter = 0; iter < 100; ++iter) {
+        uint32_t k32[8], r32[8];
+        uint64_t k64[8], r64[8];
+        for (unsigned i = 0; i < 8; ++i) {
+            k32[i] = rng();
+            k64[i] = (uint64_t(rng()) << 32) | rng();
+        }
+        uint32_t seed32 = rng();
+        uint64_t seed64 = (uint64_t(rng()) << 32) | rng();
+        uint32<8> v32 = load_u(k32);
+        uint64<8> v64 = load_u(k64);
+
+        store_u(r32, xxhash32(v32, seed32));
+        for (unsigned i = 0; i < 8; ++i) {
+            char bytes[4];
+            for (unsigned j = 0; j < 4; ++j)
+                bytes[j] = char(k32[i] >> (8 * j));
+            TEST_EQUAL(tr, xxhash32(bytes, bytes + 4, seed32), r32[i]);
+        }
+
+        store_u(r64, xxhash64(v64, seed64));
+        for (unsigned i = 0; i < 8; ++i) {
+            char bytes[8];
+            for (unsigned j = 0; j < 8; ++j)
+                bytes[j] = char(k64[i] >> (8 * j));
+            TEST_EQUAL(tr, xxhash64(bytes, bytes + 8, seed64), r64[i]);
+        }
+
+        store_u(r32, murmur3_fmix(v32));
+        for (unsigned i = 0; i < 8; ++i) {
+            uint32_t h = k32[i];
+            h ^= h >> 16; h *= 0x85ebca6b;
+            h ^= h >> 13; h *= 0xc2b2ae35;
+            h ^= h >> 16;
+            TEST_EQUAL(tr, h, r32[i]);
+        }
+
+        store_u(r64, murmur3_fmix(v64));
+        for (unsigned i = 0; i < 8; ++i) {
+            uint64_t h = k64[i];
+            h ^= h >> 33; h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ull;
+            h ^= h >> 33;
+            TEST_EQUAL(tr, h, r64[i]);
+        }
+    }
+}
+
+void test_algorithm(TestResults& res, TestReporter& tr)
+{
+    TestResultsSet& ts = res.new_results_set("prefix_sum");
+    test_prefix_sum_n<16>(ts, tr);
+    test_prefix_sum_n<32>(ts, tr);
+    test_prefix_sum_n<64>(ts, tr);
+
+    test_scan_type<int8_t>(tr);
+    test_scan_type<uint8_t>(tr);
+    test_scan_type<int16_t>(tr);
+    test_scan_type<uint16_t>(tr);
+    test_scan_type<int32_t>(tr);
+    test_scan_type<uint32_t>(tr);
+    test_scan_type<int64_t>(tr);
+    test_scan_type<uint64_t>(tr);
+    test_scan_type<float>(tr);
+    test_scan_type<double>(tr);
+
+    test_sort_network_n<16>(tr);
+    test_sort_network_n<32>(tr);
+    test_sort_network_n<64>(tr);
+
+    test_sort_type<int32_t>(tr);
+    test_sort_type<uint32_t>(tr);
+    test_sort_type<int64_t>(tr);
+    test_sort_type<uint64_t>(tr);
+    test_sort_type<float>(tr);
+    test_sort_type<double>(tr);
+
+    test_sort_by_key_type<int32_t>(tr);
+    test_sort_by_key_type<uint32_t>(tr);
+    test_sort_by_key_type<float>(tr);
+    test_sort_float_order(tr);
+
+    test_set_operations_type<uint32_t>(tr);
+    test_set_operations_type<uint64_t>(tr);
+
+    test_find_bytes(tr);
+    test_utf8_fuzz(tr);
+    test_base64_hex(tr);
+    test_structural_index(tr);
+    test_hash(tr);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
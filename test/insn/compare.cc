@@ -32,8 +32,8 @@ void test_compare_n(TestResultsSet& tc)
     using int16_n = int16<B/2>;
     using uint32_n = uint32<B/4>;
     using int32_n = int32<B/4>;
-#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
     using uint64_n = uint64<B/8>;
+#if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
     using int64_n = int64<B/8>;
 #endif
     using float32_n = float32<B/4>;
@@ -105,6 +105,22 @@ void test_compare_n(TestResultsSet& tc)
     }
 #endif
 
+    //int64_n equality. Some of the values differ in only one 32-bit half
+    {
+        TestData<uint64_n> sl;
+        sl.add(make_uint(0x1111111122222222, 0x1111111133333333));
+        sl.add(make_uint(0x3333333322222222, 0x2222222211111111));
+        sl.add(make_uint(0xffffffff00000000, 0x00000000ffffffff));
+
+        TestData<uint64_n> sr;
+        sr.add(make_uint(0x1111111122222222, 0x1111111122222222));
+        sr.add(make_uint(0x1111111122222222, 0x2222222211111111));
+        sr.add(make_uint(0xffffffffffffffff, 0x0000000000000000));
+
+        TEST_PUSH_ARRAY_OP2(tc, uint64_n, cmp_eq, sl, sr);
+        TEST_PUSH_ARRAY_OP2(tc, uint64_n, cmp_neq, sl, sr);
+    }
+
     float nanf = std::numeric_limits<float>::quiet_NaN();
     double nan = std::numeric_limits<double>::quiet_NaN();
     float inff = std::numeric_limits<float>::infinity();
@@ -11,6 +11,19 @@
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
+// The test results can't hold half-precision vectors, thus compare the bits
+template<unsigned N>
+simdpp::uint16<N> to_float16_bits(const simdpp::float32<N>& a)
+{
+    return simdpp::bit_cast<simdpp::uint16<N>>(simdpp::to_float16(a));
+}
+
+template<unsigned N>
+simdpp::uint16<N> to_bfloat16_bits(const simdpp::float32<N>& a)
+{
+    return simdpp::bit_cast<simdpp::uint16<N>>(simdpp::to_bfloat16(a));
+}
+
 template<unsigned B>
 void test_convert_n(TestResultsSet& ts)
 {
@@ -26,6 +39,8 @@ void test_convert_n(TestResultsSet& ts)
     using  int64_8n = int64<B>;
     using float32_4n = float32<B>;
     using float64_8n = float64<B>;
+    using float16_2n = float16<B>;
+    using bfloat16_2n = bfloat16<B>;
 
     const uint64_t u2_pow_24 = 16777216;
     const uint64_t u2_pow_23 = u2_pow_24 / 2;
@@ -324,6 +339,30 @@ void test_convert_n(TestResultsSet& ts)
     ts.unset_precision();
 #endif
     }
+
+    //float16, bfloat16
+    {
+    TestData<uint16_2n> s;
+    s.add(make_uint(0x0000, 0x8000, 0x3c00, 0xbc00)); // 0, -0, 1, -1
+    s.add(make_uint(0x0001, 0x8001, 0x03ff, 0x0400)); // denormals, min normal
+    s.add(make_uint(0x7bff, 0xfbff, 0x3555, 0x4248)); // max, 1/3, pi
+    s.add(make_uint(0x7c00, 0xfc00, 0x7e00, 0xfe00)); // inf, quiet NaN
+    s.add(make_uint(0x1234, 0x5678, 0x9abc, 0xdef0));
+
+    TEST_PUSH_ARRAY_OP1_T(ts, float32_4n, float16_2n, to_float32, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, float32_4n, bfloat16_2n, to_float32, s);
+
+    TestData<float32_4n> sf;
+    sf.add(make_float(0.0, -0.0, 1.0, -1.0));
+    sf.add(make_float(65504.0, 65519.0, 65520.0, 1e10));
+    sf.add(make_float(6.1035156e-05, 5.9604645e-08, 2.9802322e-08, 1e-10));
+    sf.add(make_float(1.0009766, 1.0004883, 1.0014648, 3.14159265));
+    sf.add(make_uint(0x3f808000, 0x3f818000, 0x3f817fff, 0x7f7fffff));
+    sf.add(make_uint(0x7f800000, 0xff800000, 0x7fc00000, 0x33000001));
+
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n, float32_4n, to_float16_bits, sf);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n, float32_4n, to_bfloat16_bits, sf);
+    }
 }
 
 void test_convert(TestResults& res)
@@ -76,6 +76,70 @@ void test_math_fp_n(TestResultsSet& tc, const TestOptions& opts)
         TEST_PUSH_ARRAY_OP1(tc, float32_n, ceil, s);
         tc.unset_fp_zero_equal();
 
+        TestData<float32_n> sm;
+        sm.add(make_float(0.0f, -0.0f, 1.0f, -1.0f));
+        sm.add(make_float(0.5f, 2.5f, -3.75f, 10.0f));
+        sm.add(make_float(1e-3f, 123.456f, -87.5f, 88.5f));
+        sm.add(make_float(1e-40f, 3.0e+38f, 6.25e-5f, 0.7071f));
+        sm.add(make_float(1.5707964f, 3.1415927f, 4.712389f, -1000.0f));
+        sm.add(make_float(nanf, inff, -inff, -100.0f));
+
+        tc.set_precision(2);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, exp, sm);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, exp2, sm);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, log, sm);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, log2, sm);
+        tc.set_precision(3);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, log1p, sm);
+        tc.unset_precision();
+
+        // the arguments are within the documented range, |a| <= 1e8. Some of
+        // them are next to multiples of pi/2. The reference results are
+        // rounded, thus the tan bound of 3.5 ULP is checked as 4 ULP
+        TestData<float32_n> st;
+        st.add(make_float(0.0f, -0.0f, 1.0f, -1.0f));
+        st.add(make_float(0.5f, 2.5f, -3.75f, 10.0f));
+        st.add(make_float(1e-3f, 123.456f, -87.5f, 88.5f));
+        st.add(make_float(1e-40f, 3000.0f, 6.25e-5f, 0.7071f));
+        st.add(make_float(1.5f, 3.0f, 4.5f, -1000.0f));
+        st.add(make_float(nanf, inff, -inff, -100.0f));
+        st.add(make_float(1.57079637f, 3.14159274f, -6.28318548f, 4.71238899f));
+        st.add(make_float(355.0f, -710.0f, 1e6f, -9.5e7f));
+
+        tc.set_precision(2);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, sin, st);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, cos, st);
+        tc.reset_seq();
+        for (unsigned i = 0; i < st.size(); i++) {
+            float32_n rs, rc;
+            sincos(rs, rc, st.data()[i]);
+            TEST_PUSH(tc, float32_n, rs);
+            TEST_PUSH(tc, float32_n, rc);
+        }
+        tc.set_precision(4);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, tan, st);
+        tc.unset_precision();
+
+        TestData<float32_n> sp;
+        sp.add(make_float(0.0f, -0.0f, 1.0f, -1.0f));
+        sp.add(make_float(2.0f, -2.0f, 0.5f, 3.0f));
+        sp.add(make_float(inff, -inff, nanf, 10.0f));
+
+        tc.set_precision(1);
+        TEST_PUSH_ALL_COMB_OP2(tc, float32_n, pow, sp);
+        tc.unset_precision();
+
+        tc.set_precision(2);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, tanh, sm);
+        tc.set_precision(3);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, sigmoid, sm);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, softplus, sm);
+        tc.set_precision(8);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, erf, sm);
+        tc.set_precision(16);
+        TEST_PUSH_ARRAY_OP1(tc, float32_n, gelu, sm);
+        tc.unset_precision();
+
 #if (SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL) && !SIMDPP_USE_AVX512F
         tc.set_fp_zero_equal();
         TEST_PUSH_ALL_COMB_OP3(tc, float32_n, fmadd, s);
@@ -135,6 +199,73 @@ void test_math_fp_n(TestResultsSet& tc, const TestOptions& opts)
         TEST_PUSH_ARRAY_OP1(tc, float64_n, ceil, s);
         tc.unset_fp_zero_equal();
 
+        TestData<float64_n> sm;
+        sm.add(make_float(0.0, -0.0));
+        sm.add(make_float(1.0, -1.0));
+        sm.add(make_float(0.5, 2.5));
+        sm.add(make_float(-3.75, 10.0));
+        sm.add(make_float(1e-3, 123.456));
+        sm.add(make_float(-700.5, 709.5));
+        sm.add(make_float(1e-310, 1.0e+300));
+        sm.add(make_float(6.25e-5, 0.7071));
+        sm.add(make_float(1.5707963267948966, 3.141592653589793));
+        sm.add(make_float(4.71238898038469, -1000000.0));
+        sm.add(make_float(nan, inf));
+        sm.add(make_float(-inf, -800.0));
+
+        tc.set_precision(2);
+        TEST_PUSH_ARRAY_OP1(tc, float64_n, exp, sm);
+        TEST_PUSH_ARRAY_OP1(tc, float64_n, exp2, sm);
+        TEST_PUSH_ARRAY_OP1(tc, float64_n, log, sm);
+        TEST_PUSH_ARRAY_OP1(tc, float64_n, log2, sm);
+        tc.set_precision(3);
+        TEST_PUSH_ARRAY_OP1(tc, float64_n, log1p, sm);
+        tc.unset_precision();
+
+        // the arguments are within the documented range, |a| <= 1e7
+        TestData<float64_n> st;
+        st.add(make_float(0.0, -0.0));
+        st.add(make_float(1.0, -1.0));
+        st.add(make_float(0.5, 2.5));
+        st.add(make_float(-3.75, 10.0));
+        st.add(make_float(1e-3, 123.456));
+        st.add(make_float(-700.5, 709.5));
+        st.add(make_float(1e-310, 5.0e+6));
+        st.add(make_float(6.25e-5, 0.7071));
+        st.add(make_float(1.5, 3.0));
+        st.add(make_float(4.5, -1000000.0));
+        st.add(make_float(nan, inf));
+        st.add(make_float(-inf, -800.0));
+        st.add(make_float(1.5707963267948966, 3.1415926535897931));
+        st.add(make_float(-6.2831853071795862, 4.7123889803846897));
+        st.add(make_float(355.0, -9.5e6));
+
+        tc.set_precision(2);
+        TEST_PUSH_ARRAY_OP1(tc, float64_n, sin, st);
+        TEST_PUSH_ARRAY_OP1(tc, float64_n, cos, st);
+        tc.reset_seq();
+        for (unsigned i = 0; i < st.size(); i++) {
+            float64_n rs, rc;
+            sincos(rs, rc, st.data()[i]);
+            TEST_PUSH(tc, float64_n, rs);
+            TEST_PUSH(tc, float64_n, rc);
+        }
+        tc.set_precision(4);
+        TEST_PUSH_ARRAY_OP1(tc, float64_n, tan, st);
+        tc.unset_precision();
+
+        TestData<float64_n> sp;
+        sp.add(make_float(0.0, -0.0));
+        sp.add(make_float(1.0, -1.0));
+        sp.add(make_float(2.0, -2.0));
+        sp.add(make_float(0.5, 3.0));
+        sp.add(make_float(inf, -inf));
+        sp.add(make_float(nan, 10.0));
+
+        tc.set_precision(5);
+        TEST_PUSH_ALL_COMB_OP2(tc, float64_n, pow, sp);
+        tc.unset_precision();
+
         TestData<float64_n> snan;
         snan.add(make_float(1.0, 2.0));
         snan.add(make_float(3.0, 4.0));
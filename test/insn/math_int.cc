@@ -8,9 +8,27 @@
 #include "../utils/test_helpers.h"
 #include "../utils/test_results.h"
 #include <simdpp/simd.h>
+#include <initializer_list>
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
+// Divides each vector in the data set by each of the given divisors
+template<class V, class T, class D>
+void test_div_divider(TestResultsSet& tc, const TestData<D>& s,
+                      std::initializer_list<T> divisors)
+{
+    using namespace simdpp;
+    tc.reset_seq();
+    for (T d : divisors) {
+        divider<T> dv(d);
+        for (unsigned i = 0; i < s.size(); i++) {
+            V a = s.data()[i];
+            TEST_PUSH(tc, V, div(a, dv));
+            TEST_PUSH(tc, V, mod(a, dv));
+        }
+    }
+}
+
 template<unsigned B>
 void test_math_int_n(TestResultsSet& tc)
 {
@@ -71,6 +89,9 @@ void test_math_int_n(TestResultsSet& tc)
         TEST_PUSH_ALL_COMB_OP1_T(tc, int8_t, int8_n, reduce_min, s);
         TEST_PUSH_ALL_COMB_OP1_T(tc, uint8_t, uint8_n, reduce_max, s);
         TEST_PUSH_ALL_COMB_OP1_T(tc, int8_t, int8_n, reduce_max, s);
+
+        test_div_divider<uint8_n, uint8_t>(tc, s, { 1, 2, 3, 7, 10, 64, 127, 128, 200, 255 });
+        test_div_divider<int8_n, int8_t>(tc, s, { 1, -1, 2, 3, -7, 10, 64, 127, -128, -100 });
     }
 
     // Vectors with 16-bit integer elements
@@ -128,6 +149,9 @@ void test_math_int_n(TestResultsSet& tc)
         TEST_PUSH_ALL_COMB_OP1_T(tc, int16_t, int16_n, reduce_min, s);
         TEST_PUSH_ALL_COMB_OP1_T(tc, uint16_t, uint16_n, reduce_max, s);
         TEST_PUSH_ALL_COMB_OP1_T(tc, int16_t, int16_n, reduce_max, s);
+
+        test_div_divider<uint16_n, uint16_t>(tc, s, { 1, 2, 3, 7, 10, 641, 0x7fff, 0x8000, 0xc000, 0xffff });
+        test_div_divider<int16_n, int16_t>(tc, s, { 1, -1, 2, 3, -7, 10, 641, 0x7fff, -0x8000, -1000 });
     }
 
     // Vectors with 32-bit integer elements
@@ -165,6 +189,8 @@ void test_math_int_n(TestResultsSet& tc)
 
         TEST_PUSH_ALL_COMB_OP2_T(tc, uint64<B/4>, uint32_n, mull, s);
         TEST_PUSH_ALL_COMB_OP2_T(tc, uint32_n, uint32_n, mul_lo, s);
+        TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, mul_hi, s);
+        TEST_PUSH_ALL_COMB_OP2(tc, int32_n, mul_hi, s);
 
         TEST_PUSH_ARRAY_OP1(tc, int32_n, neg, s);
         TEST_PUSH_ARRAY_OP1(tc, int32_n, abs, s);
@@ -181,6 +207,9 @@ void test_math_int_n(TestResultsSet& tc)
         TEST_PUSH_ALL_COMB_OP1_T(tc, int32_t, int32_n, reduce_min, s);
         TEST_PUSH_ALL_COMB_OP1_T(tc, uint32_t, uint32_n, reduce_max, s);
         TEST_PUSH_ALL_COMB_OP1_T(tc, int32_t, int32_n, reduce_max, s);
+
+        test_div_divider<uint32_n, uint32_t>(tc, s, { 1, 2, 3, 7, 10, 641, 0x7fffffff, 0x80000000, 0xc0000000, 0xffffffff });
+        test_div_divider<int32_n, int32_t>(tc, s, { 1, -1, 2, 3, -7, 10, 641, 0x7fffffff, -0x7fffffff - 1, -100000 });
     }
 
     // Vectors with 64-bit integer elements
@@ -209,6 +238,11 @@ void test_math_int_n(TestResultsSet& tc)
         TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, add, s);
         TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, sub, s);
 
+        TEST_PUSH_ALL_COMB_OP2(tc, int64_n, mul_lo, s);
+        TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, mul_lo, s);
+        TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, mul_hi, s);
+        TEST_PUSH_ALL_COMB_OP2(tc, int64_n, mul_hi, s);
+
 #if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
         TEST_PUSH_ALL_COMB_OP2(tc, int64_n, min, s);
         TEST_PUSH_ALL_COMB_OP2(tc, int64_n, max, s);
@@ -231,6 +265,11 @@ void test_math_int_n(TestResultsSet& tc)
         TEST_PUSH_ALL_COMB_OP1_T(tc, uint64_t, uint64_n, reduce_max, s);
         TEST_PUSH_ALL_COMB_OP1_T(tc, int64_t, int64_n, reduce_max, s);
 #endif
+
+        test_div_divider<uint64_n, uint64_t>(tc, s, { 1, 2, 3, 7, 10, 641, 0x7fffffffffffffff, 0x8000000000000000,
+                                                      0xc000000000000000, 0xffffffffffffffff });
+        test_div_divider<int64_n, int64_t>(tc, s, { 1, -1, 2, 3, -7, 10, 641, 0x7fffffffffffffff,
+                                                    -0x7fffffffffffffff - 1, -10000000000 });
     }
 }
 
@@ -36,6 +36,28 @@ struct Test_shift_r {
     }
 };
 
+// Shifts by a different count in each element
+template<class V, class C>
+void test_shift_v(TestResultsSet& tc, const V* a, unsigned vnum)
+{
+    using T = typename C::element_type;
+    const unsigned bits = sizeof(T) * 8;
+
+    SIMDPP_ALIGN(64) T cdata[C::length];
+    for (unsigned j = 0; j < bits; j++) {
+        for (unsigned i = 0; i < C::length; i++) {
+            cdata[i] = (j + i * 5) % bits;
+        }
+        C c = simdpp::load(cdata);
+        for (unsigned i = 0; i < vnum; i++) {
+            V l = simdpp::shift_l(a[i], c);
+            V r = simdpp::shift_r(a[i], c);
+            TEST_PUSH(tc, V, l);
+            TEST_PUSH(tc, V, r);
+        }
+    }
+}
+
 template<unsigned B>
 void test_math_shift_n(TestResultsSet& tc)
 {
@@ -67,6 +89,13 @@ void test_math_shift_n(TestResultsSet& tc)
     TemplateTestArrayHelper<Test_shift_l, int64<B/8>>::run(tc, v.i64, vnum);
     TemplateTestArrayHelper<Test_shift_r, uint64<B/8>>::run(tc, v.u64, vnum);
     TemplateTestArrayHelper<Test_shift_r, int64<B/8>>::run(tc, v.i64, vnum);
+
+    test_shift_v<uint16<B/2>, uint16<B/2>>(tc, v.u16, vnum);
+    test_shift_v<int16<B/2>, uint16<B/2>>(tc, v.i16, vnum);
+    test_shift_v<uint32<B/4>, uint32<B/4>>(tc, v.u32, vnum);
+    test_shift_v<int32<B/4>, uint32<B/4>>(tc, v.i32, vnum);
+    test_shift_v<uint64<B/8>, uint64<B/8>>(tc, v.u64, vnum);
+    test_shift_v<int64<B/8>, uint64<B/8>>(tc, v.i64, vnum);
 }
 
 void test_math_shift(TestResults& res)
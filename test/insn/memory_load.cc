@@ -98,6 +98,123 @@ void test_load_helper(TestResultsSet& tc, TestReporter& tr, void* sv_p)
     TEST_NOT_EQUAL(tr, zero, rv[3]);
 }
 
+template<class V, class I, unsigned vnum>
+void test_gather_helper(TestResultsSet& tc, TestReporter& tr, void* sv_p)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+    auto sdata = reinterpret_cast<E*>(sv_p);
+
+    SIMDPP_ALIGN(64) IE idata[V::length];
+    SIMDPP_ALIGN(64) E edata[V::length];
+    for (unsigned i = 0; i < V::length; i++) {
+        idata[i] = (i * 5 + 3) % (V::length * vnum);
+        edata[i] = sdata[idata[i]];
+    }
+    I idx = load(idata);
+    V expected = load(edata);
+
+    V r = gather(sdata, idx);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, expected, r);
+
+    V mv = make_int(0, 1);
+    typename V::mask_vector_type mask;
+    mask = bit_not(cmp_eq(mv, 0));
+
+    r = gather_masked(sdata, idx, mask);
+    TEST_PUSH(tc, V, r);
+    TEST_EQUAL(tr, bit_and(expected, mask), r);
+}
+
+template<class V, unsigned vnum>
+void test_load_expand(TestResultsSet& tc, TestReporter& tr, void* sv_p)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    auto sdata = reinterpret_cast<E*>(sv_p);
+
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) E edata[V::length];
+
+    // all lanes, no lanes and several pseudo-random combinations of lanes.
+    // The source is misaligned by one element.
+    uint32_t seed = 1;
+    for (unsigned k = 0; k < 8; k++) {
+        unsigned n = 1;
+        for (unsigned i = 0; i < V::length; i++) {
+            seed = seed * 1103515245 + 12345;
+            bool active = k == 0 || (k != 1 && (seed >> 16) % 3 != 0);
+            mdata[i] = active ? 1 : 0;
+            edata[i] = active ? sdata[n++] : 0;
+        }
+        V mv = load(mdata);
+        V expected = load(edata);
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(mv, 0);
+
+        V r = load_expand(sdata + 1, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, expected, r);
+
+        // the source has room for a whole vector past the loaded elements
+        r = load_expand_unsafe_tail(sdata + 1, mask);
+        TEST_EQUAL(tr, expected, r);
+    }
+}
+
+template<class V, unsigned vnum>
+void test_load_partial(TestResultsSet& tc, TestReporter& tr, void* sv_p)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    auto sdata = reinterpret_cast<E*>(sv_p);
+
+    SIMDPP_ALIGN(64) E edata[V::length];
+
+    // the source is misaligned by one element
+    for (unsigned n = 0; n <= V::length + 1; n++) {
+        for (unsigned i = 0; i < V::length; i++)
+            edata[i] = i < n ? sdata[i + 1] : 0;
+        V expected = load(edata);
+
+        V r = load_partial(sdata + 1, n);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, expected, r);
+
+        r = load_partial<V>(sdata + 1, n);
+        TEST_EQUAL(tr, expected, r);
+    }
+}
+
+template<class V, unsigned vnum>
+void test_load_masked(TestResultsSet& tc, TestReporter& tr, void* sv_p)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    auto sdata = reinterpret_cast<E*>(sv_p);
+
+    SIMDPP_ALIGN(64) E mdata[V::length];
+
+    uint32_t seed = 3;
+    for (unsigned k = 0; k < 8; k++) {
+        for (unsigned i = 0; i < V::length; i++) {
+            seed = seed * 1103515245 + 12345;
+            mdata[i] = (k == 0 || (k != 1 && (seed >> 16) % 3 != 0)) ? 1 : 0;
+        }
+        V mv = load(mdata);
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(mv, 0);
+        V expected = load(sdata);
+        expected = bit_and(expected, mask);
+
+        V r = load_masked(sdata, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, expected, r);
+    }
+}
+
 template<unsigned B>
 void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 {
@@ -119,6 +236,55 @@ void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 
     test_load_helper<float32<B/4>, vnum>(tc, tr, v.f32);
     test_load_helper<float64<B/8>, vnum>(tc, tr, v.f64);
+
+    test_load_expand<uint8<B>, vnum>(tc, tr, v.u8);
+    test_load_expand<uint16<B/2>, vnum>(tc, tr, v.u16);
+    test_load_expand<uint32<B/4>, vnum>(tc, tr, v.u32);
+    test_load_expand<uint64<B/8>, vnum>(tc, tr, v.u64);
+    test_load_expand<int8<B>, vnum>(tc, tr, v.i8);
+    test_load_expand<int16<B/2>, vnum>(tc, tr, v.i16);
+    test_load_expand<int32<B/4>, vnum>(tc, tr, v.i32);
+    test_load_expand<int64<B/8>, vnum>(tc, tr, v.i64);
+    test_load_expand<float32<B/4>, vnum>(tc, tr, v.f32);
+    test_load_expand<float64<B/8>, vnum>(tc, tr, v.f64);
+
+    test_load_partial<uint8<B>, vnum>(tc, tr, v.u8);
+    test_load_partial<uint16<B/2>, vnum>(tc, tr, v.u16);
+    test_load_partial<uint32<B/4>, vnum>(tc, tr, v.u32);
+    test_load_partial<uint64<B/8>, vnum>(tc, tr, v.u64);
+    test_load_partial<int8<B>, vnum>(tc, tr, v.i8);
+    test_load_partial<int16<B/2>, vnum>(tc, tr, v.i16);
+    test_load_partial<int32<B/4>, vnum>(tc, tr, v.i32);
+    test_load_partial<int64<B/8>, vnum>(tc, tr, v.i64);
+    test_load_partial<float32<B/4>, vnum>(tc, tr, v.f32);
+    test_load_partial<float64<B/8>, vnum>(tc, tr, v.f64);
+
+    test_load_masked<uint32<B/4>, vnum>(tc, tr, v.u32);
+    test_load_masked<uint64<B/8>, vnum>(tc, tr, v.u64);
+    test_load_masked<float32<B/4>, vnum>(tc, tr, v.f32);
+    test_load_masked<float64<B/8>, vnum>(tc, tr, v.f64);
+
+    test_gather_helper<uint32<B/4>, uint32<B/4>, vnum>(tc, tr, v.u32);
+    test_gather_helper<int32<B/4>, uint32<B/4>, vnum>(tc, tr, v.i32);
+    test_gather_helper<float32<B/4>, uint32<B/4>, vnum>(tc, tr, v.f32);
+    test_gather_helper<uint64<B/8>, uint64<B/8>, vnum>(tc, tr, v.u64);
+    test_gather_helper<int64<B/8>, uint64<B/8>, vnum>(tc, tr, v.i64);
+    test_gather_helper<float64<B/8>, uint64<B/8>, vnum>(tc, tr, v.f64);
+}
+
+// 32-bit index vectors are at least 128 bits wide, thus 64-bit elements can
+// be addressed by 32-bit indices only in vectors of at least 4 elements
+template<unsigned B>
+void test_gather_idx32_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    const unsigned vnum = 4;
+    Vectors<B,vnum> v;
+
+    test_gather_helper<uint64<B/8>, uint32<B/8>, vnum>(tc, tr, v.u64);
+    test_gather_helper<int64<B/8>, uint32<B/8>, vnum>(tc, tr, v.i64);
+    test_gather_helper<float64<B/8>, uint32<B/8>, vnum>(tc, tr, v.f64);
 }
 
 void test_memory_load(TestResults& res, TestReporter& tr)
@@ -128,6 +294,8 @@ void test_memory_load(TestResults& res, TestReporter& tr)
     test_memory_load_n<16>(tc, tr);
     test_memory_load_n<32>(tc, tr);
     test_memory_load_n<64>(tc, tr);
+    test_gather_idx32_n<32>(tc, tr);
+    test_gather_idx32_n<64>(tc, tr);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
@@ -47,6 +47,136 @@ void test_store_masked(TestResultsSet& tc, TestReporter& tr, const V* sv)
 
 }
 
+template<class V>
+void test_store_compress(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) V rv[2];
+    SIMDPP_ALIGN(64) V ev[2];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    auto rdata = reinterpret_cast<E*>(rv);
+    auto edata = reinterpret_cast<E*>(ev);
+    auto sdata = reinterpret_cast<const E*>(sv);
+
+    // all lanes, no lanes and several pseudo-random combinations of lanes.
+    // The destination is misaligned by one element.
+    uint32_t seed = 1;
+    for (unsigned k = 0; k < 8; k++) {
+        for (unsigned i = 0; i < V::length; i++) {
+            seed = seed * 1103515245 + 12345;
+            bool active = k == 0 || (k != 1 && (seed >> 16) % 3 != 0);
+            mdata[i] = active ? 1 : 0;
+        }
+        V mv = load(mdata);
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(mv, 0);
+
+        std::memset(rv, 0, sizeof(rv));
+        std::memset(ev, 0, sizeof(ev));
+        unsigned expected_n = 0;
+        for (unsigned i = 0; i < V::length; i++) {
+            if (mdata[i] != 0) {
+                edata[1 + expected_n++] = sdata[i];
+            }
+        }
+        unsigned n = store_compress(rdata + 1, sv[0], mask);
+        TEST_PUSH_ARRAY(tc, V, rv);
+        TEST_EQUAL(tr, ev[0], rv[0]);
+        TEST_EQUAL(tr, ev[1], rv[1]);
+        TEST_EQUAL(tr, expected_n, n);
+
+        // the destination has room for a whole vector past the stored
+        // elements. The memory past them is unspecified and is cleared
+        std::memset(rv, 0, sizeof(rv));
+        n = store_compress_unsafe_tail(rdata + 1, sv[0], mask);
+        std::memset(rdata + 1 + expected_n, 0,
+                    sizeof(rv) - (1 + expected_n) * sizeof(E));
+        TEST_EQUAL(tr, ev[0], rv[0]);
+        TEST_EQUAL(tr, ev[1], rv[1]);
+        TEST_EQUAL(tr, expected_n, n);
+    }
+}
+
+template<class V>
+void test_store_partial(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) V rv[2];
+    SIMDPP_ALIGN(64) V ev[2];
+    auto rdata = reinterpret_cast<E*>(rv);
+    auto edata = reinterpret_cast<E*>(ev);
+    auto sdata = reinterpret_cast<const E*>(sv);
+
+    // the destination is misaligned by one element
+    for (unsigned n = 0; n <= V::length + 1; n++) {
+        std::memset(rv, 0, sizeof(rv));
+        std::memset(ev, 0, sizeof(ev));
+        for (unsigned i = 0; i < n && i < V::length; i++)
+            edata[1 + i] = sdata[i];
+
+        store_partial(rdata + 1, sv[0], n);
+        TEST_PUSH_ARRAY(tc, V, rv);
+        TEST_EQUAL(tr, ev[0], rv[0]);
+        TEST_EQUAL(tr, ev[1], rv[1]);
+    }
+}
+
+template<class V, class I>
+void test_scatter(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+
+    SIMDPP_ALIGN(64) V rv[2];
+    SIMDPP_ALIGN(64) V ev[2];
+    SIMDPP_ALIGN(64) IE idata[V::length];
+    auto rdata = reinterpret_cast<E*>(rv);
+    auto edata = reinterpret_cast<E*>(ev);
+    auto sdata = reinterpret_cast<const E*>(sv);
+
+    // the indices are distinct, as the step is coprime with the array length
+    for (unsigned i = 0; i < V::length; i++) {
+        idata[i] = (i * 5 + 3) % (V::length * 2);
+    }
+    I idx = load(idata);
+
+    std::memset(rv, 0, sizeof(rv));
+    std::memset(ev, 0, sizeof(ev));
+    for (unsigned i = 0; i < V::length; i++) {
+        edata[idata[i]] = sdata[i];
+    }
+    scatter(rdata, idx, sv[0]);
+    TEST_PUSH_ARRAY(tc, V, rv);
+    TEST_EQUAL(tr, ev[0], rv[0]);
+    TEST_EQUAL(tr, ev[1], rv[1]);
+
+    V mv = make_int(0, 1);
+    typename V::mask_vector_type mask;
+    mask = bit_not(cmp_eq(mv, 0));
+
+    std::memset(rv, 0, sizeof(rv));
+    std::memset(ev, 0, sizeof(ev));
+    for (unsigned i = 1; i < V::length; i += 2) {
+        edata[idata[i]] = sdata[i];
+    }
+    scatter_masked(rdata, idx, sv[0], mask);
+    TEST_PUSH_ARRAY(tc, V, rv);
+    TEST_EQUAL(tr, ev[0], rv[0]);
+    TEST_EQUAL(tr, ev[1], rv[1]);
+
+    // when several lanes refer to the same location, the last lane wins
+    I zero_idx = make_zero();
+    std::memset(rv, 0, sizeof(rv));
+    scatter(rdata, zero_idx, sv[0]);
+    TEST_PUSH_ARRAY(tc, V, rv);
+    TEST_EQUAL(tr, sdata[V::length - 1], rdata[0]);
+}
+
 template<class V, unsigned vnum>
 void test_store_helper(TestResultsSet& tc, TestReporter& tr, const V* sv)
 {
@@ -169,6 +299,50 @@ void test_memory_store_n(TestResultsSet& tc, TestReporter& tr)
     test_store_masked<int64<B/8>>(tc, tr, v.i64);
     test_store_masked<float32<B/4>>(tc, tr, v.f32);
     test_store_masked<float64<B/8>>(tc, tr, v.f64);
+
+    test_store_partial<uint8<B>>(tc, tr, v.u8);
+    test_store_partial<uint16<B/2>>(tc, tr, v.u16);
+    test_store_partial<uint32<B/4>>(tc, tr, v.u32);
+    test_store_partial<uint64<B/8>>(tc, tr, v.u64);
+    test_store_partial<int8<B>>(tc, tr, v.i8);
+    test_store_partial<int16<B/2>>(tc, tr, v.i16);
+    test_store_partial<int32<B/4>>(tc, tr, v.i32);
+    test_store_partial<int64<B/8>>(tc, tr, v.i64);
+    test_store_partial<float32<B/4>>(tc, tr, v.f32);
+    test_store_partial<float64<B/8>>(tc, tr, v.f64);
+
+    test_store_compress<uint8<B>>(tc, tr, v.u8);
+    test_store_compress<uint16<B/2>>(tc, tr, v.u16);
+    test_store_compress<uint32<B/4>>(tc, tr, v.u32);
+    test_store_compress<uint64<B/8>>(tc, tr, v.u64);
+    test_store_compress<int8<B>>(tc, tr, v.i8);
+    test_store_compress<int16<B/2>>(tc, tr, v.i16);
+    test_store_compress<int32<B/4>>(tc, tr, v.i32);
+    test_store_compress<int64<B/8>>(tc, tr, v.i64);
+    test_store_compress<float32<B/4>>(tc, tr, v.f32);
+    test_store_compress<float64<B/8>>(tc, tr, v.f64);
+
+    test_scatter<uint32<B/4>, uint32<B/4>>(tc, tr, v.u32);
+    test_scatter<int32<B/4>, uint32<B/4>>(tc, tr, v.i32);
+    test_scatter<float32<B/4>, uint32<B/4>>(tc, tr, v.f32);
+    test_scatter<uint64<B/8>, uint64<B/8>>(tc, tr, v.u64);
+    test_scatter<int64<B/8>, uint64<B/8>>(tc, tr, v.i64);
+    test_scatter<float64<B/8>, uint64<B/8>>(tc, tr, v.f64);
+}
+
+// 32-bit index vectors are at least 128 bits wide, thus 64-bit elements can
+// be addressed by 32-bit indices only in vectors of at least 4 elements
+template<unsigned B>
+void test_scatter_idx32_n(TestResultsSet& tc, TestReporter& tr)
+{
+    using namespace simdpp;
+
+    const unsigned vnum = 4;
+    Vectors<B,vnum> v;
+
+    test_scatter<uint64<B/8>, uint32<B/8>>(tc, tr, v.u64);
+    test_scatter<int64<B/8>, uint32<B/8>>(tc, tr, v.i64);
+    test_scatter<float64<B/8>, uint32<B/8>>(tc, tr, v.f64);
 }
 
 void test_memory_store(TestResults& res, TestReporter& tr)
@@ -178,6 +352,8 @@ void test_memory_store(TestResults& res, TestReporter& tr)
     test_memory_store_n<16>(tc, tr);
     test_memory_store_n<32>(tc, tr);
     test_memory_store_n<64>(tc, tr);
+    test_scatter_idx32_n<32>(tc, tr);
+    test_scatter_idx32_n<64>(tc, tr);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
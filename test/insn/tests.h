@@ -17,6 +17,7 @@
 namespace SIMDPP_ARCH_NAMESPACE {
 
 void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& opts);
+void test_algorithm(TestResults& res, TestReporter& tr);
 void test_bitwise(TestResults& res, TestReporter& tr);
 void test_blend(TestResults& res);
 void test_compare(TestResults& res);
@@ -9,9 +9,16 @@
 #include <algorithm>
 #include <iostream>
 #include <string>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include "utils/test_helpers.h"
 
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
 // Check whether all available getters of supported architecture compiles
 // on all compilers
 #include <simdpp/dispatch/get_arch_gcc_builtin_cpu_supports.h>
@@ -91,6 +98,188 @@ void test_dispatcher_template2_pair_for_type(TestReporter& tr)
     TEST_EQUAL(tr, (U)(sizeof(U)), pair.second);
 }
 
+bool find_dispatch_info(const char* name, simdpp::DispatchInfo& info)
+{
+    for (const auto& i : simdpp::get_dispatch_info()) {
+        if (std::strcmp(i.name, name) == 0) {
+            info = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+void test_dispatcher_registry(TestReporter& tr)
+{
+    simdpp::DispatchInfo info;
+    bool found = find_dispatch_info("test_dispatcher_get_arch", info);
+    TEST_EQUAL(tr, true, found);
+    if (found) {
+        TEST_EQUAL(tr, true, info.arch_name != nullptr);
+    }
+
+    // Indirect function dispatchers are registered when resolved
+    found = find_dispatch_info("test_dispatcher_ifunc_get_arch", info);
+    TEST_EQUAL(tr, true, found);
+
+    // Template dispatchers are listed under the name of the template
+    found = find_dispatch_info("test_dispatcher_void_template_pair", info);
+    TEST_EQUAL(tr, true, found);
+}
+
+void test_dispatcher_arch_mask(TestReporter& tr)
+{
+    using simdpp::Arch;
+
+    Arch prev_mask = simdpp::get_dispatch_arch_mask();
+
+    // The already resolved dispatchers must select the version again
+    simdpp::set_dispatch_arch_mask(Arch::NONE_NULL);
+    TEST_EQUAL(tr, static_cast<unsigned>(Arch::NONE_NULL),
+               static_cast<unsigned>(test_dispatcher_get_arch()));
+    TEST_EQUAL(tr, 1+2, test_dispatcher_ret2(1, 2));
+
+    simdpp::set_dispatch_arch_mask(prev_mask);
+    TEST_EQUAL(tr, static_cast<unsigned>(g_supported_arch),
+               static_cast<unsigned>(test_dispatcher_get_arch()));
+
+#if defined(__unix__)
+    const char* ids[] = { "sse2", "sse3" };
+    Arch expected = simdpp::get_arch_string_list(ids, 2, "");
+    setenv("SIMDPP_DISPATCH_ARCH", "sse2, sse3", 1);
+    Arch env_mask = simdpp::detail::get_dispatch_arch_mask_from_env();
+    unsetenv("SIMDPP_DISPATCH_ARCH");
+    TEST_EQUAL(tr, static_cast<unsigned>(expected),
+               static_cast<unsigned>(env_mask));
+
+#if SIMDPP_X86
+    // The documented example must select the AVX2 configuration built by
+    // simdpp_get_compilable_archs()
+    Arch avx2_config = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+            Arch::X86_SSE4_1 | Arch::X86_SSE4_2 | Arch::X86_AVX |
+            Arch::X86_AVX2 | Arch::X86_FMA3 | Arch::X86_F16C |
+            Arch::X86_POPCNT_INSN;
+    setenv("SIMDPP_DISPATCH_ARCH", "avx2,fma3,popcnt", 1);
+    env_mask = simdpp::detail::get_dispatch_arch_mask_from_env();
+    unsetenv("SIMDPP_DISPATCH_ARCH");
+    TEST_EQUAL(tr, true, simdpp::test_arch_subset(env_mask, avx2_config));
+    TEST_EQUAL(tr, false, simdpp::test_arch_subset(env_mask, avx2_config |
+                                                   Arch::X86_AVX512F));
+#endif
+#endif
+}
+
+void test_dispatcher_dummy_version() {}
+
+void test_dispatcher_prefer_vector_width(TestReporter& tr)
+{
+    using simdpp::Arch;
+    using simdpp::detail::get_arch_mask_for_vector_width;
+
+    unsigned prev_width = simdpp::get_dispatch_prefer_vector_width();
+
+    // The per-dispatcher preference takes effect regardless of the global one
+    Arch expected = g_supported_arch & get_arch_mask_for_vector_width(128);
+    TEST_EQUAL(tr, static_cast<unsigned>(expected),
+               static_cast<unsigned>(test_dispatcher_narrow_get_arch()));
+
+    const unsigned widths[] = { 128, 256, 512 };
+    for (unsigned width : widths) {
+        simdpp::set_dispatch_prefer_vector_width(width);
+        expected = g_supported_arch & get_arch_mask_for_vector_width(width);
+        TEST_EQUAL(tr, static_cast<unsigned>(expected),
+                   static_cast<unsigned>(test_dispatcher_get_arch()));
+        TEST_EQUAL(tr, static_cast<unsigned>(g_supported_arch &
+                                        get_arch_mask_for_vector_width(128)),
+                   static_cast<unsigned>(test_dispatcher_narrow_get_arch()));
+    }
+
+    simdpp::set_dispatch_prefer_vector_width(prev_width);
+    TEST_EQUAL(tr, static_cast<unsigned>(g_supported_arch),
+               static_cast<unsigned>(test_dispatcher_get_arch()));
+
+    // If no version fits the preference, the widest supported one is used
+    simdpp::detail::FnVersion versions[2] = {};
+    versions[0].needed_arch = Arch::X86_SSE2 | Arch::X86_AVX;
+    versions[0].fun_ptr = &test_dispatcher_dummy_version;
+    versions[1].needed_arch = Arch::X86_SSE2 | Arch::X86_AVX | Arch::X86_AVX2;
+    versions[1].fun_ptr = versions[0].fun_ptr;
+    simdpp::detail::FnVersion version =
+            simdpp::detail::select_version_preferred(versions, 2,
+                                                     versions[1].needed_arch,
+                                                     128);
+    TEST_EQUAL(tr, static_cast<unsigned>(versions[1].needed_arch),
+               static_cast<unsigned>(version.needed_arch));
+}
+
+/*  Makes the versions requiring fewer instruction sets cheaper, so that the
+    autotuning dispatcher selects a different version than the regular
+    dispatchers.
+*/
+std::uint64_t test_dispatcher_autotune_cost(const simdpp::detail::FnVersion& version)
+{
+    unsigned bits = static_cast<unsigned>(version.needed_arch);
+    std::uint64_t count = 0;
+    for (; bits != 0; bits &= bits - 1) {
+        count++;
+    }
+    return count + 1;
+}
+
+void test_dispatcher_autotune(TestReporter& tr)
+{
+    using simdpp::Arch;
+
+    simdpp::detail::set_autotune_cost_hook(&test_dispatcher_autotune_cost);
+    TEST_EQUAL(tr, static_cast<unsigned>(Arch::NONE_NULL),
+               static_cast<unsigned>(test_dispatcher_autotune_get_arch()));
+
+#if defined(__unix__)
+    simdpp::DispatchInfo info;
+    bool found = find_dispatch_info("test_dispatcher_get_arch", info);
+    TEST_EQUAL(tr, true, found);
+    if (found) {
+        const char* tmpdir = std::getenv("TMPDIR");
+        std::string path = std::string(tmpdir != nullptr && *tmpdir != '\0' ?
+                                       tmpdir : "/tmp");
+        path += "/test_dispatcher_autotune_XXXXXX";
+        int fd = mkstemp(&path[0]);
+        TEST_EQUAL(tr, true, fd != -1);
+        if (fd != -1) {
+            close(fd);
+            std::string cpu_model = simdpp::detail::get_autotune_cpu_model();
+            setenv("SIMDPP_AUTOTUNE_CACHE", path.c_str(), 1);
+
+            // The decision is stored to the cache
+            simdpp::set_dispatch_arch_mask(simdpp::get_dispatch_arch_mask());
+            TEST_EQUAL(tr, static_cast<unsigned>(Arch::NONE_NULL),
+                       static_cast<unsigned>(test_dispatcher_autotune_get_arch()));
+            std::string cached = simdpp::detail::autotune_cache_lookup(
+                        path.c_str(), cpu_model, "test_dispatcher_autotune_get_arch");
+            TEST_EQUAL(tr, false, cached.empty());
+
+            // The decision is loaded from the cache without evaluating the
+            // versions
+            simdpp::detail::autotune_cache_store(path.c_str(), cpu_model,
+                                                 "test_dispatcher_autotune_get_arch",
+                                                 info.arch_name);
+            simdpp::set_dispatch_arch_mask(simdpp::get_dispatch_arch_mask());
+            TEST_EQUAL(tr, static_cast<unsigned>(g_supported_arch),
+                       static_cast<unsigned>(test_dispatcher_autotune_get_arch()));
+
+            unsetenv("SIMDPP_AUTOTUNE_CACHE");
+            std::remove(path.c_str());
+        }
+    }
+#endif
+
+    // Without the hook the versions are timed. Any supported version may win
+    simdpp::detail::set_autotune_cost_hook(nullptr);
+    simdpp::set_dispatch_arch_mask(simdpp::get_dispatch_arch_mask());
+    Arch timed = test_dispatcher_autotune_get_arch();
+    TEST_EQUAL(tr, true, simdpp::test_arch_subset(g_supported_arch, timed));
+}
+
 int main(int argc, char** argv)
 {
     using simdpp::Arch;
@@ -154,6 +343,19 @@ int main(int argc, char** argv)
     }
     tr.add_result(true);
 
+    // The version selected by the indirect function must be the same as the
+    // version selected by the function pointer dispatcher. The indirect
+    // functions ignore the dispatch arch mask and the global preferred vector
+    // width, thus they are cleared first.
+    Arch prev_mask = simdpp::get_dispatch_arch_mask();
+    unsigned prev_width = simdpp::get_dispatch_prefer_vector_width();
+    simdpp::set_dispatch_arch_mask(static_cast<Arch>(~0u));
+    simdpp::set_dispatch_prefer_vector_width(0);
+    TEST_EQUAL(tr, static_cast<unsigned>(test_dispatcher_ptr_get_arch()),
+               static_cast<unsigned>(test_dispatcher_ifunc_get_arch()));
+    simdpp::set_dispatch_arch_mask(prev_mask);
+    simdpp::set_dispatch_prefer_vector_width(prev_width);
+
     TEST_EQUAL(tr, 42, test_dispatcher_old_ret0());
     TEST_EQUAL(tr, 1, test_dispatcher_old_ret1(1));
     TEST_EQUAL(tr, 1+2, test_dispatcher_old_ret2(1, 2));
@@ -236,6 +438,11 @@ int main(int argc, char** argv)
     test_dispatcher_template2_pair_for_type<int, char>(tr);
     test_dispatcher_template2_pair_for_type<char, char>(tr);
 
+    test_dispatcher_registry(tr);
+    test_dispatcher_arch_mask(tr);
+    test_dispatcher_prefer_vector_width(tr);
+    test_dispatcher_autotune(tr);
+
     tr.report_summary();
     return tr.success() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,652 @@
+#!/usr/bin/env python3
+
+#   Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+#
+# Distributed under the Boost Software License, Version 1.0.
+#   (See accompanying file LICENSE_1_0.txt or copy at
+#          http://www.boost.org/LICENSE_1_0.txt)
+
+# Verifies the @icost annotations in the documentation of the functions in
+# simdpp/core against the code generated by the compiler.
+#
+# For each annotated function and each x86 instruction set covered by the
+# annotations a small probe function is generated that calls the documented
+# function with vector arguments of the documented width. The probes are
+# compiled, disassembled with objdump and the instructions of each probe are
+# counted. The instructions that only pass the arguments and the result, e.g.
+# loads and stores relative to the stack or the argument pointers, register to
+# register moves and zeroing and all-ones idioms are not counted. A constant
+# counts as a single load regardless of how it is materialized, e.g. a load
+# relative to %rip or a movabs/vmovq/vpunpcklqdq sequence.
+#
+# Functions whose arguments are not vectors or whose template arguments can't
+# be deduced, except for leading integer template arguments, are not checked.
+#
+# Use as
+# $ ./tools/check_icost.py --cxx g++ --objdump objdump > icost.csv
+#
+# The status of each probe is one of the following: "ok" if the number of
+# instructions is within the annotated range, "mismatch" if it is not,
+# "unavailable" if the operation is not available for the instruction set,
+# "not_inlined" if the probe calls another function and "error" if the probe
+# could not be compiled.
+#
+# The cost table is printed in CSV (default) or JSON format. Mismatches are
+# additionally listed on stderr. The exit status is nonzero on mismatches
+# only if --strict is given.
+
+import argparse
+import glob
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+# The x86 instruction sets in the order used by ranges such as SSE2-AVX2
+x86_order = ['SSE2', 'SSE3', 'SSSE3', 'SSE4.1', 'AVX', 'AVX2',
+             'AVX512F', 'AVX512BW', 'AVX512DQ']
+
+# The instruction sets that can be checked: name -> (compiler flags, macros)
+x86_archs = {
+    'SSE2': (['-msse2'], ['X86_SSE2']),
+    'SSE3': (['-msse3'], ['X86_SSE3']),
+    'SSSE3': (['-mssse3'], ['X86_SSSE3']),
+    'SSE4.1': (['-msse4.1'], ['X86_SSE4_1']),
+    'AVX': (['-mavx'], ['X86_AVX']),
+    'AVX2': (['-mavx2'], ['X86_AVX2']),
+    'AVX512F': (['-mavx512f'], ['X86_AVX512F']),
+    'AVX512BW': (['-mavx512bw'], ['X86_AVX512BW']),
+    'AVX512DQ': (['-mavx512dq'], ['X86_AVX512DQ']),
+    'XOP': (['-mxop'], ['X86_XOP']),
+    'F16C': (['-mavx', '-mf16c'], ['X86_AVX', 'X86_F16C']),
+}
+
+# The instruction sets that are known, but can't be checked by this script
+other_archs = ['NEON', 'NEON_FLT_SP', 'ALTIVEC', 'VSX_206', 'VSX_207', 'MSA',
+               'FMA3', 'FMA4', 'POPCNT']
+
+# Maps the abstract argument types to concrete vector types
+abstract_types = {
+    'any_vec8': 'uint8', 'any_vec16': 'uint16', 'any_vec32': 'uint32',
+    'any_vec64': 'uint64', 'any_int8': 'uint8', 'any_int16': 'uint16',
+    'any_int32': 'uint32', 'any_int64': 'uint64',
+    'any_float32': 'float32', 'any_float64': 'float64',
+}
+
+element_bits = {
+    'int8': 8, 'uint8': 8, 'mask_int8': 8,
+    'int16': 16, 'uint16': 16, 'mask_int16': 16,
+    'int32': 32, 'uint32': 32, 'mask_int32': 32,
+    'int64': 64, 'uint64': 64, 'mask_int64': 64,
+    'float32': 32, 'mask_float32': 32,
+    'float64': 64, 'mask_float64': 64,
+}
+
+class Annotation:
+    def __init__(self, archs, cost_min, cost_max, text):
+        self.archs = archs
+        self.cost_min = cost_min
+        self.cost_max = cost_max
+        self.text = text
+
+class Operation:
+    def __init__(self, path, line, name, explicit_args, arg_types):
+        self.path = path
+        self.line = line
+        self.name = name
+        self.explicit_args = explicit_args
+        self.arg_types = arg_types
+        # width in bits -> list of Annotation
+        self.annotations = {}
+
+class Probe:
+    def __init__(self, op, width, arch, annotation):
+        self.op = op
+        self.width = width
+        self.arch = arch
+        self.annotation = annotation
+        self.count = None
+        self.status = 'error'
+
+def split_top_level(text, sep=','):
+    ''' Splits text at the separators that are not nested in any brackets
+    '''
+    res = []
+    depth = 0
+    cur = ''
+    for c in text:
+        if c in '<([':
+            depth += 1
+        elif c in '>)]':
+            depth -= 1
+        if c == sep and depth == 0:
+            res.append(cur.strip())
+            cur = ''
+        else:
+            cur += c
+    if cur.strip() != '':
+        res.append(cur.strip())
+    return res
+
+def expand_arch_range(token):
+    ''' Returns the list of instruction sets identified by a token such as
+        "SSE2-AVX" or "NEON". Returns None if the token is not known.
+    '''
+    if '-' in token:
+        first, last = token.split('-', 1)
+        if first in x86_order and last in x86_order:
+            i, j = x86_order.index(first), x86_order.index(last)
+            return x86_order[i:j+1]
+        return None
+    if token in x86_archs or token in other_archs:
+        return [token]
+    return None
+
+def parse_icost(text, warn):
+    ''' Parses the contents of @icost{...}. Returns None on failure.
+    '''
+    # Strip remarks such as "(integer vectors)"
+    body = re.sub(r'\([^)]*\)', ' ', text)
+    tokens = [t for t in re.split(r'[\s,]+', body) if t != '']
+    if len(tokens) < 2:
+        return None
+    m = re.match(r'^(\d+)(?:-(\d+))?$', tokens[-1])
+    if m is None:
+        return None
+    cost_min = int(m.group(1))
+    cost_max = int(m.group(2)) if m.group(2) else cost_min
+
+    archs = []
+    for token in tokens[:-1]:
+        expanded = expand_arch_range(token)
+        if expanded is None:
+            warn('unknown instruction set "{0}" in @icost{{{1}}}'.format(
+                 token, text))
+            continue
+        archs += expanded
+    return Annotation(archs, cost_min, cost_max, text)
+
+def parse_declaration(decl):
+    ''' Parses the declaration of a function template following a
+        documentation comment. Returns (name, explicit_args, arg_types) or
+        None if the function can't be probed.
+    '''
+    m = re.match(r'\s*template\s*<(.*?)>\s*SIMDPP_INL\s+(.*)$', decl, re.S)
+    if m is None:
+        return None
+    template_params = split_top_level(m.group(1))
+    rest = m.group(2)
+
+    m = re.search(r'(\w+)\s*\((.*)\)\s*$', rest, re.S)
+    if m is None:
+        return None
+    name = m.group(1)
+    params = split_top_level(m.group(2))
+
+    # Leading integer template parameters are passed explicitly. The others
+    # must be deducible from the arguments.
+    explicit_args = []
+    deduced = False
+    for p in template_params:
+        pm = re.match(r'^(unsigned|int)\s+(\w+)$', p)
+        if pm is not None and pm.group(2) != 'N':
+            if deduced:
+                return None
+            explicit_args.append('1')
+            continue
+        if pm is not None or re.match(r'^class\s+[EV]\d*$', p):
+            deduced = True
+            continue
+        return None
+
+    arg_types = []
+    for p in params:
+        pm = re.match(r'^const\s+(\w+)\s*<\s*N\s*,\s*\w+\s*>\s*&\s*\w+$', p)
+        if pm is None:
+            pm = re.match(r'^const\s+(\w+?)x\d+\s*&\s*\w+$', p)
+        if pm is None:
+            return None
+        t = abstract_types.get(pm.group(1), pm.group(1))
+        if t not in element_bits or t.startswith('mask_'):
+            return None
+        arg_types.append(t)
+    if len(arg_types) == 0:
+        return None
+    return (name, explicit_args, arg_types)
+
+def parse_header(path, rel_path, warn):
+    with open(path) as f:
+        text = f.read()
+
+    ops = []
+    for m in re.finditer(r'/\*\*(.*?)\*/', text, re.S):
+        comment = m.group(1)
+        if '@icost' not in comment:
+            continue
+        line = text.count('\n', 0, m.end()) + 2
+
+        end = text.find('{', m.end())
+        if end < 0:
+            continue
+        parsed = parse_declaration(text[m.end():end])
+        if parsed is None:
+            continue
+        op = Operation(rel_path, line, *parsed)
+
+        width = 128
+        for cline in comment.split('\n'):
+            pm = re.search(r'@par\s+(\d+)-bit version', cline)
+            if pm is not None:
+                width = int(pm.group(1))
+            for im in re.finditer(r'@icost\{([^}]*)\}', cline):
+                ann = parse_icost(im.group(1), lambda msg: warn(
+                        '{0}:{1}: {2}'.format(rel_path, line, msg)))
+                if ann is not None:
+                    op.annotations.setdefault(width, []).append(ann)
+        ops.append(op)
+    return ops
+
+def find_annotation(annotations, arch):
+    for ann in annotations:
+        if arch in ann.archs:
+            return ann
+    return None
+
+def probe_source(probes):
+    ''' Returns the source of the file containing the given probes and a map
+        from line numbers to probe indices
+    '''
+    lines = [
+        '#include <simdpp/simd.h>',
+        'using namespace simdpp;',
+        'template<class T> SIMDPP_INL',
+        'auto icost_eval(const T& x, int) -> decltype(x.eval()) { return x.eval(); }',
+        'template<class T> SIMDPP_INL',
+        'T icost_eval(const T& x, long) { return x; }',
+    ]
+    line_map = {}
+    for i, probe in enumerate(probes):
+        op = probe.op
+        args = []
+        names = []
+        for j, t in enumerate(op.arg_types):
+            n = probe.width // element_bits[t]
+            args.append('{0}<{1}> a{2}'.format(t, n, j))
+            names.append('a{0}'.format(j))
+        call = op.name
+        if len(op.explicit_args) > 0:
+            call += '<' + ','.join(op.explicit_args) + '>'
+        call += '(' + ', '.join(names) + ')'
+
+        first = len(lines) + 1
+        lines.append('// {0}:{1}'.format(op.path, op.line))
+        lines.append('extern "C" auto icost_probe_{0}({1})'.format(
+                     i, ', '.join(args)))
+        lines.append('    -> decltype(icost_eval({0}, 0))'.format(call))
+        lines.append('{')
+        lines.append('    return icost_eval({0}, 0);'.format(call))
+        lines.append('}')
+        for l in range(first, len(lines) + 1):
+            line_map[l] = i
+    return '\n'.join(lines) + '\n', line_map
+
+def compile_probes(args, arch, probes, tmpdir):
+    ''' Compiles the probes for the given instruction set. The probes that
+        fail to compile are dropped. Returns the path to the object file or
+        None.
+    '''
+    flags, macros = x86_archs[arch]
+    src = os.path.join(tmpdir, 'probe.cc')
+    obj = os.path.join(tmpdir, 'probe.o')
+    active = list(range(len(probes)))
+
+    while len(active) > 0:
+        source, line_map = probe_source([probes[i] for i in active])
+        with open(src, 'w') as f:
+            f.write(source)
+        cmd = [args.cxx, '-std=c++11', '-O2', '-c', '-w',
+               '-I' + args.root, src, '-o', obj] + flags
+        cmd += ['-DSIMDPP_ARCH_' + m for m in macros]
+        p = subprocess.run(cmd, stdout=subprocess.PIPE,
+                           stderr=subprocess.PIPE, universal_newlines=True)
+        if p.returncode == 0:
+            return obj, [probes[i] for i in active]
+
+        failed = set()
+        for m in re.finditer(re.escape(src) + r':(\d+):', p.stderr):
+            l = int(m.group(1))
+            if l in line_map:
+                failed.add(line_map[l])
+        if len(failed) == 0:
+            sys.stderr.write(p.stderr)
+            sys.stderr.write('Could not compile the probes for {0}\n'.format(arch))
+            return None, []
+        active = [a for k, a in enumerate(active) if k not in failed]
+    return None, []
+
+def is_counted(mnemonic, operands):
+    ''' Returns whether the instruction is counted towards the cost of the
+        operation
+    '''
+    if re.match(r'^(ret|endbr|nop|xchg|vzeroupper|push|pop|leave|int3)',
+                mnemonic):
+        return False
+    if mnemonic.startswith(('cs', 'ds', 'data16')):
+        return False
+    if re.search(r'%[re]sp', operands) and \
+            re.match(r'^(and|sub|add|mov|lea)', mnemonic):
+        return False
+    if re.match(r'^v?mov', mnemonic):
+        # Argument and result passing
+        if re.search(r'\(%r(?!ip)', operands):
+            return False
+        # Register to register moves are mostly eliminated by the register
+        # renamer and depend on register allocation
+        if re.match(r'^%\w+,%\w+$', operands):
+            return False
+    return True
+
+def is_const_idiom(mnemonic, operands):
+    ''' Returns whether the instruction sets its destination to all zeros or
+        all ones regardless of the inputs. The annotations don't include these.
+    '''
+    regs = split_top_level(operands)
+    if re.match(r'^v?(p?xor|xorp[sd]|pxor[dq]|pcmpeq[bwdq])\w*$', mnemonic):
+        return len(regs) >= 2 and len(set(regs)) == 1
+    if re.match(r'^vpternlog[dq]$', mnemonic):
+        return len(regs) == 4 and regs[0] == '$0xff'
+    return False
+
+def normalize_reg(reg):
+    ''' Maps all names of the same register, e.g. %xmm1 and %ymm1 or %eax
+        and %rax, to the same string
+    '''
+    m = re.match(r'^%[xyz]mm(\d+)$', reg)
+    if m is not None:
+        return 'v' + m.group(1)
+    m = re.match(r'^%r(\d+)[dwb]?$', reg)
+    if m is not None:
+        return 'r' + m.group(1)
+    m = re.match(r'^%[re]?([abcd])[xlh]$', reg)
+    if m is not None:
+        return m.group(1)
+    m = re.match(r'^%[re]?(si|di|bp|sp)l?$', reg)
+    if m is not None:
+        return m.group(1)
+    return reg[1:]
+
+def parse_operands(mnemonic, operands):
+    ''' Returns the registers read by the instruction, the registers written
+        by it and whether it reads memory other than constants
+    '''
+    ops = split_top_level(operands)
+    reads = []
+    writes = []
+    reads_mem = False
+    for op in ops:
+        for m in re.finditer(r'\{(%k\d)\}', op):
+            reads.append(m.group(1))
+        op = re.sub(r'\{[^}]*\}', '', op)
+        if op.startswith('%'):
+            reads.append(op)
+        elif '(' in op:
+            if '%rip' not in op:
+                reads_mem = True
+            reads += re.findall(r'%\w+', op.split('(', 1)[1])
+
+    # Instructions without a destination register
+    if re.match(r'^(cmp[bwlq]?|test[bwlq]?|v?ptest|v?u?comis[sd]|kortest\w|'
+                r'ktest\w|j\w+|call\w*)$', mnemonic) or len(ops) == 0:
+        return reads, writes, reads_mem
+    dest = re.sub(r'\{[^}]*\}', '', ops[-1])
+    if not dest.startswith('%'):
+        return reads, writes, reads_mem
+    writes.append(dest)
+
+    # Find out whether the destination is also read. Merge masking, legacy
+    # two-operand SSE forms and some VEX instructions read the destination.
+    reads_dest = len(ops) == 1
+    if '{%k' in ops[-1] and '{z}' not in ops[-1]:
+        reads_dest = True
+    if not mnemonic.startswith('v') and len(ops) >= 2 and \
+            not re.match(r'^(mov|lea|pshuf[dhl]|cvt|pmov[sz]x|imul|round|'
+                         r'pextr|sqrt|rcp|rsqrt|set|kmov)', mnemonic):
+        reads_dest = True
+    if re.match(r'^v(fn?m(add|sub)|fmaddsub|fmsubadd|permi2|permt2|pternlog|'
+                r'pdpbusd|pdpwssd|pmadd52|pshldv|pshrdv)', mnemonic):
+        reads_dest = True
+    if not reads_dest:
+        reads.remove(ops[-1] if ops[-1] in reads else dest)
+    return reads, writes, reads_mem
+
+def count_probe(insns):
+    ''' Returns the number of counted instructions among the given
+        (mnemonic, operands) pairs of a single probe.
+
+        Each instruction that depends only on immediates, loads relative to
+        %rip and other such instructions is part of the materialization of a
+        constant. The materialization is counted as a single load when the
+        constant is first used by any other instruction or when it is left in
+        a register at the end of the probe.
+    '''
+    count = 0
+    # register -> id of the constant it holds
+    consts = {}
+    # ids of the constants that have already been counted or that are part of
+    # another constant
+    done = set()
+    next_id = 0
+    for mnemonic, operands in insns:
+        # The padding after the return is not part of the probe
+        if mnemonic.startswith('ret'):
+            break
+        if re.match(r'^(endbr|nop|xchg|vzeroupper|int3|cs|ds|data16)',
+                    mnemonic):
+            continue
+        reads, writes, reads_mem = parse_operands(mnemonic, operands)
+        reads = [normalize_reg(r) for r in reads]
+        writes = [normalize_reg(w) for w in writes]
+
+        if is_const_idiom(mnemonic, operands):
+            for w in writes:
+                consts[w] = next_id
+            done.add(next_id)
+            next_id += 1
+            continue
+
+        const_reads = [r for r in reads if r in consts]
+        if not reads_mem and len(writes) > 0 and \
+                len(const_reads) == len(reads) and \
+                not re.match(r'^(ret|call|j)', mnemonic):
+            if re.match(r'^v?mov', mnemonic) and len(const_reads) == 1:
+                # A copy of a constant is the same constant
+                for w in writes:
+                    consts[w] = consts[const_reads[0]]
+                continue
+            for r in const_reads:
+                done.add(consts[r])
+            for w in writes:
+                consts[w] = next_id
+            next_id += 1
+            continue
+
+        for r in const_reads:
+            if consts[r] not in done:
+                done.add(consts[r])
+                count += 1
+        for w in writes:
+            consts.pop(w, None)
+        if is_counted(mnemonic, operands):
+            count += 1
+
+    count += len(set(c for c in consts.values() if c not in done))
+    return count
+
+def count_instructions(args, obj):
+    ''' Returns a map from probe indices to the number of counted instructions
+        and a map from probe indices to the status of the probes that could
+        not be counted.
+    '''
+    p = subprocess.run([args.objdump, '-d', '-r', '--no-show-raw-insn', obj],
+                       stdout=subprocess.PIPE, universal_newlines=True,
+                       check=True)
+    insns = {}
+    statuses = {}
+    current = None
+    for line in p.stdout.split('\n'):
+        m = re.match(r'^[0-9a-f]+ <icost_probe_(\d+)>:', line)
+        if m is not None:
+            current = int(m.group(1))
+            insns[current] = []
+            continue
+        if re.match(r'^[0-9a-f]+ <', line):
+            current = None
+            continue
+        if current is None or current in statuses:
+            continue
+
+        m = re.match(r'^\s+[0-9a-f]+:\s+R_\w+\s+(\S+)', line)
+        if m is not None:
+            # Only calls to other functions are preceded by relocations that
+            # refer to functions. Constants are referred to via sections.
+            symbol = m.group(1)
+            if 'libsimdpp_instruction_not_available' in symbol:
+                statuses[current] = 'unavailable'
+            elif not symbol.startswith('.'):
+                statuses[current] = 'not_inlined'
+            continue
+
+        m = re.match(r'^\s+[0-9a-f]+:\s+(\S+)\s*(\S*)', line)
+        if m is None:
+            continue
+        insns[current].append((m.group(1), m.group(2)))
+
+    counts = {}
+    for i, probe_insns in insns.items():
+        counts[i] = count_probe(probe_insns)
+    return counts, statuses
+
+def check_arch(args, arch, ops):
+    probes = []
+    for op in ops:
+        for width, annotations in sorted(op.annotations.items()):
+            ann = find_annotation(annotations, arch)
+            if ann is not None:
+                probes.append(Probe(op, width, arch, ann))
+    if len(probes) == 0:
+        return []
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        obj, compiled = compile_probes(args, arch, probes, tmpdir)
+        if obj is None:
+            return probes
+        counts, statuses = count_instructions(args, obj)
+
+    for i, probe in enumerate(compiled):
+        if i in statuses:
+            probe.status = statuses[i]
+            continue
+        count = counts[i]
+        probe.count = count
+        ann = probe.annotation
+        if ann.cost_min <= count <= ann.cost_max:
+            probe.status = 'ok'
+        else:
+            probe.status = 'mismatch'
+    return probes
+
+def print_csv(out, probes):
+    out.write('file,line,function,arg_types,width,arch,expected,actual,status\n')
+    for p in probes:
+        ann = p.annotation
+        expected = str(ann.cost_min)
+        if ann.cost_max != ann.cost_min:
+            expected += '-' + str(ann.cost_max)
+        out.write('{0},{1},{2},{3},{4},{5},{6},{7},{8}\n'.format(
+            p.op.path, p.op.line, p.op.name, ' '.join(p.op.arg_types),
+            p.width, p.arch, expected,
+            '' if p.count is None else p.count, p.status))
+
+def print_json(out, probes):
+    res = []
+    for p in probes:
+        res.append({
+            'file': p.op.path, 'line': p.op.line, 'function': p.op.name,
+            'arg_types': p.op.arg_types, 'width': p.width, 'arch': p.arch,
+            'expected_min': p.annotation.cost_min,
+            'expected_max': p.annotation.cost_max,
+            'actual': p.count, 'status': p.status
+        })
+    json.dump(res, out, indent=2)
+    out.write('\n')
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+    parser = argparse.ArgumentParser(prog='check_icost',
+            description='Verifies the @icost annotations against the code '
+                        'generated by the compiler')
+    parser.add_argument('--cxx', type=str, default='c++',
+            help='The C++ compiler to use')
+    parser.add_argument('--objdump', type=str, default='objdump',
+            help='The objdump executable to use')
+    parser.add_argument('--root', type=str, default=root,
+            help='The root directory of libsimdpp')
+    parser.add_argument('--arch', type=str, action='append',
+            help='The instruction set to check, e.g. AVX2. May be given '
+                 'several times. By default all x86 instruction sets are '
+                 'checked.')
+    parser.add_argument('--format', choices=['csv', 'json'], default='csv',
+            help='The format of the cost table')
+    parser.add_argument('--output', type=str, default=None,
+            help='The file to write the cost table to instead of stdout')
+    parser.add_argument('--strict', action='store_true',
+            help='Exit with nonzero status if any mismatches are found')
+    args = parser.parse_args()
+
+    archs = args.arch if args.arch else list(x86_archs.keys())
+    for arch in archs:
+        if arch not in x86_archs:
+            print('Unknown instruction set: ' + arch, file=sys.stderr)
+            return 1
+
+    def warn(msg):
+        print('warning: ' + msg, file=sys.stderr)
+
+    ops = []
+    for path in sorted(glob.glob(os.path.join(args.root, 'simdpp/core/*.h'))):
+        rel_path = os.path.relpath(path, args.root)
+        ops += parse_header(path, rel_path, warn)
+
+    probes = []
+    for arch in archs:
+        print('Checking ' + arch, file=sys.stderr)
+        probes += check_arch(args, arch, ops)
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    if args.format == 'json':
+        print_json(out, probes)
+    else:
+        print_csv(out, probes)
+    if args.output:
+        out.close()
+
+    mismatches = [p for p in probes if p.status == 'mismatch']
+    for p in mismatches:
+        print('{0}:{1}: {2}: {3}-bit {4}: expected {5}, got {6}'.format(
+              p.op.path, p.op.line, p.op.name, p.width, p.arch,
+              p.annotation.text, p.count), file=sys.stderr)
+    print('{0} checked, {1} ok, {2} mismatches, {3} not checked'.format(
+          len(probes), len([p for p in probes if p.status == 'ok']),
+          len(mismatches),
+          len([p for p in probes if p.status not in ['ok', 'mismatch']])),
+          file=sys.stderr)
+
+    if args.strict and len(mismatches) > 0:
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -46,6 +46,11 @@ single_arch_template = '''
     #else
     #define SIMDPP_DISPATCH_$num$_NS_ID_SSE4_1
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SSE4_2
+    #define SIMDPP_DISPATCH_$num$_NS_ID_SSE4_2 SIMDPP_INSN_ID_SSE4_2
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_SSE4_2
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_POPCNT_INSN
     #define SIMDPP_DISPATCH_$num$_NS_ID_POPCNT_INSN SIMDPP_INSN_ID_POPCNT_INSN
     #else
@@ -91,6 +96,56 @@ single_arch_template = '''
     #else
     #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512DQ
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_$num$_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VL
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VL SIMDPP_INSN_ID_AVX512VL
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VL
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512CD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_$num$_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_NEON_DOTPROD
+    #define SIMDPP_DISPATCH_$num$_NS_ID_NEON_DOTPROD SIMDPP_INSN_ID_NEON_DOTPROD
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_NEON_DOTPROD
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_SVE
+    #define SIMDPP_DISPATCH_$num$_NS_ID_SVE SIMDPP_INSN_ID_SVE
+    #else
+    #define SIMDPP_DISPATCH_$num$_NS_ID_SVE
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_$num$_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -122,23 +177,34 @@ single_arch_template = '''
     #define SIMDPP_DISPATCH_$num$_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_$num$_NAMESPACE SIMDPP_PP_PASTE21(arch,         $n$
+    #define SIMDPP_DISPATCH_$num$_NAMESPACE SIMDPP_PP_PASTE32(arch,         $n$
         SIMDPP_DISPATCH_$num$_NS_ID_NULL,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSE2,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSE3,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSSE3,                                  $n$
         SIMDPP_DISPATCH_$num$_NS_ID_SSE4_1,                                 $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_SSE4_2,                                 $n$
         SIMDPP_DISPATCH_$num$_NS_ID_POPCNT_INSN,                            $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX,                                    $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX2,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512F,                                $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512BW,                               $n$
         SIMDPP_DISPATCH_$num$_NS_ID_AVX512DQ,                               $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VL,                               $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512CD,                               $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VBMI,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VPOPCNTDQ,                        $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_AVX512VNNI,                             $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_F16C,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_FMA3,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_FMA4,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_XOP,                                    $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_GFNI,                                   $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_BMI2,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_NEON,                                   $n$
         SIMDPP_DISPATCH_$num$_NS_ID_NEON_FLT_SP,                            $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_NEON_DOTPROD,                           $n$
+        SIMDPP_DISPATCH_$num$_NS_ID_SVE,                                    $n$
         SIMDPP_DISPATCH_$num$_NS_ID_MSA,                                    $n$
         SIMDPP_DISPATCH_$num$_NS_ID_ALTIVEC,                                $n$
         SIMDPP_DISPATCH_$num$_NS_ID_VSX_206,                                $n$